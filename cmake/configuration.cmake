@@ -12,6 +12,8 @@ option (INSTALL_TDL "Enable installation of TDL. (Projects embedding TDL may wan
 
 include (${tdl_SOURCE_DIR}/cmake/CPM.cmake)
 
+find_package (Threads REQUIRED)
+
 # Make sure to also update the default version in .github/workflows/ci_cmake.yml
 set (TDL_YAML_CPP_VERSION "0.9.0" CACHE STRING "Version of yaml-cpp to use.")
 
@@ -29,7 +31,26 @@ CPMAddPackage (
             "BUILD_TESTING OFF" # Disables CMake/CTest/CDash targets (Continuous, Experimental, Nightly, etc.).
 )
 
-add_library (tdl STATIC ${tdl_SOURCE_DIR}/src/tdl/convertToCTD.cpp ${tdl_SOURCE_DIR}/src/tdl/convertToCWL.cpp)
+add_library (tdl STATIC ${tdl_SOURCE_DIR}/src/tdl/applyValues.cpp
+                        ${tdl_SOURCE_DIR}/src/tdl/CachedExporter.cpp
+                        ${tdl_SOURCE_DIR}/src/tdl/convertToCTD.cpp
+                        ${tdl_SOURCE_DIR}/src/tdl/convertToCWL.cpp
+                        ${tdl_SOURCE_DIR}/src/tdl/cwl_v1_2.cpp
+                        ${tdl_SOURCE_DIR}/src/tdl/diff.cpp
+                        ${tdl_SOURCE_DIR}/src/tdl/embedDescriptors.cpp
+                        ${tdl_SOURCE_DIR}/src/tdl/exportAll.cpp
+                        ${tdl_SOURCE_DIR}/src/tdl/fingerprint.cpp
+                        ${tdl_SOURCE_DIR}/src/tdl/FlatToolInfo.cpp
+                        ${tdl_SOURCE_DIR}/src/tdl/importCTD.cpp
+                        ${tdl_SOURCE_DIR}/src/tdl/importCWL.cpp
+                        ${tdl_SOURCE_DIR}/src/tdl/MappedFile.cpp
+                        ${tdl_SOURCE_DIR}/src/tdl/parseCommandLine.cpp
+                        ${tdl_SOURCE_DIR}/src/tdl/Snapshot.cpp
+                        ${tdl_SOURCE_DIR}/src/tdl/Tracer.cpp
+                        ${tdl_SOURCE_DIR}/src/tdl/Validator.cpp
+                        ${tdl_SOURCE_DIR}/src/tdl/version.cpp
+                        ${tdl_SOURCE_DIR}/src/tdl/writeFile.cpp
+                        ${tdl_SOURCE_DIR}/src/tdl/XMLScanner.cpp)
 target_include_directories (tdl PUBLIC "$<BUILD_INTERFACE:${tdl_SOURCE_DIR}/src>"
                                        "$<INSTALL_INTERFACE:${CMAKE_INSTALL_INCLUDEDIR}>")
 # We explicitly only depend on yaml-cpp for building, and not installing.
@@ -37,9 +58,13 @@ target_include_directories (tdl PUBLIC "$<BUILD_INTERFACE:${tdl_SOURCE_DIR}/src>
 # fetched via CPM.
 # Instead, we link against yaml-cpp manually in tdl-config.cmake.in.
 target_link_libraries (tdl PUBLIC "$<BUILD_INTERFACE:yaml-cpp::yaml-cpp>")
+target_link_libraries (tdl PUBLIC Threads::Threads)
 target_compile_features(tdl PUBLIC cxx_std_17)
+target_compile_definitions (tdl PRIVATE TDL_VERSION_STRING="${TDL_VERSION}")
 add_library (tdl::tdl ALIAS tdl)
 
+include (${tdl_SOURCE_DIR}/cmake/tdl_generate_descriptors.cmake)
+
 if (INSTALL_TDL)
     include (${tdl_SOURCE_DIR}/cmake/install.cmake)
 endif ()
@@ -35,6 +35,9 @@ write_basic_package_version_file (
     VERSION "${TDL_VERSION}"
     COMPATIBILITY AnyNewerVersion)
 install (FILES ${version_file} DESTINATION ${CMAKE_INSTALL_LIBDIR}/cmake/tdl)
+install (FILES "${CMAKE_CURRENT_LIST_DIR}/tdl_generate_descriptors.cmake"
+               "${CMAKE_CURRENT_LIST_DIR}/tdl_generate_descriptors.cpp.in"
+         DESTINATION ${CMAKE_INSTALL_LIBDIR}/cmake/tdl)
 
 install (FILES "${CMAKE_CURRENT_LIST_DIR}/../README.md" TYPE DOC)
 install (DIRECTORY "${CMAKE_CURRENT_LIST_DIR}/../LICENSES" TYPE DOC)
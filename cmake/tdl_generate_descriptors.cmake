@@ -0,0 +1,80 @@
+# SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+# SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+# SPDX-License-Identifier: BSD-3-Clause
+
+cmake_minimum_required (VERSION 3.15)
+
+include_guard (GLOBAL)
+
+set (TDL_GENERATE_DESCRIPTORS_TEMPLATE "${CMAKE_CURRENT_LIST_DIR}/tdl_generate_descriptors.cpp.in")
+
+# Generates the CTD and CWL descriptors of a tool at build time and embeds them into <target>.
+#
+# tdl_generate_descriptors (<target>
+#                           SOURCES <file>...          # sources that define the function below
+#                           [FUNCTION <name>]          # `auto <name>() -> tdl::ToolInfo`, default: tdlToolInfo
+#                           [NAMESPACE <name>]         # namespace of the generated data, default: <target>_descriptors
+#                           [HEADER <file name>]       # generated header, default: <NAMESPACE>.h
+#                           [FORMATS <CTD|CWL>...])    # default: CTD CWL
+#
+# A generator executable is built from SOURCES and linked against tdl::tdl. It writes a header that
+# declares `std::string_view const ctd` and `cwl` and a source that holds the data. The source is added
+# to <target>, which does not have to link against TDL. The descriptors are regenerated whenever the
+# generator changes.
+function (tdl_generate_descriptors target)
+    cmake_parse_arguments (PARSE_ARGV 1 ARG "" "FUNCTION;NAMESPACE;HEADER" "SOURCES;FORMATS")
+
+    if (NOT ARG_SOURCES)
+        message (FATAL_ERROR "tdl_generate_descriptors: SOURCES is required")
+    endif ()
+    if (NOT ARG_FUNCTION)
+        set (ARG_FUNCTION "tdlToolInfo")
+    endif ()
+    if (NOT ARG_NAMESPACE)
+        string (MAKE_C_IDENTIFIER "${target}_descriptors" ARG_NAMESPACE)
+    endif ()
+    string (REPLACE "::" "_" file_stem "${ARG_NAMESPACE}")
+    if (NOT ARG_HEADER)
+        set (ARG_HEADER "${file_stem}.h")
+    endif ()
+    if (NOT ARG_FORMATS)
+        set (ARG_FORMATS CTD CWL)
+    endif ()
+
+    set (TDL_FORMATS "")
+    foreach (format IN LISTS ARG_FORMATS)
+        if (NOT format MATCHES "^(CTD|CWL)$")
+            message (FATAL_ERROR "tdl_generate_descriptors: unknown format ${format}")
+        endif ()
+        list (APPEND TDL_FORMATS "tdl::DescriptorFormat::${format}")
+    endforeach ()
+    list (JOIN TDL_FORMATS ", " TDL_FORMATS)
+
+    # a qualified function name is declared inside of its namespace
+    set (TDL_FUNCTION "${ARG_FUNCTION}")
+    if (ARG_FUNCTION MATCHES "^(.+)::([^:]+)$")
+        set (TDL_FUNCTION_DECLARATION "namespace ${CMAKE_MATCH_1} {\nauto ${CMAKE_MATCH_2}() -> tdl::ToolInfo;\n}")
+    else ()
+        set (TDL_FUNCTION_DECLARATION "auto ${ARG_FUNCTION}() -> tdl::ToolInfo;")
+    endif ()
+    set (TDL_NAMESPACE "${ARG_NAMESPACE}")
+
+    set (output_dir "${CMAKE_CURRENT_BINARY_DIR}/${target}_tdl_descriptors")
+    set (generator "${target}_tdl_generator")
+    configure_file ("${TDL_GENERATE_DESCRIPTORS_TEMPLATE}" "${output_dir}/generator.cpp" @ONLY)
+
+    add_executable (${generator} ${ARG_SOURCES} "${output_dir}/generator.cpp")
+    target_link_libraries (${generator} PRIVATE tdl::tdl)
+
+    set (header "${output_dir}/include/${ARG_HEADER}")
+    set (source "${output_dir}/${file_stem}.cpp")
+    add_custom_command (OUTPUT "${header}" "${source}"
+                        COMMAND ${CMAKE_COMMAND} -E make_directory "${output_dir}/include"
+                        COMMAND ${generator} "${header}" "${source}"
+                        DEPENDS ${generator}
+                        COMMENT "Generating tool descriptors of ${target}"
+                        VERBATIM)
+
+    target_sources (${target} PRIVATE "${header}" "${source}")
+    target_include_directories (${target} PRIVATE "${output_dir}/include")
+endfunction ()
@@ -0,0 +1,172 @@
+#!/usr/bin/env python3
+# SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+# SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+# SPDX-License-Identifier: BSD-3-Clause
+
+"""Splits the CWL bindings generated by cwl-cpp-auto into src/tdl/cwl_v1_2.h and src/tdl/cwl_v1_2.cpp.
+
+The generated header defines everything inline. This script moves the toYaml/fromYaml member definitions,
+the DetectAndExtractFromYaml call operators and the document loading/storing functions into cwl_v1_2.cpp,
+and afterwards applies the local changes recorded in scripts/cwl_v1_2.patch.
+
+    # after regenerating the bindings with cwl-cpp-auto
+    scripts/split_cwl_bindings.py path/to/generated/cwl_v1_2.h
+
+    # after changing src/tdl/cwl_v1_2.h or src/tdl/cwl_v1_2.cpp by hand, records the changes in the patch
+    scripts/split_cwl_bindings.py --update-patch path/to/generated/cwl_v1_2.h
+"""
+
+import argparse
+import pathlib
+import re
+import subprocess
+import sys
+import tempfile
+
+ROOT = pathlib.Path(__file__).resolve().parent.parent
+TARGET = pathlib.PurePosixPath("src/tdl")
+PATCH = ROOT / "scripts" / "cwl_v1_2.patch"
+
+PATCH_HEADER = """\
+# SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+# SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+# SPDX-License-Identifier: Apache-2.0
+#
+# Local changes of the CWL bindings, applied by split_cwl_bindings.py on top of the split generated code.
+# Do not edit by hand, change src/tdl/cwl_v1_2.h or src/tdl/cwl_v1_2.cpp and run
+# scripts/split_cwl_bindings.py --update-patch <generated cwl_v1_2.h>
+
+"""
+
+HEADER_NOTE = """\
+ *
+ * Only declarations are kept in this header, the definitions of the
+ * toYaml/fromYaml members and of the document loading/storing functions
+ * live in cwl_v1_2.cpp.
+"""
+
+SOURCE_PREAMBLE = """\
+
+/* This file was generated using schema-salad code generator.
+ *
+ * The embedded document is subject to the license of the original schema.
+ *
+ * Definitions split out of cwl_v1_2.h, so the bindings are only compiled once.
+ */
+
+#include "cwl_v1_2.h"
+
+#include <sstream>
+
+"""
+
+MEMBER_DEFINITION = re.compile(r"^(inline )?(auto|void) w3id_org::cwl::[\w:]+::(toYaml|fromYaml)\(")
+DETECT_STRUCT = re.compile(r"^struct DetectAndExtractFromYaml<(::w3id_org::cwl::[\w:]+)> \{$")
+DOCUMENT_FUNCTION = re.compile(r"^(inline )?(auto|void) \w+\(.*\{$")
+DEFAULT_ARGUMENT = re.compile(r"\s*=\s*(\{\}|\w+)(?=[,)])")
+
+
+def block_end(lines, begin, closing):
+    """the index of the line `closing` that ends the block starting at `begin`"""
+    end = begin
+    while lines[end] != closing:
+        end += 1
+    return end
+
+
+def split(generated):
+    """returns the header and the source file for the text of the generated header"""
+    lines = generated.split("\n")
+    header = []
+    source = []
+    documents = []  # definitions of the document functions, they go into one namespace block at the end
+
+    i = 0
+    in_documents = False
+    while i < len(lines):
+        line = lines[i]
+        if line.startswith(" * The embedded document is subject"):
+            header.append(line)
+            header.extend(HEADER_NOTE.rstrip("\n").split("\n"))
+            i += 1
+        elif line == "#include <sstream>":
+            i += 1
+        elif MEMBER_DEFINITION.match(line):
+            end = block_end(lines, i, "}")
+            source.append(line.removeprefix("inline "))
+            source.extend(lines[i + 1 : end + 1])
+            i = end + 1
+        elif m := DETECT_STRUCT.match(line):
+            header.append(line)
+            call = lines[i + 1]
+            assert call.startswith("    auto operator()(") and call.endswith(" {"), call
+            end = block_end(lines, i + 1, "    }")
+            header.append(call[: -len(" {")] + ";")
+            source.append("namespace w3id_org::cwl {")
+            source.append(f"auto DetectAndExtractFromYaml<{m.group(1)}>::{call.strip().removeprefix('auto ')}")
+            source.extend(body.removeprefix("    ") for body in lines[i + 2 : end + 1])
+            source.append("}")
+            i = end + 1
+        elif line.startswith("using DocumentRootType = "):
+            header.append(line)
+            in_documents = True
+            i += 1
+        elif in_documents and DOCUMENT_FUNCTION.match(line):
+            end = block_end(lines, i, "}")
+            signature = line.removeprefix("inline ")[: -len(" {")]
+            header.append(signature + ";")
+            documents.append(DEFAULT_ARGUMENT.sub("", signature) + " {")
+            documents.extend(lines[i + 1 : end + 1])
+            i = end + 1
+        else:
+            header.append(line)
+            i += 1
+
+    license = [line for line in lines[:2] if line.startswith("// SPDX")]
+    source = license + SOURCE_PREAMBLE.rstrip("\n").split("\n") + source
+    source += ["namespace w3id_org::cwl {"] + documents + ["", "}"]
+    return "\n".join(header), "\n".join(source)
+
+
+def write_split(generated, directory):
+    header, source = split(generated.read_text())
+    target = directory / TARGET
+    target.mkdir(parents=True, exist_ok=True)
+    (target / "cwl_v1_2.h").write_text(header)
+    (target / "cwl_v1_2.cpp").write_text(source)
+
+
+def update_patch(generated):
+    with tempfile.TemporaryDirectory() as tmp:
+        tmp = pathlib.Path(tmp)
+        write_split(generated, tmp / "a")
+        for name in ("cwl_v1_2.h", "cwl_v1_2.cpp"):
+            (tmp / "b" / TARGET).mkdir(parents=True, exist_ok=True)
+            (tmp / "b" / TARGET / name).write_text((ROOT / TARGET / name).read_text())
+        diff = subprocess.run(["git", "diff", "--no-index", "--no-prefix", "a", "b"],
+                              cwd=tmp, capture_output=True, text=True)
+        if diff.returncode > 1:
+            sys.exit(diff.stderr)
+    # "a/src/tdl/x" and "b/src/tdl/x" are already the usual prefixes, --no-prefix keeps them as they are
+    PATCH.write_text(PATCH_HEADER + diff.stdout)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("generated", type=pathlib.Path, help="cwl_v1_2.h as generated by cwl-cpp-auto")
+    parser.add_argument("--update-patch", action="store_true",
+                        help="record the differences of src/tdl/cwl_v1_2.{h,cpp} to the split in the patch")
+    args = parser.parse_args()
+
+    if args.update_patch:
+        update_patch(args.generated)
+        return
+
+    write_split(args.generated, ROOT)
+    result = subprocess.run(["git", "apply", "--reject", "--whitespace=nowarn", str(PATCH)], cwd=ROOT)
+    if result.returncode != 0:
+        sys.exit("the local changes did not apply cleanly, resolve the *.rej files and run --update-patch")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "CachedExporter.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <system_error>
+#include <vector>
+
+#include "convertToCTD.h"
+#include "fingerprint.h"
+#include "version.h"
+#include "writeFile.h"
+
+namespace tdl {
+
+namespace detail {
+
+inline auto cacheExtension(DescriptorFormat format) -> std::string_view {
+    return format == DescriptorFormat::CTD ? ".ctd" : ".cwl";
+}
+
+//!\brief 32 hex digits and the extension of a format, temporary files start with a '.'
+inline auto isCacheEntry(std::filesystem::path const & path) -> bool {
+    auto extension = path.extension();
+    return (extension == ".ctd" || extension == ".cwl") && path.stem().string().size() == 32
+        && path.filename().string().front() != '.';
+}
+
+} // namespace detail
+
+CachedExporter::CachedExporter(std::filesystem::path dir, CacheOptions options)
+    : dir_{std::move(dir)}
+    , options_{std::move(options)} {
+    std::filesystem::create_directories(dir_);
+
+    auto found = std::vector<std::pair<std::filesystem::file_time_type, Entry>>{};
+    for (auto const & file : std::filesystem::directory_iterator{dir_}) {
+        if (file.is_regular_file() && detail::isCacheEntry(file.path())) {
+            found.push_back({file.last_write_time(), Entry{file.path().filename().string(), file.file_size()}});
+        }
+    }
+    std::sort(found.begin(), found.end(), [](auto const & lhs, auto const & rhs) { return lhs.first > rhs.first; });
+    for (auto & [time, entry] : found) {
+        lru_.push_back(std::move(entry));
+        entries_.emplace(lru_.back().name, std::prev(lru_.end()));
+        size_ += lru_.back().size;
+    }
+    evict();
+}
+
+auto CachedExporter::get(ToolInfo const & doc, DescriptorFormat format) -> CachedDescriptor {
+    auto file = path(doc, format);
+    auto name = file.filename().string();
+
+    auto ec = std::error_code{};
+    if (std::filesystem::exists(file, ec)) {
+        try {
+            auto mapped = MappedFile{file};
+            // the modification time keeps the order of use across restarts
+            std::filesystem::last_write_time(file, std::filesystem::file_time_type::clock::now(), ec);
+
+            auto lock = std::lock_guard{mutex_};
+            ++hits_;
+            use(name, mapped.data().size());
+            return CachedDescriptor{std::move(mapped)};
+        } catch (std::runtime_error const &) {
+            // removed in the meantime, e.g. by another process, it is generated again
+        }
+    }
+
+    auto data = format == DescriptorFormat::CTD ? convertToCTD(doc) : convertToCWL(doc, options_.postProcessCWL);
+    writeFileAtomically(file, data);
+
+    auto lock = std::lock_guard{mutex_};
+    ++misses_;
+    use(name, data.size());
+    evict();
+    return CachedDescriptor{std::move(data)};
+}
+
+auto CachedExporter::path(ToolInfo const & doc, DescriptorFormat format) const -> std::filesystem::path {
+    auto hash = detail::Fnv1a128{};
+    hash.update(fingerprint(doc).toString());
+    hash.update(static_cast<unsigned char>(0));
+    hash.update(version());
+    hash.update(static_cast<unsigned char>(0));
+    hash.update(options_.key);
+    return dir_ / (hash.value().toString() + std::string{detail::cacheExtension(format)});
+}
+
+auto CachedExporter::size() const -> std::uintmax_t {
+    auto lock = std::lock_guard{mutex_};
+    return size_;
+}
+
+auto CachedExporter::hits() const -> std::size_t {
+    auto lock = std::lock_guard{mutex_};
+    return hits_;
+}
+
+auto CachedExporter::misses() const -> std::size_t {
+    auto lock = std::lock_guard{mutex_};
+    return misses_;
+}
+
+//!\brief moves an entry to the front, adds it if it is new
+void CachedExporter::use(std::string const & name, std::uintmax_t size) {
+    if (auto iter = entries_.find(name); iter != entries_.end()) {
+        size_ -= iter->second->size;
+        iter->second->size = size;
+        lru_.splice(lru_.begin(), lru_, iter->second);
+    } else {
+        lru_.push_front(Entry{name, size});
+        entries_.emplace(lru_.front().name, lru_.begin());
+    }
+    size_ += size;
+}
+
+//!\brief removes the least recently used entries until the size bound holds
+void CachedExporter::evict() {
+    while (size_ > options_.maxBytes && !lru_.empty()) {
+        auto const & entry = lru_.back();
+        auto         ec    = std::error_code{};
+        std::filesystem::remove(dir_ / entry.name, ec);
+        size_ -= entry.size;
+        entries_.erase(entry.name);
+        lru_.pop_back();
+    }
+}
+
+} // namespace tdl
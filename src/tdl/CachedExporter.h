@@ -0,0 +1,107 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+#include "DescriptorFormat.h"
+#include "MappedFile.h"
+#include "ToolInfo.h"
+#include "convertToCWL.h"
+
+namespace tdl {
+
+//!\brief Options of a `CachedExporter`
+struct CacheOptions {
+    std::uintmax_t maxBytes{std::uintmax_t{1} << 30}; //!< Least recently used entries are removed beyond this size
+    PostProcessCWL postProcessCWL{post_process_cwl};  //!< Used instead of the global `post_process_cwl`
+    std::string    key{};                             //!< Part of every cache key, e.g. a name of `postProcessCWL`
+};
+
+//!\brief A descriptor returned by `CachedExporter`, either mapped from the cache or just generated
+class CachedDescriptor {
+public:
+    explicit CachedDescriptor(MappedFile file)
+        : file_{std::move(file)} {}
+    explicit CachedDescriptor(std::string generated)
+        : generated_{std::move(generated)} {}
+
+    auto data() const -> std::string_view {
+        return file_ ? file_->data() : std::string_view{generated_};
+    }
+    //!\brief true if the descriptor was read from the cache
+    auto hit() const -> bool {
+        return file_.has_value();
+    }
+
+private:
+    std::optional<MappedFile> file_{};
+    std::string               generated_{};
+};
+
+/*!\brief Generates CTD and CWL descriptors and keeps them in a directory
+ *
+ * The cache key of a descriptor is a hash of the `fingerprint` of the ToolInfo, the format, the TDL
+ * version and `CacheOptions::key`. It is used as the file name, so a changed tool or a new release
+ * never finds an outdated entry. `postProcessCWL` can not be hashed, describe it in `key` instead.
+ * `CacheOptions` picks up the global `post_process_cwl` when it is created, so callers that set a post
+ * processing, globally or in the options, must also set `key`. Otherwise entries written with and
+ * without it share the same names.
+ *
+ * Hits are memory mapped, the file is not copied. New entries are written atomically, so several
+ * processes can share a directory. When the entries of this exporter exceed `maxBytes`, the least
+ * recently used ones are removed. The order of use is kept in the modification time of the files,
+ * so it survives restarts. Entries written by other processes are only counted after a restart.
+ *
+ * All member functions may be called from several threads at once.
+ */
+class CachedExporter {
+public:
+    //!\brief opens or creates the cache directory, existing entries are ordered by their modification time
+    explicit CachedExporter(std::filesystem::path dir, CacheOptions options = {});
+
+    //!\brief the descriptor of `doc`, mapped from the cache or generated and stored
+    auto get(ToolInfo const & doc, DescriptorFormat format) -> CachedDescriptor;
+
+    //!\brief the file that holds (or would hold) the descriptor of `doc`
+    auto path(ToolInfo const & doc, DescriptorFormat format) const -> std::filesystem::path;
+
+    //!\brief the total size of the known entries in bytes
+    auto size() const -> std::uintmax_t;
+
+    auto hits() const -> std::size_t;
+    auto misses() const -> std::size_t;
+
+private:
+    struct Entry {
+        std::string    name;
+        std::uintmax_t size;
+    };
+    using LRU = std::list<Entry>; //!< Most recently used first
+
+    void use(std::string const & name, std::uintmax_t size);
+    void evict();
+
+    std::filesystem::path dir_;
+    CacheOptions          options_;
+
+    mutable std::mutex                                   mutex_{};
+    LRU                                                  lru_{};
+    std::unordered_map<std::string_view, LRU::iterator> entries_{}; //!< Refers to the names in `lru_`
+    std::uintmax_t                                       size_{};
+    std::size_t                                          hits_{};
+    std::size_t                                          misses_{};
+};
+
+} // namespace tdl
@@ -0,0 +1,15 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+namespace tdl {
+
+//!\brief Formats of the descriptors generated by TDL
+enum class DescriptorFormat {
+    CTD,
+    CWL
+};
+
+} // namespace tdl
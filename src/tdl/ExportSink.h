@@ -0,0 +1,62 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <string_view>
+
+namespace tdl {
+
+/*!\brief Receives the output of `streamCTD` or `streamCWL` piece by piece
+ *
+ * A chunk is only valid during the call. Exceptions thrown by the sink abort the export and are
+ * passed on to the caller.
+ */
+using ExportSink = std::function<void(std::string_view chunk)>;
+
+//!\brief Chunks passed to an `ExportSink` are about this size, only the last one and single large parameters differ
+constexpr auto exportChunkSize = std::size_t{16 * 1024};
+
+namespace detail {
+
+//!\brief collects small pieces of output and passes them on in chunks of `exportChunkSize`
+class ChunkWriter {
+public:
+    explicit ChunkWriter(ExportSink const & sink)
+        : sink_{sink} {
+        buffer_.reserve(exportChunkSize);
+    }
+
+    void append(std::string_view str) {
+        buffer_ += str;
+        if (buffer_.size() >= exportChunkSize) {
+            flush();
+        }
+    }
+
+    void flush() {
+        if (!buffer_.empty()) {
+            bytes_ += buffer_.size();
+            sink_(buffer_);
+            buffer_.clear();
+        }
+    }
+
+    //!\brief bytes passed to the sink so far
+    auto bytes() const -> std::size_t {
+        return bytes_;
+    }
+
+private:
+    ExportSink const & sink_;
+    std::string        buffer_{};
+    std::size_t        bytes_{};
+};
+
+} // namespace detail
+
+} // namespace tdl
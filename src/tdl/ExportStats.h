@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <string_view>
+
+#include "Tracer.h"
+
+namespace tdl {
+
+//!\brief The phases of `convertToCTD` and `convertToCWL` measured by `ExportStats`
+enum class ExportPhase {
+    CTDBuild,         //!< building the XMLNode tree
+    CTDGenerate,      //!< XMLNode::generateString
+    CWLBuild,         //!< building the CommandLineTool from the ToolInfo
+    CWLToYaml,        //!< w3id_org::cwl::toYaml
+    CWLSimplifyTypes, //!< simplifyType on all types
+    CWLPostProcess,   //!< post_process_cwl
+    CWLEmit,          //!< YAML::Emitter
+    Count
+};
+
+constexpr auto exportPhaseCount = static_cast<std::size_t>(ExportPhase::Count);
+
+//!\brief name of a phase, e.g. "cwl_to_yaml"
+constexpr auto exportPhaseName(ExportPhase phase) -> std::string_view {
+    constexpr std::string_view names[] = {"ctd_build",
+                                          "ctd_generate",
+                                          "cwl_build",
+                                          "cwl_to_yaml",
+                                          "cwl_simplify_types",
+                                          "cwl_post_process",
+                                          "cwl_emit"};
+    return names[static_cast<std::size_t>(phase)];
+}
+
+/*!\brief Durations and sizes of exports, filled by the overloads of `convertToCTD` and `convertToCWL` taking it
+ *
+ * All values are added, so one object can collect the stats of many exports. The exporters without
+ * an `ExportStats` argument do not measure anything.
+ *
+ * TDL does not replace `operator new`. To get allocation counts, set `allocationCounter` to a
+ * function returning the number of allocations made so far, e.g. by the current thread.
+ */
+struct ExportStats {
+    std::array<std::chrono::nanoseconds, exportPhaseCount> durations{};   //!< Time spent per phase
+    std::array<std::size_t, exportPhaseCount>              allocations{}; //!< Allocations per phase, if counted
+    std::size_t                                            exports{};     //!< Number of measured exports
+    std::size_t                                            nodes{};       //!< Exported nodes, groups included
+    std::size_t                                            bytes{};       //!< Size of the generated descriptors
+
+    std::size_t (*allocationCounter)() = nullptr; //!< Optional, see above
+
+    auto duration(ExportPhase phase) const -> std::chrono::nanoseconds {
+        return durations[static_cast<std::size_t>(phase)];
+    }
+    auto allocationCount(ExportPhase phase) const -> std::size_t {
+        return allocations[static_cast<std::size_t>(phase)];
+    }
+    //!\brief sum of all phases
+    auto totalDuration() const -> std::chrono::nanoseconds {
+        auto total = std::chrono::nanoseconds{};
+        for (auto d : durations) {
+            total += d;
+        }
+        return total;
+    }
+
+    //!\brief adds the stats of other exports, e.g. of another thread; `allocationCounter` is kept
+    auto operator+=(ExportStats const & other) -> ExportStats & {
+        for (std::size_t i = 0; i < exportPhaseCount; ++i) {
+            durations[i] += other.durations[i];
+            allocations[i] += other.allocations[i];
+        }
+        exports += other.exports;
+        nodes += other.nodes;
+        bytes += other.bytes;
+        return *this;
+    }
+};
+
+namespace detail {
+
+//!\brief adds the time and allocations of its scope to a phase and records it as a trace span
+class PhaseTimer {
+public:
+    PhaseTimer(ExportStats * stats, ExportPhase phase)
+        : span_{"tdl.phase", exportPhaseName(phase)}, stats_{stats}, phase_{phase} {
+        if (stats_) {
+            allocations_ = stats_->allocationCounter ? stats_->allocationCounter() : 0;
+            start_       = std::chrono::steady_clock::now();
+        }
+    }
+    PhaseTimer(PhaseTimer const &)                     = delete;
+    auto operator=(PhaseTimer const &) -> PhaseTimer & = delete;
+
+    ~PhaseTimer() {
+        if (stats_) {
+            auto index = static_cast<std::size_t>(phase_);
+            stats_->durations[index] += std::chrono::steady_clock::now() - start_;
+            if (stats_->allocationCounter) {
+                stats_->allocations[index] += stats_->allocationCounter() - allocations_;
+            }
+        }
+    }
+
+private:
+    TraceSpan                             span_;
+    ExportStats *                         stats_;
+    ExportPhase                           phase_;
+    std::size_t                           allocations_{};
+    std::chrono::steady_clock::time_point start_{};
+};
+
+} // namespace detail
+
+} // namespace tdl
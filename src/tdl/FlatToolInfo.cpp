@@ -0,0 +1,182 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "FlatToolInfo.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace tdl {
+
+namespace detail {
+
+//!\brief collects the nodes of a tree in pre-order
+struct Flattener {
+    FlatToolInfo &                                            flat;
+    std::unordered_map<std::string_view, FlatToolInfo::Index> stringIndices{};
+
+    auto intern(std::string const & str) -> FlatToolInfo::Index {
+        auto iter = stringIndices.find(str);
+        if (iter != stringIndices.end()) {
+            return iter->second;
+        }
+        auto index = static_cast<FlatToolInfo::Index>(flat.strings.size());
+        flat.strings.push_back(str);
+        // the key refers to the caller's string, which outlives the flattening
+        stringIndices.emplace(str, index);
+        return index;
+    }
+
+    template <typename T>
+    static auto addToPool(std::vector<T> & pool, T const & value) -> FlatToolInfo::Index {
+        pool.push_back(value);
+        return static_cast<FlatToolInfo::Index>(pool.size() - 1);
+    }
+
+    auto addValue(Node::Value const & value) -> FlatToolInfo::Index {
+        switch (static_cast<FlatToolInfo::ValueType>(value.index())) {
+        case FlatToolInfo::ValueType::Bool:
+            return addToPool(flat.bools, std::get<BoolValue>(value));
+        case FlatToolInfo::ValueType::Int:
+            return addToPool(flat.ints, std::get<IntValue>(value));
+        case FlatToolInfo::ValueType::Double:
+            return addToPool(flat.doubles, std::get<DoubleValue>(value));
+        case FlatToolInfo::ValueType::String:
+            return addToPool(flat.stringValues, std::get<StringValue>(value));
+        case FlatToolInfo::ValueType::IntList:
+            return addToPool(flat.intLists, std::get<IntValueList>(value));
+        case FlatToolInfo::ValueType::DoubleList:
+            return addToPool(flat.doubleLists, std::get<DoubleValueList>(value));
+        case FlatToolInfo::ValueType::StringList:
+            return addToPool(flat.stringLists, std::get<StringValueList>(value));
+        case FlatToolInfo::ValueType::Children:
+            break;
+        }
+        return FlatToolInfo::npos;
+    }
+
+    void add(Node::Children const & children, FlatToolInfo::Index parentNode) {
+        auto previous = FlatToolInfo::npos;
+        for (auto const & child : children) {
+            if (flat.size() >= FlatToolInfo::npos) {
+                throw std::length_error{"too many nodes for FlatToolInfo"};
+            }
+            auto index = static_cast<FlatToolInfo::Index>(flat.size());
+            flat.parent.push_back(parentNode);
+            flat.firstChild.push_back(FlatToolInfo::npos);
+            flat.nextSibling.push_back(FlatToolInfo::npos);
+            flat.name.push_back(intern(child.name));
+            flat.description.push_back(intern(child.description));
+            flat.tags.push_back(child.tags);
+            flat.valueType.push_back(static_cast<FlatToolInfo::ValueType>(child.value.index()));
+            flat.valueIndex.push_back(addValue(child.value));
+
+            if (previous != FlatToolInfo::npos) {
+                flat.nextSibling[previous] = index;
+            } else if (parentNode != FlatToolInfo::npos) {
+                flat.firstChild[parentNode] = index;
+            }
+            previous = index;
+
+            if (auto grandChildren = std::get_if<Node::Children>(&child.value)) {
+                add(*grandChildren, index);
+            }
+        }
+    }
+};
+
+//!\brief rebuilds the node `first` and all its siblings
+inline auto unflattenChildren(FlatToolInfo const & flat, FlatToolInfo::Index first) -> Node::Children {
+    auto children = Node::Children{};
+    for (auto index = first; index != FlatToolInfo::npos; index = flat.nextSibling[index]) {
+        auto & child      = children.emplace_back();
+        child.name        = flat.nameOf(index);
+        child.description = flat.descriptionOf(index);
+        child.tags        = flat.tags[index];
+        if (flat.valueType[index] == FlatToolInfo::ValueType::Children) {
+            child.value = unflattenChildren(flat, flat.firstChild[index]);
+        } else {
+            child.value = flat.valueOf(index);
+        }
+    }
+    return children;
+}
+
+} // namespace detail
+
+auto FlatToolInfo::valueOf(Index node) const -> Node::Value {
+    auto index = valueIndex[node];
+    switch (valueType[node]) {
+    case ValueType::Bool:
+        return BoolValue{bools[index]};
+    case ValueType::Int:
+        return ints[index];
+    case ValueType::Double:
+        return doubles[index];
+    case ValueType::String:
+        return stringValues[index];
+    case ValueType::IntList:
+        return intLists[index];
+    case ValueType::DoubleList:
+        return doubleLists[index];
+    case ValueType::StringList:
+        return stringLists[index];
+    case ValueType::Children:
+        break;
+    }
+    return Node::Children{};
+}
+
+auto FlatToolInfo::findChild(Index parentNode, std::string_view childName) const -> Index {
+    auto index = parentNode == npos ? (size() > 0 ? Index{0} : npos) : firstChild[parentNode];
+    for (; index != npos; index = nextSibling[index]) {
+        if (nameOf(index) == childName) {
+            return index;
+        }
+    }
+    return npos;
+}
+
+auto FlatToolInfo::find(std::string_view nodeName) const -> Index {
+    // compare string indices instead of strings, all equal names share the same index
+    auto iter = std::find(strings.begin(), strings.end(), nodeName);
+    if (iter == strings.end()) {
+        return npos;
+    }
+    auto stringIndex = static_cast<Index>(iter - strings.begin());
+    auto node        = std::find(name.begin(), name.end(), stringIndex);
+    return node == name.end() ? npos : static_cast<Index>(node - name.begin());
+}
+
+auto flatten(ToolInfo const & doc) -> FlatToolInfo {
+    auto flat       = FlatToolInfo{};
+    flat.metaInfo   = doc.metaInfo;
+    flat.cliMapping = doc.cliMapping;
+
+    auto count = detail::countNodes(doc.params);
+    flat.parent.reserve(count);
+    flat.firstChild.reserve(count);
+    flat.nextSibling.reserve(count);
+    flat.name.reserve(count);
+    flat.description.reserve(count);
+    flat.tags.reserve(count);
+    flat.valueType.reserve(count);
+    flat.valueIndex.reserve(count);
+
+    detail::Flattener{flat}.add(doc.params, FlatToolInfo::npos);
+    return flat;
+}
+
+auto unflatten(FlatToolInfo const & doc) -> ToolInfo {
+    auto toolInfo       = ToolInfo{};
+    toolInfo.metaInfo   = doc.metaInfo;
+    toolInfo.cliMapping = doc.cliMapping;
+    if (doc.size() > 0) {
+        toolInfo.params = detail::unflattenChildren(doc, 0);
+    }
+    return toolInfo;
+}
+
+} // namespace tdl
@@ -0,0 +1,91 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "ToolInfo.h"
+
+namespace tdl {
+
+/*!\brief A ToolInfo whose parameter tree is stored in flat arrays
+ *
+ * The nodes are stored in pre-order, every property of a node lives in its own array
+ * and is accessed by the node index. Names and descriptions are indices into a table
+ * of unique strings, values are indices into one pool per value type.
+ * Top level parameters have the parent `npos`, the first one has the index 0.
+ */
+struct FlatToolInfo {
+    using Index = uint32_t;
+
+    static constexpr Index npos = std::numeric_limits<Index>::max();
+
+    //!\brief type of the value of a node, same order as the alternatives of `Node::Value`
+    enum class ValueType : uint8_t {
+        Bool,
+        Int,
+        Double,
+        String,
+        IntList,
+        DoubleList,
+        StringList,
+        Children
+    };
+
+    MetaInfo                metaInfo{};
+    std::vector<CLIMapping> cliMapping{};
+
+    std::vector<Index>     parent{};      //!< Index of the parent node, or npos
+    std::vector<Index>     firstChild{};  //!< Index of the first child node, or npos
+    std::vector<Index>     nextSibling{}; //!< Index of the next node with the same parent, or npos
+    std::vector<Index>     name{};        //!< Index into `strings`
+    std::vector<Index>     description{}; //!< Index into `strings`
+    std::vector<Tags>      tags{};
+    std::vector<ValueType> valueType{};
+    std::vector<Index>     valueIndex{}; //!< Index into the pool of `valueType`, unused for Children
+
+    std::vector<std::string> strings{}; //!< Each string is stored once
+
+    std::vector<BoolValue>       bools{};
+    std::vector<IntValue>        ints{};
+    std::vector<DoubleValue>     doubles{};
+    std::vector<StringValue>     stringValues{};
+    std::vector<IntValueList>    intLists{};
+    std::vector<DoubleValueList> doubleLists{};
+    std::vector<StringValueList> stringLists{};
+
+    //!\brief number of nodes
+    auto size() const -> std::size_t {
+        return parent.size();
+    }
+
+    auto nameOf(Index node) const -> std::string const & {
+        return strings[name[node]];
+    }
+    auto descriptionOf(Index node) const -> std::string const & {
+        return strings[description[node]];
+    }
+
+    //!\brief reconstructs the value of a node, the children of a node are not included
+    auto valueOf(Index node) const -> Node::Value;
+
+    //!\brief index of the direct child with the given name, or npos. Use `npos` as parent to search the top level.
+    auto findChild(Index parentNode, std::string_view childName) const -> Index;
+
+    //!\brief index of the first node with the given name, or npos
+    auto find(std::string_view nodeName) const -> Index;
+};
+
+//!\brief converts the parameter tree into the flat representation
+auto flatten(ToolInfo const & doc) -> FlatToolInfo;
+
+//!\brief converts the flat representation back into a ToolInfo
+auto unflatten(FlatToolInfo const & doc) -> ToolInfo;
+
+} // namespace tdl
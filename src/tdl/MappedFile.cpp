@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "MappedFile.h"
+
+#include <stdexcept>
+#include <utility>
+
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+namespace tdl {
+
+MappedFile::MappedFile(std::filesystem::path const & path) {
+    auto fail = [&]() {
+        throw std::runtime_error{"can not map file " + path.string()};
+    };
+#ifdef _WIN32
+    auto file = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        fail();
+    }
+    auto size = LARGE_INTEGER{};
+    if (!GetFileSizeEx(file, &size)) {
+        CloseHandle(file);
+        fail();
+    }
+    if (size.QuadPart == 0) { // empty files can not be mapped
+        CloseHandle(file);
+        return;
+    }
+    auto mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file);
+    if (!mapping) {
+        fail();
+    }
+    auto view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!view) {
+        fail();
+    }
+    data_ = static_cast<char const *>(view);
+    size_ = static_cast<std::size_t>(size.QuadPart);
+#else
+    auto fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        fail();
+    }
+    struct stat info {};
+    if (::fstat(fd, &info) != 0) {
+        ::close(fd);
+        fail();
+    }
+    if (info.st_size == 0) { // empty files can not be mapped
+        ::close(fd);
+        return;
+    }
+    auto size = static_cast<std::size_t>(info.st_size);
+    auto addr = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (addr == MAP_FAILED) {
+        fail();
+    }
+    data_ = static_cast<char const *>(addr);
+    size_ = size;
+#endif
+}
+
+MappedFile::~MappedFile() {
+    unmap();
+}
+
+MappedFile::MappedFile(MappedFile && other) noexcept
+    : data_{std::exchange(other.data_, nullptr)}
+    , size_{std::exchange(other.size_, 0)} {}
+
+auto MappedFile::operator=(MappedFile && other) noexcept -> MappedFile & {
+    if (this != &other) {
+        unmap();
+        data_ = std::exchange(other.data_, nullptr);
+        size_ = std::exchange(other.size_, 0);
+    }
+    return *this;
+}
+
+void MappedFile::unmap() noexcept {
+    if (!data_) {
+        return;
+    }
+#ifdef _WIN32
+    UnmapViewOfFile(data_);
+#else
+    ::munmap(const_cast<char *>(data_), size_);
+#endif
+    data_ = nullptr;
+    size_ = 0;
+}
+
+} // namespace tdl
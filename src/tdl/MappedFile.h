@@ -0,0 +1,39 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+
+namespace tdl {
+
+/*!\brief A read only memory mapping of a whole file
+ *
+ * The mapping starts at a page boundary, so the data is suitably aligned for any type.
+ */
+class MappedFile {
+public:
+    //!\brief maps the file, throws `std::runtime_error` if it can not be opened or mapped
+    explicit MappedFile(std::filesystem::path const & path);
+    ~MappedFile();
+
+    MappedFile(MappedFile const &)                     = delete;
+    MappedFile(MappedFile && other) noexcept;
+    auto operator=(MappedFile const &) -> MappedFile & = delete;
+    auto operator=(MappedFile && other) noexcept -> MappedFile &;
+
+    auto data() const -> std::string_view {
+        return {data_, size_};
+    }
+
+private:
+    void unmap() noexcept;
+
+    char const * data_{};
+    std::size_t  size_{};
+};
+
+} // namespace tdl
@@ -0,0 +1,126 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include "ToolInfo.h"
+
+namespace tdl {
+
+/*!\brief Lookup of the parameters of a ToolInfo by path or by name
+ *
+ * A path consists of the names of all nodes from the top level down to the parameter,
+ * separated by ':', e.g. "search:index". Leaf names are the names of all nodes that hold a value.
+ * If several leafs share a name, the name is ambiguous and can only be looked up by its path.
+ * If several siblings share a name, their path is ambiguous and `find` returns nullptr for it.
+ *
+ * The index stores pointers into the tree. It stays valid as long as no nodes are added, removed
+ * or renamed, changing values is fine.
+ * Use `ParamIndex` for a `ToolInfo const` and `MutableParamIndex` to modify the found nodes.
+ */
+template <typename NodeType>
+class BasicParamIndex {
+public:
+    using ToolInfoType = std::conditional_t<std::is_const_v<NodeType>, ToolInfo const, ToolInfo>;
+
+    static constexpr char separator = ':';
+
+    BasicParamIndex() = default;
+    explicit BasicParamIndex(ToolInfoType & doc) {
+        paths_.reserve(detail::countNodes(doc.params));
+        add(doc.params, "");
+    }
+
+    // the maps refer to the strings in `paths_`, moving keeps them valid, copying would not
+    BasicParamIndex(BasicParamIndex const &)                     = delete;
+    BasicParamIndex(BasicParamIndex &&)                          = default;
+    auto operator=(BasicParamIndex const &) -> BasicParamIndex & = delete;
+    auto operator=(BasicParamIndex &&) -> BasicParamIndex &      = default;
+
+    //!\brief the node with the given path, or nullptr if there is no such node or the path is ambiguous
+    auto find(std::string_view path) const -> NodeType * {
+        auto iter = byPath_.find(path);
+        return iter != byPath_.end() ? iter->second : nullptr;
+    }
+
+    //!\brief the leaf with the given name, or nullptr if there is no such leaf or the name is ambiguous
+    auto findByName(std::string_view name) const -> NodeType * {
+        auto iter = byName_.find(name);
+        return iter != byName_.end() ? iter->second : nullptr;
+    }
+
+    //!\brief true if several leafs have the given name
+    auto isAmbiguous(std::string_view name) const -> bool {
+        auto iter = byName_.find(name);
+        return iter != byName_.end() && iter->second == nullptr;
+    }
+
+    //!\brief all leaf names that are used more than once
+    auto ambiguousNames() const -> std::vector<std::string> {
+        return ambiguousKeys(byName_);
+    }
+
+    //!\brief true if several siblings have the path of `path`
+    auto isAmbiguousPath(std::string_view path) const -> bool {
+        auto iter = byPath_.find(path);
+        return iter != byPath_.end() && iter->second == nullptr;
+    }
+
+    //!\brief all paths that refer to more than one node
+    auto ambiguousPaths() const -> std::vector<std::string> {
+        return ambiguousKeys(byPath_);
+    }
+
+    //!\brief number of distinct paths
+    auto size() const -> std::size_t {
+        return byPath_.size();
+    }
+
+private:
+    static auto ambiguousKeys(std::unordered_map<std::string_view, NodeType *> const & map)
+        -> std::vector<std::string> {
+        auto keys = std::vector<std::string>{};
+        for (auto const & [key, node] : map) {
+            if (node == nullptr) {
+                keys.emplace_back(key);
+            }
+        }
+        return keys;
+    }
+
+    template <typename Children>
+    void add(Children & children, std::string const & prefix) {
+        for (auto & child : children) {
+            auto const & path = paths_.emplace_back(prefix.empty() ? child.name : prefix + separator + child.name);
+            // a second sibling with the same name marks the path as ambiguous
+            if (auto [iter, inserted] = byPath_.emplace(path, &child); !inserted) {
+                iter->second = nullptr;
+            }
+            if (auto grandChildren = std::get_if<Node::Children>(&child.value)) {
+                add(*grandChildren, path);
+            } else {
+                // a second leaf with the same name marks the name as ambiguous
+                auto [iter, inserted] = byName_.emplace(child.name, &child);
+                if (!inserted) {
+                    iter->second = nullptr;
+                }
+            }
+        }
+    }
+
+    std::vector<std::string>                         paths_{};  //!< Storage of the paths, never reallocates
+    std::unordered_map<std::string_view, NodeType *> byPath_{}; //!< nullptr for ambiguous paths
+    std::unordered_map<std::string_view, NodeType *> byName_{}; //!< nullptr for ambiguous names
+};
+
+using ParamIndex        = BasicParamIndex<Node const>;
+using MutableParamIndex = BasicParamIndex<Node>;
+
+} // namespace tdl
@@ -0,0 +1,107 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <string>
+#include <variant>
+
+#include "FlatToolInfo.h"
+#include "ToolInfo.h"
+
+namespace tdl {
+
+namespace detail {
+
+//!\brief the children of a node of a FlatToolInfo, the parent `npos` refers to the top level parameters
+struct FlatChildren {
+    FlatToolInfo const & doc;
+    FlatToolInfo::Index  parent;
+};
+
+//!\brief calls a visitor with the value of a Node, like `std::visit`
+struct VisitNodeValue {
+    Node const & node;
+
+    template <typename Visitor>
+    void operator()(Visitor && visitor) const {
+        std::visit(visitor, node.value);
+    }
+};
+
+//!\brief calls a visitor with the value of a node of a FlatToolInfo, groups pass `FlatChildren`
+struct VisitFlatValue {
+    FlatToolInfo const & doc;
+    FlatToolInfo::Index  node;
+
+    template <typename Visitor>
+    void operator()(Visitor && visitor) const {
+        auto index = doc.valueIndex[node];
+        switch (doc.valueType[node]) {
+        case FlatToolInfo::ValueType::Bool: return visitor(BoolValue{doc.bools[index]});
+        case FlatToolInfo::ValueType::Int: return visitor(doc.ints[index]);
+        case FlatToolInfo::ValueType::Double: return visitor(doc.doubles[index]);
+        case FlatToolInfo::ValueType::String: return visitor(doc.stringValues[index]);
+        case FlatToolInfo::ValueType::IntList: return visitor(doc.intLists[index]);
+        case FlatToolInfo::ValueType::DoubleList: return visitor(doc.doubleLists[index]);
+        case FlatToolInfo::ValueType::StringList: return visitor(doc.stringLists[index]);
+        case FlatToolInfo::ValueType::Children: break;
+        }
+        visitor(FlatChildren{doc, node});
+    }
+};
+
+/*!\brief a parameter as the exporters see it, either a Node or a node of a FlatToolInfo
+ *
+ * `visitValue(visitor)` calls the visitor with the value. Groups pass `Node::Children` or `FlatChildren`,
+ * both can be traversed with `forEachParam`. This way the exporters work on both representations
+ * without converting one into the other.
+ */
+template <typename VisitValue>
+struct ParamRef {
+    std::string const & name;
+    std::string const & description;
+    Tags const &        tags;
+    VisitValue          visitValue;
+};
+
+inline auto paramRef(Node const & node) -> ParamRef<VisitNodeValue> {
+    return {node.name, node.description, node.tags, {node}};
+}
+
+inline auto paramRef(FlatToolInfo const & doc, FlatToolInfo::Index node) -> ParamRef<VisitFlatValue> {
+    return {doc.nameOf(node), doc.descriptionOf(node), doc.tags[node], {doc, node}};
+}
+
+//!\brief calls `f` with the `ParamRef` of every child, in order
+template <typename F>
+void forEachParam(Node::Children const & children, F && f) {
+    for (auto const & child : children) {
+        f(paramRef(child));
+    }
+}
+
+template <typename F>
+void forEachParam(FlatChildren children, F && f) {
+    auto const & doc  = children.doc;
+    auto         node = children.parent != FlatToolInfo::npos ? doc.firstChild[children.parent]
+                        : doc.size() > 0                      ? FlatToolInfo::Index{0}
+                                                              : FlatToolInfo::npos;
+    for (; node != FlatToolInfo::npos; node = doc.nextSibling[node]) {
+        f(paramRef(doc, node));
+    }
+}
+
+//!\brief the top level parameters of a document, to be passed to `forEachParam`
+inline auto topLevelParams(ToolInfo const & doc) -> Node::Children const & {
+    return doc.params;
+}
+
+inline auto topLevelParams(FlatToolInfo const & doc) -> FlatChildren {
+    return {doc, FlatToolInfo::npos};
+}
+
+} // namespace detail
+
+} // namespace tdl
@@ -0,0 +1,412 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "Snapshot.h"
+
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace tdl {
+
+namespace detail {
+
+//!\brief collects the arrays of a snapshot
+struct SnapshotWriter {
+    using NodeRecord = snapshot::NodeRecord;
+
+    std::vector<snapshot::StringRef>            strings{};
+    std::string                                 chars{};
+    std::vector<NodeRecord>                     nodes{};
+    std::vector<uint32_t>                       ids{};
+    std::vector<int32_t>                        ints{};
+    std::vector<double>                         doubles{};
+    std::unordered_map<std::string_view, uint32_t> stringIds{}; //!< Keys refer to the strings of the ToolInfo
+
+    template <typename T>
+    static auto checkedSize(std::vector<T> const & v) -> uint32_t {
+        if (v.size() >= std::numeric_limits<uint32_t>::max()) {
+            throw std::length_error{"ToolInfo too large for a snapshot"};
+        }
+        return static_cast<uint32_t>(v.size());
+    }
+
+    auto intern(std::string_view str) -> uint32_t {
+        if (auto iter = stringIds.find(str); iter != stringIds.end()) {
+            return iter->second;
+        }
+        if (chars.size() + str.size() >= std::numeric_limits<uint32_t>::max()) {
+            throw std::length_error{"ToolInfo too large for a snapshot"};
+        }
+        auto id = checkedSize(strings);
+        strings.push_back({static_cast<uint32_t>(chars.size()), static_cast<uint32_t>(str.size())});
+        chars.append(str);
+        stringIds.emplace(str, id);
+        return id;
+    }
+
+    //!\brief appends the string ids, returns the position of the first
+    template <typename Strings>
+    auto addStrings(Strings const & strs) -> uint32_t {
+        auto begin = checkedSize(ids);
+        for (auto const & str : strs) {
+            ids.push_back(intern(str));
+        }
+        return begin;
+    }
+
+    //!\brief the array that stores numbers of the given type, the argument is only used for its type
+    auto poolOf(int) -> std::vector<int32_t> & {
+        return ints;
+    }
+    auto poolOf(double) -> std::vector<double> & {
+        return doubles;
+    }
+
+    template <typename T, typename ListType, typename Pool>
+    void addLimits(NodeRecord & record, Pool & pool, TValue<T, ListType> const & value) {
+        if (value.minLimit || value.maxLimit) {
+            record.limits = checkedSize(pool);
+            pool.push_back(value.minLimit.value_or(T{}));
+            pool.push_back(value.maxLimit.value_or(T{}));
+            record.flags |= (value.minLimit ? snapshot::HasMin : 0) | (value.maxLimit ? snapshot::HasMax : 0);
+        }
+    }
+
+    template <typename ListType>
+    void addValidValues(NodeRecord & record, TStringValue<std::string, ListType> const & value) {
+        if (value.validValues) {
+            record.validBegin = addStrings(*value.validValues);
+            record.validCount = static_cast<uint32_t>(value.validValues->size());
+            record.flags |= snapshot::HasValidValues;
+        }
+    }
+
+    void add(Node::Children const & children, uint32_t parent) {
+        auto previous = FlatToolInfo::npos;
+        for (auto const & child : children) {
+            auto index = checkedSize(nodes);
+            auto record       = NodeRecord{};
+            record.parent      = parent;
+            record.firstChild  = FlatToolInfo::npos;
+            record.nextSibling = FlatToolInfo::npos;
+            record.name        = intern(child.name);
+            record.description = intern(child.description);
+            record.tagsBegin   = addStrings(child.tags);
+            record.tagsCount   = static_cast<uint32_t>(child.tags.size());
+            record.valueType   = static_cast<uint8_t>(child.value.index());
+
+            std::visit(
+                [&](auto const & value) {
+                    using V = std::decay_t<decltype(value)>;
+                    if constexpr (std::is_same_v<V, BoolValue>) {
+                        record.valueBegin = value ? 1 : 0;
+                    } else if constexpr (std::is_same_v<V, IntValue> || std::is_same_v<V, DoubleValue>) {
+                        auto & pool       = poolOf(value.value);
+                        record.valueBegin = checkedSize(pool);
+                        record.valueCount = 1;
+                        pool.push_back(value.value);
+                        addLimits(record, pool, value);
+                    } else if constexpr (std::is_same_v<V, IntValueList> || std::is_same_v<V, DoubleValueList>) {
+                        auto & pool       = poolOf(typename decltype(value.value)::value_type{});
+                        record.valueBegin = checkedSize(pool);
+                        record.valueCount = static_cast<uint32_t>(value.value.size());
+                        pool.insert(pool.end(), value.value.begin(), value.value.end());
+                        addLimits(record, pool, value);
+                    } else if constexpr (std::is_same_v<V, StringValue>) {
+                        record.valueBegin = intern(value.value);
+                        record.valueCount = 1;
+                        addValidValues(record, value);
+                    } else if constexpr (std::is_same_v<V, StringValueList>) {
+                        record.valueBegin = addStrings(value.value);
+                        record.valueCount = static_cast<uint32_t>(value.value.size());
+                        addValidValues(record, value);
+                    }
+                },
+                child.value);
+
+            nodes.push_back(record);
+            if (previous != FlatToolInfo::npos) {
+                nodes[previous].nextSibling = index;
+            } else if (parent != FlatToolInfo::npos) {
+                nodes[parent].firstChild = index;
+            }
+            previous = index;
+
+            if (auto grandChildren = std::get_if<Node::Children>(&child.value)) {
+                add(*grandChildren, index);
+            }
+        }
+    }
+};
+
+//!\brief appends the bytes of an array, aligned to 8 bytes
+template <typename T>
+auto appendSection(std::string & out, T const * data, std::size_t count) -> snapshot::Section {
+    out.resize((out.size() + 7) / 8 * 8, '\0');
+    auto section = snapshot::Section{out.size(), count};
+    out.append(reinterpret_cast<char const *>(data), count * sizeof(T));
+    return section;
+}
+
+template <typename T>
+auto sectionView(std::string_view data, snapshot::Section const & section) -> ArrayView<T> {
+    if (section.offset % alignof(T) != 0 || section.offset > data.size()
+        || section.count > (data.size() - section.offset) / sizeof(T)) {
+        throw std::runtime_error{"snapshot is truncated or malformed"};
+    }
+    return {reinterpret_cast<T const *>(data.data() + section.offset), static_cast<std::size_t>(section.count)};
+}
+
+inline void checkRange(uint64_t begin, uint64_t count, std::size_t size) {
+    if (begin > size || count > size - begin) {
+        throw std::runtime_error{"snapshot contains an invalid position"};
+    }
+}
+
+} // namespace detail
+
+SnapshotView::SnapshotView(std::string_view data) {
+    using namespace detail::snapshot;
+
+    if (reinterpret_cast<std::uintptr_t>(data.data()) % 8 != 0) {
+        throw std::runtime_error{"snapshot data has to be aligned to 8 bytes"};
+    }
+    if (data.size() < sizeof(Header) || std::memcmp(data.data(), magic, sizeof(magic)) != 0) {
+        throw std::runtime_error{"not a tdl snapshot"};
+    }
+    header_ = reinterpret_cast<Header const *>(data.data());
+    if (header_->byteOrder != byteOrder) {
+        throw std::runtime_error{"snapshot was written with another byte order"};
+    }
+    if (header_->version != detail::snapshot::version) {
+        throw std::runtime_error{"unsupported snapshot version " + std::to_string(header_->version)};
+    }
+    if (header_->size != data.size()) {
+        throw std::runtime_error{"snapshot is truncated or malformed"};
+    }
+
+    strings_ = detail::sectionView<StringRef>(data, header_->strings);
+    chars_   = detail::sectionView<char>(data, header_->chars);
+    nodes_   = detail::sectionView<NodeRecord>(data, header_->nodes);
+    ids_     = detail::sectionView<uint32_t>(data, header_->ids);
+    ints_    = detail::sectionView<int32_t>(data, header_->ints);
+    doubles_ = detail::sectionView<double>(data, header_->doubles);
+
+    // all positions are checked once, so the accessors do not need to
+    for (auto const & str : strings_) {
+        detail::checkRange(str.offset, str.size, chars_.size());
+    }
+    for (auto id : ids_) {
+        detail::checkRange(id, 1, strings_.size());
+    }
+    for (auto id : header_->meta) {
+        detail::checkRange(id, 1, strings_.size());
+    }
+    detail::checkRange(header_->citations[0], 2 * uint64_t{header_->citations[1]}, ids_.size());
+    detail::checkRange(header_->cliMapping[0], 2 * uint64_t{header_->cliMapping[1]}, ids_.size());
+
+    for (std::size_t i = 0; i < nodes_.size(); ++i) {
+        auto const & record = nodes_[i];
+        // children and siblings follow in pre-order, so the tree can not contain cycles
+        auto checkLink = [&](uint32_t link) {
+            if (link != npos && (link <= i || link >= nodes_.size())) {
+                throw std::runtime_error{"snapshot contains an invalid node link"};
+            }
+        };
+        checkLink(record.firstChild);
+        checkLink(record.nextSibling);
+        if (record.parent != npos && record.parent >= i) {
+            throw std::runtime_error{"snapshot contains an invalid node link"};
+        }
+        detail::checkRange(record.name, 1, strings_.size());
+        detail::checkRange(record.description, 1, strings_.size());
+        detail::checkRange(record.tagsBegin, record.tagsCount, ids_.size());
+
+        auto hasLimits = (record.flags & (HasMin | HasMax)) != 0;
+        switch (static_cast<ValueType>(record.valueType)) {
+        case ValueType::Bool:
+        case ValueType::Children:
+            break;
+        case ValueType::Int:
+        case ValueType::IntList:
+            detail::checkRange(record.valueBegin, record.valueCount, ints_.size());
+            if (hasLimits) {
+                detail::checkRange(record.limits, 2, ints_.size());
+            }
+            break;
+        case ValueType::Double:
+        case ValueType::DoubleList:
+            detail::checkRange(record.valueBegin, record.valueCount, doubles_.size());
+            if (hasLimits) {
+                detail::checkRange(record.limits, 2, doubles_.size());
+            }
+            break;
+        case ValueType::String:
+            detail::checkRange(record.valueBegin, 1, strings_.size());
+            break;
+        case ValueType::StringList:
+            detail::checkRange(record.valueBegin, record.valueCount, ids_.size());
+            break;
+        default:
+            throw std::runtime_error{"snapshot contains an invalid value type"};
+        }
+        if (record.flags & HasValidValues) {
+            detail::checkRange(record.validBegin, record.validCount, ids_.size());
+        }
+        auto scalar = record.valueType == static_cast<uint8_t>(ValueType::Int)
+                      || record.valueType == static_cast<uint8_t>(ValueType::Double);
+        if (scalar && record.valueCount != 1) {
+            throw std::runtime_error{"snapshot contains an invalid value"};
+        }
+    }
+}
+
+auto SnapshotView::findChild(Index parent, std::string_view name) const -> Index {
+    auto index = parent == npos ? (size() > 0 ? Index{0} : npos) : nodes_[parent].firstChild;
+    for (; index != npos; index = nodes_[index].nextSibling) {
+        if (string(nodes_[index].name) == name) {
+            return index;
+        }
+    }
+    return npos;
+}
+
+auto SnapshotView::NodeView::value() const -> Node::Value {
+    auto strings = [](StringList list) {
+        auto v = std::vector<std::string>{};
+        v.reserve(list.size());
+        for (std::size_t i = 0; i < list.size(); ++i) {
+            v.emplace_back(list[i]);
+        }
+        return v;
+    };
+    auto copyValidValues = [&]() -> std::optional<std::vector<std::string>> {
+        if (auto list = validValues()) {
+            return strings(*list);
+        }
+        return std::nullopt;
+    };
+
+    switch (valueType()) {
+    case ValueType::Bool:
+        return BoolValue{boolValue()};
+    case ValueType::Int:
+        return IntValue{intValue(), minLimit<int>(), maxLimit<int>()};
+    case ValueType::Double:
+        return DoubleValue{doubleValue(), minLimit<double>(), maxLimit<double>()};
+    case ValueType::String:
+        return StringValue{std::string{stringValue()}, copyValidValues()};
+    case ValueType::IntList:
+        return IntValueList{{intList().begin(), intList().end()}, minLimit<int>(), maxLimit<int>()};
+    case ValueType::DoubleList:
+        return DoubleValueList{{doubleList().begin(), doubleList().end()}, minLimit<double>(), maxLimit<double>()};
+    case ValueType::StringList:
+        return StringValueList{strings(stringList()), copyValidValues()};
+    case ValueType::Children:
+        break;
+    }
+    return Node::Children{};
+}
+
+namespace detail {
+
+inline auto toChildren(SnapshotView const & snapshot, SnapshotView::Index first) -> Node::Children {
+    auto children = Node::Children{};
+    for (auto index = first; index != SnapshotView::npos; index = snapshot.node(index).nextSibling()) {
+        auto   node       = snapshot.node(index);
+        auto & child      = children.emplace_back();
+        child.name        = node.name();
+        child.description = node.description();
+        auto tags         = node.tags();
+        for (std::size_t i = 0; i < tags.size(); ++i) {
+            child.tags.insert(tags[i]);
+        }
+        if (node.valueType() == SnapshotView::ValueType::Children) {
+            child.value = toChildren(snapshot, node.firstChild());
+        } else {
+            child.value = node.value();
+        }
+    }
+    return children;
+}
+
+} // namespace detail
+
+auto SnapshotView::toToolInfo() const -> ToolInfo {
+    auto doc     = ToolInfo{};
+    auto & meta  = doc.metaInfo;
+    meta.version        = version();
+    meta.name           = toolName();
+    meta.docurl         = docurl();
+    meta.category       = category();
+    meta.description    = description();
+    meta.executableName = executableName();
+    for (uint32_t i = 0; i < header_->citations[1]; ++i) {
+        auto pos = header_->citations[0] + 2 * i;
+        meta.citations.push_back({std::string{string(ids_[pos])}, std::string{string(ids_[pos + 1])}});
+    }
+    for (std::size_t i = 0; i < cliMappingCount(); ++i) {
+        auto [optionIdentifier, referenceName] = cliMapping(i);
+        doc.cliMapping.push_back({std::string{optionIdentifier}, std::string{referenceName}});
+    }
+    if (size() > 0) {
+        doc.params = detail::toChildren(*this, 0);
+    }
+    return doc;
+}
+
+auto writeSnapshot(ToolInfo const & doc) -> std::string {
+    using namespace detail::snapshot;
+
+    auto writer = detail::SnapshotWriter{};
+    writer.add(doc.params, FlatToolInfo::npos);
+
+    auto header = Header{};
+    std::memcpy(header.magic, magic, sizeof(magic));
+    header.version   = version;
+    header.byteOrder = byteOrder;
+
+    auto const & meta = doc.metaInfo;
+    auto         i    = 0;
+    for (auto const * str : {&meta.version, &meta.name, &meta.docurl, &meta.category, &meta.description, &meta.executableName}) {
+        header.meta[i++] = writer.intern(*str);
+    }
+    header.citations[0] = writer.checkedSize(writer.ids);
+    for (auto const & citation : meta.citations) {
+        writer.ids.push_back(writer.intern(citation.doi));
+        writer.ids.push_back(writer.intern(citation.url));
+    }
+    header.citations[1]  = static_cast<uint32_t>(meta.citations.size());
+    header.cliMapping[0] = writer.checkedSize(writer.ids);
+    for (auto const & mapping : doc.cliMapping) {
+        writer.ids.push_back(writer.intern(mapping.optionIdentifier));
+        writer.ids.push_back(writer.intern(mapping.referenceName));
+    }
+    header.cliMapping[1] = static_cast<uint32_t>(doc.cliMapping.size());
+
+    auto out = std::string(sizeof(Header), '\0');
+    header.strings = detail::appendSection(out, writer.strings.data(), writer.strings.size());
+    header.chars   = detail::appendSection(out, writer.chars.data(), writer.chars.size());
+    header.nodes   = detail::appendSection(out, writer.nodes.data(), writer.nodes.size());
+    header.ids     = detail::appendSection(out, writer.ids.data(), writer.ids.size());
+    header.ints    = detail::appendSection(out, writer.ints.data(), writer.ints.size());
+    header.doubles = detail::appendSection(out, writer.doubles.data(), writer.doubles.size());
+    header.size    = out.size();
+    std::memcpy(out.data(), &header, sizeof(header));
+    return out;
+}
+
+void writeSnapshot(ToolInfo const & doc, std::filesystem::path const & path) {
+    auto data = writeSnapshot(doc);
+    auto ofs  = std::ofstream{path, std::ios::binary};
+    ofs.write(data.data(), static_cast<std::streamsize>(data.size()));
+    if (!ofs) {
+        throw std::runtime_error{"can not write snapshot " + path.string()};
+    }
+}
+
+} // namespace tdl
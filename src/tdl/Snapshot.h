@@ -0,0 +1,304 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+
+#include "FlatToolInfo.h"
+#include "ToolInfo.h"
+
+namespace tdl {
+
+/* Snapshot format, version 1
+ *
+ * A snapshot is a single buffer, all positions are relative to its start. The header is followed
+ * by six arrays, each aligned to 8 bytes: the string table (`StringRef`s into the characters),
+ * the characters, the nodes in pre-order (`NodeRecord`), string ids, ints and doubles.
+ * Strings are referenced by their position in the string table, every string is stored once.
+ * Numbers are stored in the byte order of the writing machine, which is recorded in the header.
+ */
+namespace detail::snapshot {
+
+inline constexpr char     magic[8]  = {'T', 'D', 'L', 'S', 'N', 'A', 'P', '\0'};
+inline constexpr uint32_t version   = 1;
+inline constexpr uint32_t byteOrder = 0x01020304;
+
+struct Section {
+    uint64_t offset; //!< Position of the first element
+    uint64_t count;  //!< Number of elements
+};
+
+struct Header {
+    char     magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint64_t size; //!< Size of the whole snapshot in bytes
+    Section  strings, chars, nodes, ids, ints, doubles;
+    uint32_t meta[6];        //!< version, name, docurl, category, description, executableName
+    uint32_t citations[2];   //!< Begin and count of (doi, url) pairs in `ids`
+    uint32_t cliMapping[2];  //!< Begin and count of (optionIdentifier, referenceName) pairs in `ids`
+};
+
+struct StringRef {
+    uint32_t offset; //!< Position in `chars`
+    uint32_t size;
+};
+
+/*!\brief a node of the parameter tree
+ *
+ * Bool: `valueBegin` is the value. Int, Double: `valueBegin` indexes `ints` or `doubles`.
+ * String: `valueBegin` is the string id. Lists: `valueBegin` and `valueCount` are a range of
+ * `ints`, `doubles` or `ids`. The limits are stored at `limits` (min) and `limits + 1` (max)
+ * of the same array.
+ */
+struct NodeRecord {
+    uint32_t parent, firstChild, nextSibling;
+    uint32_t name, description;
+    uint32_t tagsBegin, tagsCount;   //!< String ids of the tags in `ids`
+    uint32_t valueBegin, valueCount;
+    uint32_t validBegin, validCount; //!< String ids of the valid values in `ids`
+    uint32_t limits;
+    uint8_t  valueType;
+    uint8_t  flags;
+    uint16_t reserved;
+};
+
+enum Flags : uint8_t { HasMin = 1, HasMax = 2, HasValidValues = 4 };
+
+static_assert(std::is_trivially_copyable_v<Header> && sizeof(Header) == 160);
+static_assert(std::is_trivially_copyable_v<NodeRecord> && sizeof(NodeRecord) == 52);
+
+} // namespace detail::snapshot
+
+//!\brief a read only array inside a snapshot
+template <typename T>
+class ArrayView {
+public:
+    ArrayView() = default;
+    ArrayView(T const * data, std::size_t size) : data_{data}, size_{size} {}
+
+    auto begin() const -> T const * {
+        return data_;
+    }
+    auto end() const -> T const * {
+        return data_ + size_;
+    }
+    auto size() const -> std::size_t {
+        return size_;
+    }
+    auto empty() const -> bool {
+        return size_ == 0;
+    }
+    auto operator[](std::size_t i) const -> T const & {
+        return data_[i];
+    }
+
+private:
+    T const *   data_{};
+    std::size_t size_{};
+};
+
+/*!\brief Read access to a ToolInfo stored in a snapshot, without deserialization
+ *
+ * The view refers to the bytes of the snapshot, e.g. a `MappedFile`, which have to outlive it.
+ * Nodes are numbered in pre-order like in `FlatToolInfo`, the first top level node has the index 0.
+ */
+class SnapshotView {
+public:
+    using Index     = FlatToolInfo::Index;
+    using ValueType = FlatToolInfo::ValueType;
+
+    static constexpr Index npos = FlatToolInfo::npos;
+
+    //!\brief a list of strings, e.g. the tags of a node
+    class StringList {
+    public:
+        StringList(SnapshotView const & snapshot, ArrayView<uint32_t> ids) : snapshot_{&snapshot}, ids_{ids} {}
+
+        auto size() const -> std::size_t {
+            return ids_.size();
+        }
+        auto operator[](std::size_t i) const -> std::string_view {
+            return snapshot_->string(ids_[i]);
+        }
+
+    private:
+        SnapshotView const * snapshot_;
+        ArrayView<uint32_t>  ids_;
+    };
+
+    class NodeView {
+    public:
+        NodeView(SnapshotView const & snapshot, detail::snapshot::NodeRecord const & record)
+            : snapshot_{&snapshot}, record_{&record} {}
+
+        auto name() const -> std::string_view {
+            return snapshot_->string(record_->name);
+        }
+        auto description() const -> std::string_view {
+            return snapshot_->string(record_->description);
+        }
+        auto parent() const -> Index {
+            return record_->parent;
+        }
+        auto firstChild() const -> Index {
+            return record_->firstChild;
+        }
+        auto nextSibling() const -> Index {
+            return record_->nextSibling;
+        }
+        auto tags() const -> StringList {
+            return snapshot_->stringList(record_->tagsBegin, record_->tagsCount);
+        }
+        auto valueType() const -> ValueType {
+            return static_cast<ValueType>(record_->valueType);
+        }
+
+        //!\name Values, only valid for nodes of the matching value type
+        //!\{
+        auto boolValue() const -> bool {
+            return record_->valueBegin != 0;
+        }
+        auto intValue() const -> int {
+            return snapshot_->ints_[record_->valueBegin];
+        }
+        auto doubleValue() const -> double {
+            return snapshot_->doubles_[record_->valueBegin];
+        }
+        auto stringValue() const -> std::string_view {
+            return snapshot_->string(record_->valueBegin);
+        }
+        auto intList() const -> ArrayView<int32_t> {
+            return {snapshot_->ints_.begin() + record_->valueBegin, record_->valueCount};
+        }
+        auto doubleList() const -> ArrayView<double> {
+            return {snapshot_->doubles_.begin() + record_->valueBegin, record_->valueCount};
+        }
+        auto stringList() const -> StringList {
+            return snapshot_->stringList(record_->valueBegin, record_->valueCount);
+        }
+        //!\}
+
+        //!\brief limits of int and double values and lists
+        template <typename T>
+        auto minLimit() const -> std::optional<T> {
+            return limit<T>(detail::snapshot::HasMin, 0);
+        }
+        template <typename T>
+        auto maxLimit() const -> std::optional<T> {
+            return limit<T>(detail::snapshot::HasMax, 1);
+        }
+
+        //!\brief valid values of string values and lists
+        auto validValues() const -> std::optional<StringList> {
+            if (!(record_->flags & detail::snapshot::HasValidValues)) {
+                return std::nullopt;
+            }
+            return snapshot_->stringList(record_->validBegin, record_->validCount);
+        }
+
+        //!\brief an owning copy of the value, the children of a node are not included
+        auto value() const -> Node::Value;
+
+    private:
+        template <typename T>
+        auto limit(uint8_t flag, uint32_t offset) const -> std::optional<T> {
+            if (!(record_->flags & flag)) {
+                return std::nullopt;
+            }
+            if constexpr (std::is_same_v<T, double>) {
+                return snapshot_->doubles_[record_->limits + offset];
+            } else {
+                return static_cast<T>(snapshot_->ints_[record_->limits + offset]);
+            }
+        }
+
+        SnapshotView const *                 snapshot_;
+        detail::snapshot::NodeRecord const * record_;
+    };
+
+    /*!\brief checks the header and all positions of the snapshot
+     *
+     * The data has to be aligned to 8 bytes. Throws `std::runtime_error` if the snapshot is
+     * malformed, truncated, of another version or written on a machine with another byte order.
+     */
+    explicit SnapshotView(std::string_view data);
+
+    //!\brief number of nodes
+    auto size() const -> std::size_t {
+        return nodes_.size();
+    }
+    auto node(Index index) const -> NodeView {
+        return {*this, nodes_[index]};
+    }
+    //!\brief index of the direct child with the given name, or npos. Use `npos` as parent to search the top level.
+    auto findChild(Index parent, std::string_view name) const -> Index;
+
+    //!\name The meta info, the citations are only available through `toToolInfo`
+    //!\{
+    auto version() const -> std::string_view {
+        return string(header_->meta[0]);
+    }
+    auto toolName() const -> std::string_view {
+        return string(header_->meta[1]);
+    }
+    auto docurl() const -> std::string_view {
+        return string(header_->meta[2]);
+    }
+    auto category() const -> std::string_view {
+        return string(header_->meta[3]);
+    }
+    auto description() const -> std::string_view {
+        return string(header_->meta[4]);
+    }
+    auto executableName() const -> std::string_view {
+        return string(header_->meta[5]);
+    }
+    //!\}
+
+    //!\brief number of cli mappings and their option identifiers and reference names
+    auto cliMappingCount() const -> std::size_t {
+        return header_->cliMapping[1];
+    }
+    auto cliMapping(std::size_t i) const -> std::pair<std::string_view, std::string_view> {
+        return {string(ids_[header_->cliMapping[0] + 2 * i]), string(ids_[header_->cliMapping[0] + 2 * i + 1])};
+    }
+
+    auto string(uint32_t id) const -> std::string_view {
+        return {chars_.begin() + strings_[id].offset, strings_[id].size};
+    }
+
+    //!\brief converts the snapshot into an owning ToolInfo
+    auto toToolInfo() const -> ToolInfo;
+
+private:
+    auto stringList(uint32_t begin, uint32_t count) const -> StringList {
+        return {*this, {ids_.begin() + begin, count}};
+    }
+
+    detail::snapshot::Header const *        header_{};
+    ArrayView<detail::snapshot::StringRef>  strings_{};
+    ArrayView<char>                         chars_{};
+    ArrayView<detail::snapshot::NodeRecord> nodes_{};
+    ArrayView<uint32_t>                     ids_{};
+    ArrayView<int32_t>                      ints_{};
+    ArrayView<double>                       doubles_{};
+};
+
+//!\brief serializes a ToolInfo into a snapshot, see `SnapshotView`
+auto writeSnapshot(ToolInfo const & doc) -> std::string;
+
+//!\brief writes the snapshot of a ToolInfo into a file, throws `std::runtime_error` on failure
+void writeSnapshot(ToolInfo const & doc, std::filesystem::path const & path);
+
+} // namespace tdl
@@ -0,0 +1,260 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <optional>
+#include <set>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace tdl {
+
+/*!\brief Tags with a special meaning to the exporters
+ *
+ * The enumerators are sorted by their names, see `Tags::name`.
+ */
+enum class Tag : uint8_t {
+    advanced,
+    basecommand,
+    default_as_hint,
+    directory,
+    file,
+    input_file,
+    no_default,
+    output,
+    output_file,
+    output_prefix,
+    prefixed,
+    required,
+};
+
+/*!\brief A set of tags
+ *
+ * Well known tags (see `Tag`) are stored as bits, checking for them is a single bit test.
+ * All other tags are stored in a sorted list.
+ * The interface mimics `std::set<std::string>`, iterating yields all tags in sorted order.
+ */
+class Tags {
+public:
+    static constexpr std::size_t knownCount = static_cast<std::size_t>(Tag::required) + 1;
+
+    //!\brief name of a well known tag
+    static auto name(Tag tag) -> std::string const & {
+        static auto const names = std::array<std::string, knownCount>{
+            "advanced",   "basecommand", "default_as_hint", "directory",     "file",     "input file",
+            "no_default", "output",      "output file",     "output prefix", "prefixed", "required",
+        };
+        return names[static_cast<std::size_t>(tag)];
+    }
+
+    //!\brief the well known tag with the given name, if there is one
+    static auto fromName(std::string_view tagName) -> std::optional<Tag> {
+        std::size_t first = 0;
+        std::size_t last  = knownCount;
+        while (first < last) {
+            auto mid = first + (last - first) / 2;
+            auto cmp = tagName.compare(name(static_cast<Tag>(mid)));
+            if (cmp == 0) {
+                return static_cast<Tag>(mid);
+            }
+            if (cmp < 0) {
+                last = mid;
+            } else {
+                first = mid + 1;
+            }
+        }
+        return std::nullopt;
+    }
+
+    //!\brief iterates over all tags in sorted order
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type        = std::string;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = std::string const *;
+        using reference         = std::string const &;
+
+        const_iterator() = default;
+        const_iterator(Tags const * tags, std::size_t known, std::size_t custom)
+            : tags_{tags}
+            , known_{tags->nextKnown(known)}
+            , custom_{custom} {}
+
+        auto operator*() const -> reference {
+            return knownIsNext() ? name(static_cast<Tag>(known_)) : tags_->custom_[custom_];
+        }
+        auto operator->() const -> pointer {
+            return &**this;
+        }
+        auto operator++() -> const_iterator & {
+            if (knownIsNext()) {
+                known_ = tags_->nextKnown(known_ + 1);
+            } else {
+                ++custom_;
+            }
+            return *this;
+        }
+        auto operator++(int) -> const_iterator {
+            auto r = *this;
+            ++*this;
+            return r;
+        }
+        friend bool operator==(const_iterator const & lhs, const_iterator const & rhs) {
+            return lhs.known_ == rhs.known_ && lhs.custom_ == rhs.custom_;
+        }
+        friend bool operator!=(const_iterator const & lhs, const_iterator const & rhs) {
+            return !(lhs == rhs);
+        }
+
+    private:
+        auto knownIsNext() const -> bool {
+            if (known_ == knownCount) {
+                return false;
+            }
+            return custom_ == tags_->custom_.size() || name(static_cast<Tag>(known_)) < tags_->custom_[custom_];
+        }
+
+        Tags const * tags_{};
+        std::size_t  known_{knownCount};
+        std::size_t  custom_{};
+    };
+    using iterator   = const_iterator;
+    using value_type = std::string;
+    using size_type  = std::size_t;
+
+    Tags() = default;
+    Tags(std::initializer_list<std::string_view> tags) {
+        for (auto tag : tags) {
+            insert(tag);
+        }
+    }
+    Tags(std::set<std::string> const & tags) {
+        for (auto const & tag : tags) {
+            insert(tag);
+        }
+    }
+
+    //!\brief converts into a `std::set<std::string>`
+    auto toSet() const -> std::set<std::string> {
+        return {begin(), end()};
+    }
+    operator std::set<std::string>() const {
+        return toSet();
+    }
+
+    auto contains(Tag tag) const -> bool {
+        return known_ & bit(tag);
+    }
+    auto contains(std::string_view tag) const -> bool {
+        if (auto t = fromName(tag)) {
+            return contains(*t);
+        }
+        return std::binary_search(custom_.begin(), custom_.end(), tag);
+    }
+    auto count(Tag tag) const -> size_type {
+        return contains(tag) ? 1 : 0;
+    }
+    auto count(std::string_view tag) const -> size_type {
+        return contains(tag) ? 1 : 0;
+    }
+
+    //!\brief adds a tag, returns false if it was already present
+    auto insert(Tag tag) -> bool {
+        auto inserted = !contains(tag);
+        known_ |= bit(tag);
+        return inserted;
+    }
+    auto insert(std::string_view tag) -> bool {
+        if (auto t = fromName(tag)) {
+            return insert(*t);
+        }
+        auto iter = std::lower_bound(custom_.begin(), custom_.end(), tag);
+        if (iter != custom_.end() && *iter == tag) {
+            return false;
+        }
+        custom_.emplace(iter, tag);
+        return true;
+    }
+
+    //!\brief removes a tag, returns the number of removed tags
+    auto erase(Tag tag) -> size_type {
+        auto erased = count(tag);
+        known_ &= ~bit(tag);
+        return erased;
+    }
+    auto erase(std::string_view tag) -> size_type {
+        if (auto t = fromName(tag)) {
+            return erase(*t);
+        }
+        auto iter = std::lower_bound(custom_.begin(), custom_.end(), tag);
+        if (iter == custom_.end() || *iter != tag) {
+            return 0;
+        }
+        custom_.erase(iter);
+        return 1;
+    }
+
+    auto empty() const -> bool {
+        return known_ == 0 && custom_.empty();
+    }
+    auto size() const -> size_type {
+        auto known = size_type{};
+        for (auto bits = known_; bits; bits &= bits - 1) {
+            ++known;
+        }
+        return known + custom_.size();
+    }
+    void clear() {
+        known_ = 0;
+        custom_.clear();
+    }
+
+    auto begin() const -> const_iterator {
+        return {this, 0, 0};
+    }
+    auto end() const -> const_iterator {
+        return {this, knownCount, custom_.size()};
+    }
+
+    friend bool operator==(Tags const & lhs, Tags const & rhs) {
+        return lhs.known_ == rhs.known_ && lhs.custom_ == rhs.custom_;
+    }
+    friend bool operator!=(Tags const & lhs, Tags const & rhs) {
+        return !(lhs == rhs);
+    }
+
+private:
+    static constexpr auto bit(Tag tag) -> uint16_t {
+        return static_cast<uint16_t>(1u << static_cast<unsigned>(tag));
+    }
+
+    //!\brief index of the first well known tag at or after `index` that is present
+    auto nextKnown(std::size_t index) const -> std::size_t {
+        while (index < knownCount && !(known_ & (1u << index))) {
+            ++index;
+        }
+        return index;
+    }
+
+    uint16_t                 known_{};  //!< One bit per well known tag
+    std::vector<std::string> custom_{}; //!< All other tags, sorted
+};
+
+inline auto begin(Tags const & tags) {
+    return tags.begin();
+}
+inline auto end(Tags const & tags) {
+    return tags.end();
+}
+
+} // namespace tdl
@@ -5,14 +5,19 @@
 #pragma once
 
 #include <algorithm>
+#include <cctype>
+#include <cstddef>
 #include <numeric>
 #include <optional>
 #include <set>
 #include <string>
+#include <string_view>
 #include <tuple>
 #include <variant>
 #include <vector>
 
+#include "Tags.h"
+
 namespace tdl {
 
 namespace detail {
@@ -55,21 +60,102 @@ struct TValue {
             if (maxLimit && *maxLimit < value) {
                 return State::ValueTooHigh;
             }
+            return State::Ok;
         };
 
-        if constexpr (is_vector_v<T>) {
+        if constexpr (is_vector_v<ListType>) {
             for (auto const & element : value) {
-                check_value(element);
+                if (auto s = check_value(element); s != State::Ok) {
+                    return s;
+                }
             }
+            return State::Ok;
         } else {
-            check_value(value);
+            return check_value(value);
         }
-
-        return State::Ok;
     }
 };
 
+//!\brief true if `value` matches `pattern`, a '*' matches any sequence, letters are compared case insensitively
+inline auto matchesFormat(std::string_view value, std::string_view pattern) -> bool {
+    auto lower = [](char c) {
+        return static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+    };
+    // backtracks to the last '*' only, which is enough for patterns like "*.fa.gz"
+    auto v      = std::size_t{};
+    auto p      = std::size_t{};
+    auto star   = std::string_view::npos;
+    auto resume = std::size_t{};
+    while (v < value.size()) {
+        if (p < pattern.size() && pattern[p] == '*') {
+            star   = p++;
+            resume = v;
+        } else if (p < pattern.size() && lower(pattern[p]) == lower(value[v])) {
+            ++p;
+            ++v;
+        } else if (star != std::string_view::npos) {
+            p = star + 1;
+            v = ++resume;
+        } else {
+            return false;
+        }
+    }
+    while (p < pattern.size() && pattern[p] == '*') {
+        ++p;
+    }
+    return p == pattern.size();
+}
+
+//!\brief true if every entry contains a '*', like the supported_formats "*.mzML" of CTD file parameters
+inline auto isFormatList(std::vector<std::string> const & validValues) -> bool {
+    return !validValues.empty() && std::all_of(validValues.begin(), validValues.end(), [](std::string const & v) {
+        return v.find('*') != std::string::npos;
+    });
+}
+
+//!\brief true if `value` matches one of the `formats`, the empty value (a file that is not set) is accepted
+inline auto isValidFile(std::string_view value, std::vector<std::string> const & formats) -> bool {
+    return value.empty() || std::any_of(formats.begin(), formats.end(), [&](std::string const & pattern) {
+               return matchesFormat(value, pattern);
+           });
+}
+
+/*!\brief true if `value` is one of `validValues`
+ *
+ * A list of file formats (see `isFormatList`) is matched with `isValidFile` instead.
+ */
+inline auto isValidString(std::string_view value, std::vector<std::string> const & validValues) -> bool {
+    if (isFormatList(validValues)) {
+        return isValidFile(value, validValues);
+    }
+    return std::find(validValues.begin(), validValues.end(), value) != validValues.end();
+}
+
+//!\brief true if the valid values of a node with these tags are the supported formats of a file
+inline auto hasFileFormats(Tags const & tags) -> bool {
+    return tags.contains(Tag::input_file) || tags.contains(Tag::output_file) || tags.contains(Tag::output_prefix);
+}
+
+/*!\brief like `isValidString`, but the tags of the node decide whether the valid values are file formats
+ *
+ * Values of input and output files are matched against the formats, the empty value is accepted.
+ * An output prefix is not a file name, the formats describe the files written with it, so it is not checked.
+ */
+inline auto isValidString(std::string_view value, std::vector<std::string> const & validValues, Tags const & tags)
+    -> bool {
+    if (tags.contains(Tag::output_prefix)) {
+        return true;
+    }
+    if (hasFileFormats(tags)) {
+        return isValidFile(value, validValues);
+    }
+    return isValidString(value, validValues);
+}
+
 /*!\brief Stores a string with optional list of valid strings.
+ *
+ * `state()` does not know the tags of the node, it recognizes lists of file formats by their '*',
+ * see `isValidString`.
  */
 template <typename T, typename ListType = T>
 struct TStringValue {
@@ -87,24 +173,19 @@ struct TStringValue {
         }
 
         auto checkSingleValue = [this](T const & value) {
-            bool const is_valid = std::any_of(begin(*validValues), end(*validValues), [&](auto const & pattern) {
-                return value == pattern;
-            });
-
-            if (!is_valid) {
-                return State::Invalid;
-            }
+            return isValidString(value, *validValues) ? State::Valid : State::Invalid;
         };
 
-        if constexpr (is_vector_v<T>) {
+        if constexpr (is_vector_v<ListType>) {
             for (auto const & element : value) {
-                checkSingleValue(element);
+                if (checkSingleValue(element) == State::Invalid) {
+                    return State::Invalid;
+                }
             }
+            return State::Valid;
         } else {
-            checkSingleValue(value);
+            return checkSingleValue(value);
         }
-
-        return State::Valid;
     }
 };
 
@@ -134,10 +215,10 @@ struct Node {
                                StringValueList,
                                Children>; // not a value, but a node with children
 
-    std::string           name{};            //!< Name of the entry.
-    std::string           description{};     //!< Entry description.
-    std::set<std::string> tags{};            //!< List of tags, e.g.: advanced parameter tag.
-    Value                 value{Children{}}; //!< Current value of this entry
+    std::string name{};            //!< Name of the entry.
+    std::string description{};     //!< Entry description.
+    Tags        tags{};            //!< List of tags, e.g.: advanced parameter tag.
+    Value       value{Children{}}; //!< Current value of this entry
 };
 
 //! A pair of mapping from tree parameter names to cli names
@@ -170,4 +251,17 @@ struct ToolInfo {
     std::vector<CLIMapping> cliMapping{};
 };
 
+namespace detail {
+//!\brief counts the nodes of a tree, groups included
+inline auto countNodes(Node::Children const & children) -> std::size_t {
+    auto count = children.size();
+    for (auto const & child : children) {
+        if (auto grandChildren = std::get_if<Node::Children>(&child.value)) {
+            count += countNodes(*grandChildren);
+        }
+    }
+    return count;
+}
+} // namespace detail
+
 } // namespace tdl
@@ -0,0 +1,244 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "Tracer.h"
+
+#include <array>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+namespace tdl {
+
+namespace detail {
+
+//!\brief a recorded span, the detail is stored inline so recording does not allocate
+struct TraceEvent {
+    std::string_view                      category{}; //!< a string literal
+    std::string_view                      name{};     //!< a string literal
+    std::array<char, traceDetailCapacity> detail{};
+    std::size_t                           detailSize{};
+    int64_t                               start{};
+    int64_t                               duration{};
+};
+
+/*!\brief the spans of one thread, written by that thread only
+ *
+ * Events are stored in chunks that never move. The writer fills an event and then publishes it by
+ * increasing `size` of its chunk, readers only look at published events. So a trace can be
+ * collected while the thread keeps recording.
+ */
+struct TraceBuffer {
+    static constexpr std::size_t chunkSize = 256;
+
+    struct Chunk {
+        std::array<TraceEvent, chunkSize> events{};
+        std::atomic<std::size_t>          size{0};
+        std::atomic<Chunk *>              next{nullptr};
+        std::unique_ptr<Chunk>            nextOwner{};
+    };
+
+    explicit TraceBuffer(uint32_t threadId) : threadId{threadId} {}
+
+    void append(std::string_view category,
+                std::string_view name,
+                std::string_view detail,
+                int64_t          start,
+                int64_t          end) {
+        auto size = tail->size.load(std::memory_order_relaxed);
+        if (size == chunkSize) {
+            tail->nextOwner = std::make_unique<Chunk>();
+            tail->next.store(tail->nextOwner.get(), std::memory_order_release);
+            tail = tail->nextOwner.get();
+            size = 0;
+        }
+        auto & event     = tail->events[size];
+        event.category   = category;
+        event.name       = name;
+        event.detailSize = truncatedSize(detail);
+        event.start      = start;
+        event.duration   = end - start;
+        detail.copy(event.detail.data(), event.detailSize);
+        tail->size.store(size + 1, std::memory_order_release);
+    }
+
+    //!\brief the size of `detail` cut to `traceDetailCapacity`, without splitting a UTF-8 sequence
+    static auto truncatedSize(std::string_view detail) -> std::size_t {
+        if (detail.size() <= traceDetailCapacity) {
+            return detail.size();
+        }
+        auto size = traceDetailCapacity;
+        while (size > 0 && (static_cast<unsigned char>(detail[size]) & 0xc0) == 0x80) {
+            --size;
+        }
+        return size;
+    }
+
+    template <typename F>
+    void forEach(F && f) const {
+        for (auto chunk = head.get(); chunk; chunk = chunk->next.load(std::memory_order_acquire)) {
+            auto size = chunk->size.load(std::memory_order_acquire);
+            for (std::size_t i = 0; i < size; ++i) {
+                f(chunk->events[i]);
+            }
+        }
+    }
+
+    uint32_t               threadId;
+    std::unique_ptr<Chunk> head{std::make_unique<Chunk>()};
+    Chunk *                tail{head.get()};
+};
+
+/*!\brief the buffers of all threads
+ *
+ * Clearing starts a new generation. Threads notice it on their next span and register a new
+ * buffer, the old ones are freed when neither the registry nor their thread refers to them.
+ */
+struct TraceRegistry {
+    std::mutex                                mutex{};
+    std::vector<std::shared_ptr<TraceBuffer>> buffers{};
+    std::atomic<uint64_t>                     generation{1};
+    std::atomic<uint32_t>                     nextThreadId{1};
+    std::chrono::steady_clock::time_point     epoch{std::chrono::steady_clock::now()};
+};
+
+inline auto traceRegistry() -> TraceRegistry & {
+    static auto registry = TraceRegistry{};
+    return registry;
+}
+
+inline auto threadBuffer() -> TraceBuffer & {
+    thread_local auto threadId   = traceRegistry().nextThreadId.fetch_add(1, std::memory_order_relaxed);
+    thread_local auto buffer     = std::shared_ptr<TraceBuffer>{};
+    thread_local auto generation = uint64_t{0};
+
+    auto & registry = traceRegistry();
+    if (auto current = registry.generation.load(std::memory_order_acquire); current != generation) {
+        buffer     = std::make_shared<TraceBuffer>(threadId);
+        generation = current;
+        auto lock  = std::lock_guard{registry.mutex};
+        registry.buffers.push_back(buffer);
+    }
+    return *buffer;
+}
+
+inline void appendJSONString(std::string & out, std::string_view str) {
+    constexpr char hexDigits[] = "0123456789abcdef";
+    out += '"';
+    for (auto c : str) {
+        switch (c) {
+        case '"':
+            out += "\\\"";
+            break;
+        case '\\':
+            out += "\\\\";
+            break;
+        case '\n':
+            out += "\\n";
+            break;
+        case '\t':
+            out += "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                out += "\\u00";
+                out += hexDigits[c >> 4];
+                out += hexDigits[c & 0xf];
+            } else {
+                out += c;
+            }
+        }
+    }
+    out += '"';
+}
+
+//!\brief microseconds with nanosecond precision, the unit of trace_event timestamps
+inline void appendMicroseconds(std::string & out, int64_t nanoseconds) {
+    auto fraction = std::to_string(nanoseconds % 1000);
+    out += std::to_string(nanoseconds / 1000);
+    out += '.';
+    out.append(3 - fraction.size(), '0');
+    out += fraction;
+}
+
+auto traceClock() -> int64_t {
+    auto elapsed = std::chrono::steady_clock::now() - traceRegistry().epoch;
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+}
+
+void recordSpan(std::string_view category, std::string_view name, std::string_view detail, int64_t start, int64_t end) {
+    threadBuffer().append(category, name, detail, start, end);
+}
+
+} // namespace detail
+
+void startTracing() {
+    detail::traceRegistry(); // the epoch is set on first use
+    detail::tracingEnabled.store(true, std::memory_order_relaxed);
+}
+
+void stopTracing() {
+    detail::tracingEnabled.store(false, std::memory_order_relaxed);
+}
+
+void clearTrace() {
+    auto & registry = detail::traceRegistry();
+    auto   lock     = std::lock_guard{registry.mutex};
+    registry.generation.fetch_add(1, std::memory_order_release);
+    registry.buffers.clear();
+}
+
+auto traceToJSON() -> std::string {
+    auto buffers = [&]() {
+        auto & registry = detail::traceRegistry();
+        auto   lock     = std::lock_guard{registry.mutex};
+        return registry.buffers;
+    }();
+
+    auto out      = std::string{"{\"displayTimeUnit\":\"ms\",\"traceEvents\":["};
+    auto first    = true;
+    auto separate = [&]() {
+        out += first ? "\n" : ",\n";
+        first = false;
+    };
+    for (auto const & buffer : buffers) {
+        auto tid = std::to_string(buffer->threadId);
+        separate();
+        out += "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" + tid + ",\"args\":{\"name\":\"thread " + tid
+             + "\"}}";
+        buffer->forEach([&](detail::TraceEvent const & event) {
+            separate();
+            out += "{\"name\":";
+            detail::appendJSONString(out, event.name);
+            out += ",\"cat\":";
+            detail::appendJSONString(out, event.category);
+            out += ",\"ph\":\"X\",\"ts\":";
+            detail::appendMicroseconds(out, event.start);
+            out += ",\"dur\":";
+            detail::appendMicroseconds(out, event.duration);
+            out += ",\"pid\":1,\"tid\":" + tid;
+            if (event.detailSize > 0) {
+                out += ",\"args\":{\"detail\":";
+                detail::appendJSONString(out, {event.detail.data(), event.detailSize});
+                out += '}';
+            }
+            out += '}';
+        });
+    }
+    out += "\n]}\n";
+    return out;
+}
+
+void writeTrace(std::filesystem::path const & path) {
+    auto json = traceToJSON();
+    auto ofs  = std::ofstream{path, std::ios::binary};
+    ofs.write(json.data(), static_cast<std::streamsize>(json.size()));
+    if (!ofs) {
+        throw std::runtime_error{"can not write trace " + path.string()};
+    }
+}
+
+} // namespace tdl
@@ -0,0 +1,95 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+namespace tdl {
+
+/*!\brief Tracing of exports and CWL loading in the Chrome trace event format
+ *
+ * While tracing is enabled, `convertToCTD`, `convertToCWL` and `w3id_org::cwl::load_document` record
+ * spans per tool, per export phase and per group of parameters. `traceToJSON` returns them as
+ * trace_event JSON, which can be opened in chrome://tracing or https://ui.perfetto.dev.
+ *
+ * Each thread records into its own buffer without locking. The buffers are only locked when a
+ * thread records its first span and when the trace is collected or cleared.
+ * Disabled tracing costs one relaxed atomic load per span. Enabled tracing does not allocate per span,
+ * only when a thread starts a new chunk of its buffer.
+ */
+void startTracing();
+
+//!\brief stops recording, the recorded spans are kept
+void stopTracing();
+
+//!\brief drops all recorded spans, spans recorded concurrently to the call may be lost
+void clearTrace();
+
+//!\brief all recorded spans as trace_event JSON, can be called while other threads are recording
+auto traceToJSON() -> std::string;
+
+//!\brief writes `traceToJSON` into a file, throws `std::runtime_error` on failure
+void writeTrace(std::filesystem::path const & path);
+
+namespace detail {
+
+inline std::atomic<bool> tracingEnabled{false};
+
+inline auto isTracing() -> bool {
+    return tracingEnabled.load(std::memory_order_relaxed);
+}
+
+//!\brief the number of bytes of the detail of a span that are kept
+inline constexpr std::size_t traceDetailCapacity = 64;
+
+//!\brief nanoseconds since the first use of the tracer
+auto traceClock() -> int64_t;
+
+/*!\brief appends a span to the buffer of the current thread
+ *
+ * `category` and `name` are only referenced, they have to be string literals. `detail` is copied
+ * and truncated to `traceDetailCapacity` bytes.
+ */
+void recordSpan(std::string_view category, std::string_view name, std::string_view detail, int64_t start, int64_t end);
+
+/*!\brief records its scope as a span, if tracing was enabled when it was created
+ *
+ * `category` and `name` have to be string literals, see `recordSpan`. `detail` has to outlive the span.
+ */
+class TraceSpan {
+public:
+    TraceSpan(std::string_view category, std::string_view name, std::string_view detail = {}) {
+        if (isTracing()) {
+            category_ = category;
+            name_     = name;
+            detail_   = detail;
+            start_    = traceClock();
+        }
+    }
+    TraceSpan(TraceSpan const &)                     = delete;
+    auto operator=(TraceSpan const &) -> TraceSpan & = delete;
+
+    ~TraceSpan() {
+        if (start_ >= 0) {
+            recordSpan(category_, name_, detail_, start_, traceClock());
+        }
+    }
+
+private:
+    std::string_view category_{};
+    std::string_view name_{};
+    std::string_view detail_{};
+    int64_t          start_{-1}; //!< -1 if not recording
+};
+
+} // namespace detail
+
+} // namespace tdl
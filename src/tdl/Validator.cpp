@@ -0,0 +1,191 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "Validator.h"
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace tdl {
+
+namespace detail {
+
+/*!\brief number of elements outside of [lo, hi]
+ *
+ * Written without branches, so the compiler can vectorize the loop. A min/max reduction
+ * would not be vectorized for floating point values without -ffast-math, and neither would
+ * counting doubles with an integer, so they are counted with a double.
+ */
+template <typename T>
+auto countOutside(std::vector<T> const & values, T lo, T hi) -> std::size_t {
+    using Counter = std::conditional_t<std::is_floating_point_v<T>, T, std::size_t>;
+    auto count    = Counter{};
+    for (auto v : values) {
+        count += (v < lo || hi < v) ? Counter{1} : Counter{0};
+    }
+    return static_cast<std::size_t>(count);
+}
+
+//!\brief a value that is smaller or equal to every other value
+template <typename T>
+constexpr auto lowestValue() -> T {
+    if constexpr (std::numeric_limits<T>::has_infinity) {
+        return -std::numeric_limits<T>::infinity();
+    } else {
+        return std::numeric_limits<T>::lowest();
+    }
+}
+
+//!\brief a value that is larger or equal to every other value
+template <typename T>
+constexpr auto highestValue() -> T {
+    if constexpr (std::numeric_limits<T>::has_infinity) {
+        return std::numeric_limits<T>::infinity();
+    } else {
+        return std::numeric_limits<T>::max();
+    }
+}
+
+//!\brief adds an error for all elements for which `isOffending` is true
+template <typename T, typename Predicate>
+void addListError(std::vector<ValidationError> & errors,
+                  std::string const &            path,
+                  ValidationError::Kind          kind,
+                  std::vector<T> const &         values,
+                  Predicate                      isOffending) {
+    auto first = values.size();
+    auto count = std::size_t{};
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        if (isOffending(values[i])) {
+            first = std::min(first, i);
+            ++count;
+        }
+    }
+    if (count > 0) {
+        errors.push_back({path, kind, first, count});
+    }
+}
+
+template <typename T>
+void checkLimits(std::vector<ValidationError> & errors, std::string const & path, TValue<T> const & value) {
+    if (value.minLimit && *value.minLimit > value.value) {
+        errors.push_back({path, ValidationError::Kind::ValueTooLow, 0, 1});
+    }
+    if (value.maxLimit && *value.maxLimit < value.value) {
+        errors.push_back({path, ValidationError::Kind::ValueTooHigh, 0, 1});
+    }
+}
+
+template <typename T>
+void checkLimits(std::vector<ValidationError> &    errors,
+                 std::string const &               path,
+                 TValue<T, std::vector<T>> const & value) {
+    if (!value.minLimit && !value.maxLimit) {
+        return;
+    }
+    // only lists with offending elements are scanned a second time, to locate them
+    auto lo = value.minLimit.value_or(lowestValue<T>());
+    auto hi = value.maxLimit.value_or(highestValue<T>());
+    if (countOutside(value.value, lo, hi) == 0) {
+        return;
+    }
+    addListError(errors, path, ValidationError::Kind::ValueTooLow, value.value, [&](T v) {
+        return v < lo;
+    });
+    addListError(errors, path, ValidationError::Kind::ValueTooHigh, value.value, [&](T v) {
+        return hi < v;
+    });
+}
+
+} // namespace detail
+
+Validator::Validator(ToolInfo const & doc) {
+    add(doc.params, "");
+}
+
+void Validator::add(Node::Children const & children, std::string const & prefix) {
+    for (auto const & child : children) {
+        auto path = prefix.empty() ? child.name : prefix + ':' + child.name;
+
+        auto const * validValues = std::visit(
+            [](auto const & value) -> std::vector<std::string> const * {
+                using V = std::decay_t<decltype(value)>;
+                if constexpr (std::is_same_v<V, StringValue> || std::is_same_v<V, StringValueList>) {
+                    return value.validValues ? &*value.validValues : nullptr;
+                } else {
+                    return nullptr;
+                }
+            },
+            child.value);
+
+        // file formats are patterns, they are matched by detail::isValidString instead of a hash set
+        auto formats = validValues && (detail::hasFileFormats(child.tags) || detail::isFormatList(*validValues));
+        auto validValuesIndex = npos;
+        if (validValues && !formats) {
+            validValuesIndex = validValues_.size();
+            validValues_.emplace_back(validValues->begin(), validValues->end());
+        }
+
+        entries_.push_back({path, &child, validValuesIndex, formats});
+
+        if (auto grandChildren = std::get_if<Node::Children>(&child.value)) {
+            add(*grandChildren, path);
+        }
+    }
+}
+
+auto Validator::validate() const -> std::vector<ValidationError> {
+    auto errors = std::vector<ValidationError>{};
+    for (auto const & [path, node, validValuesIndex, formats] : entries_) {
+        auto const * validValues = validValuesIndex != npos ? &validValues_[validValuesIndex] : nullptr;
+
+        auto isValid = [&, node = node, formats = formats](auto const & value, std::string const & v) {
+            if (formats) {
+                return detail::isValidString(v, *value.validValues, node->tags);
+            }
+            return !validValues || validValues->count(v) > 0;
+        };
+
+        auto checkNumbers = [&, &path = path](auto const & value) {
+            if (value.minLimit && value.maxLimit && *value.minLimit > *value.maxLimit) {
+                errors.push_back({path, ValidationError::Kind::LimitsInvalid, 0, 1});
+                return;
+            }
+            detail::checkLimits(errors, path, value);
+        };
+
+        std::visit(
+            [&, &path = path](auto const & value) {
+                using V = std::decay_t<decltype(value)>;
+                if constexpr (std::is_same_v<V, IntValue> || std::is_same_v<V, DoubleValue>
+                              || std::is_same_v<V, IntValueList> || std::is_same_v<V, DoubleValueList>) {
+                    checkNumbers(value);
+                } else if constexpr (std::is_same_v<V, StringValue>) {
+                    if (!isValid(value, value.value)) {
+                        errors.push_back({path, ValidationError::Kind::InvalidValue, 0, 1});
+                    }
+                } else if constexpr (std::is_same_v<V, StringValueList>) {
+                    if (validValues || formats) {
+                        detail::addListError(errors,
+                                             path,
+                                             ValidationError::Kind::InvalidValue,
+                                             value.value,
+                                             [&](std::string const & v) {
+                                                 return !isValid(value, v);
+                                             });
+                    }
+                }
+            },
+            node->value);
+    }
+    return errors;
+}
+
+auto validate(ToolInfo const & doc) -> std::vector<ValidationError> {
+    return Validator{doc}.validate();
+}
+
+} // namespace tdl
@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include "ToolInfo.h"
+
+namespace tdl {
+
+//!\brief A value that violates the limits or the valid values of its node
+struct ValidationError {
+    enum class Kind {
+        LimitsInvalid, //!< minLimit is larger than maxLimit
+        ValueTooLow,
+        ValueTooHigh,
+        InvalidValue //!< the value is not part of validValues, or does not match the formats of a file
+    };
+
+    std::string path{};  //!< Path of the node, names separated by ':'
+    Kind        kind{};
+    std::size_t index{}; //!< Position of the first offending element, 0 for single values
+    std::size_t count{}; //!< Number of offending elements, 1 for single values
+
+    friend bool operator==(ValidationError const & lhs, ValidationError const & rhs) {
+        return lhs.path == rhs.path && lhs.kind == rhs.kind && lhs.index == rhs.index && lhs.count == rhs.count;
+    }
+};
+
+/*!\brief Checks all values of a ToolInfo against their limits and valid values
+ *
+ * The hash sets of the valid values are built once on construction, so validating
+ * again after changing values is cheap. Like `ParamIndex`, the validator refers to the
+ * nodes of the tree and stays valid as long as the tree is not restructured and the limits
+ * and valid values do not change.
+ *
+ * The valid values of input files, output files and output prefixes are their supported formats,
+ * e.g. "*.mzML". File names are matched against them, and an empty file name is accepted.
+ * Output prefixes are not checked.
+ */
+class Validator {
+public:
+    explicit Validator(ToolInfo const & doc);
+    Validator(ToolInfo &&) = delete; //!< The validator refers to the nodes, the ToolInfo has to outlive it
+
+    //!\brief checks all nodes, the errors are in pre-order of the nodes
+    auto validate() const -> std::vector<ValidationError>;
+
+private:
+    struct Entry {
+        std::string  path;
+        Node const * node;
+        std::size_t  validValues; //!< Index into validValues_, or npos
+        bool         formats;     //!< The valid values are file formats, see `detail::isValidString`
+    };
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    void add(Node::Children const & children, std::string const & prefix);
+
+    std::vector<Entry>                                entries_{};
+    std::vector<std::unordered_set<std::string_view>> validValues_{};
+};
+
+//!\brief checks all values of a ToolInfo, see `Validator`
+auto validate(ToolInfo const & doc) -> std::vector<ValidationError>;
+
+} // namespace tdl
@@ -0,0 +1,250 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "XMLScanner.h"
+
+#include <algorithm>
+#include <charconv>
+#include <stdexcept>
+
+namespace tdl {
+
+namespace detail {
+
+inline auto isSpace(char c) -> bool {
+    return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+inline auto isNameEnd(char c) -> bool {
+    return isSpace(c) || c == '/' || c == '>' || c == '=';
+}
+
+//!\brief appends the utf-8 encoding of a code point
+inline void appendUtf8(std::string & out, unsigned int cp) {
+    if (cp < 0x80) {
+        out.push_back(static_cast<char>(cp));
+    } else if (cp < 0x800) {
+        out.push_back(static_cast<char>(0xc0 | (cp >> 6)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3f)));
+    } else if (cp < 0x10000) {
+        out.push_back(static_cast<char>(0xe0 | (cp >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3f)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3f)));
+    } else {
+        out.push_back(static_cast<char>(0xf0 | (cp >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 12) & 0x3f)));
+        out.push_back(static_cast<char>(0x80 | ((cp >> 6) & 0x3f)));
+        out.push_back(static_cast<char>(0x80 | (cp & 0x3f)));
+    }
+}
+
+auto XMLScanner::next() -> Token {
+    if (pendingEnd_) {
+        pendingEnd_ = false;
+        attributes_.clear();
+        return Token::EndTag;
+    }
+
+    while (true) {
+        auto open = document_.find('<', pos_);
+        if (open == std::string_view::npos) {
+            pos_ = document_.size();
+            return Token::End;
+        }
+        pos_      = open;
+        auto rest = document_.substr(pos_);
+
+        if (rest.substr(0, 4) == "<!--") {
+            skipPast("-->");
+        } else if (rest.substr(0, 9) == "<![CDATA[") {
+            skipPast("]]>");
+        } else if (rest.substr(0, 2) == "<?") {
+            skipPast("?>");
+        } else if (rest.substr(0, 2) == "<!") {
+            skipPast(">");
+        } else if (rest.substr(0, 2) == "</") {
+            auto close = document_.find('>', pos_);
+            if (close == std::string_view::npos) {
+                fail("unterminated end tag");
+            }
+            name_ = document_.substr(pos_ + 2, close - pos_ - 2);
+            while (!name_.empty() && isSpace(name_.back())) {
+                name_.remove_suffix(1);
+            }
+            attributes_.clear();
+            pos_ = close + 1;
+            return Token::EndTag;
+        } else {
+            readStartTag();
+            return Token::StartTag;
+        }
+    }
+}
+
+auto XMLScanner::attribute(std::string_view name) const -> std::optional<std::string> {
+    auto iter = std::find_if(attributes_.begin(), attributes_.end(), [&](auto const & attr) {
+        return attr.first == name;
+    });
+    if (iter == attributes_.end()) {
+        return std::nullopt;
+    }
+    return unescapeXML(iter->second);
+}
+
+auto XMLScanner::text() -> std::string {
+    auto result = std::string{};
+    if (pendingEnd_) {
+        return result;
+    }
+    while (pos_ < document_.size()) {
+        auto open = std::min(document_.find('<', pos_), document_.size());
+        result += unescapeXML(document_.substr(pos_, open - pos_));
+        pos_      = open;
+        auto rest = document_.substr(pos_);
+
+        if (rest.substr(0, 9) == "<![CDATA[") {
+            auto end = document_.find("]]>", pos_ + 9);
+            if (end == std::string_view::npos) {
+                fail("missing ']]>'");
+            }
+            result += document_.substr(pos_ + 9, end - pos_ - 9);
+            pos_ = end + 3;
+        } else if (rest.substr(0, 4) == "<!--") {
+            skipPast("-->");
+        } else {
+            break;
+        }
+    }
+    return result;
+}
+
+auto XMLScanner::line() const -> std::size_t {
+    return 1 + static_cast<std::size_t>(std::count(document_.begin(), document_.begin() + pos_, '\n'));
+}
+
+void XMLScanner::fail(std::string const & message) const {
+    throw std::runtime_error{"malformed xml in line " + std::to_string(line()) + ": " + message};
+}
+
+void XMLScanner::skipPast(std::string_view terminator) {
+    auto end = document_.find(terminator, pos_);
+    if (end == std::string_view::npos) {
+        fail("missing '" + std::string{terminator} + "'");
+    }
+    pos_ = end + terminator.size();
+}
+
+void XMLScanner::readStartTag() {
+    auto const size = document_.size();
+    auto       pos  = pos_ + 1;
+
+    auto skipSpaces = [&]() {
+        while (pos < size && isSpace(document_[pos])) {
+            ++pos;
+        }
+    };
+    auto readName = [&]() {
+        auto begin = pos;
+        while (pos < size && !isNameEnd(document_[pos])) {
+            ++pos;
+        }
+        return document_.substr(begin, pos - begin);
+    };
+
+    name_ = readName();
+    if (name_.empty()) {
+        fail("expected a tag name");
+    }
+
+    attributes_.clear();
+    while (true) {
+        skipSpaces();
+        if (pos >= size) {
+            fail("unterminated tag <" + std::string{name_} + ">");
+        }
+        if (document_[pos] == '>') {
+            break;
+        }
+        if (document_[pos] == '/') {
+            if (pos + 1 >= size || document_[pos + 1] != '>') {
+                fail("expected '>' after '/'");
+            }
+            pendingEnd_ = true;
+            ++pos;
+            break;
+        }
+
+        auto key = readName();
+        skipSpaces();
+        if (key.empty() || pos >= size || document_[pos] != '=') {
+            fail("expected an attribute in <" + std::string{name_} + ">");
+        }
+        ++pos;
+        skipSpaces();
+        if (pos >= size || (document_[pos] != '"' && document_[pos] != '\'')) {
+            fail("expected a quoted value for attribute " + std::string{key});
+        }
+        auto quote = document_[pos];
+        auto end   = document_.find(quote, pos + 1);
+        if (end == std::string_view::npos) {
+            fail("unterminated value of attribute " + std::string{key});
+        }
+        attributes_.emplace_back(key, document_.substr(pos + 1, end - pos - 1));
+        pos = end + 1;
+    }
+    pos_ = pos + 1;
+}
+
+auto unescapeXML(std::string_view str) -> std::string {
+    // most values contain neither entities nor line breaks
+    if (str.find('&') == std::string_view::npos && str.find("#br#") == std::string_view::npos) {
+        return std::string{str};
+    }
+
+    auto out = std::string{};
+    out.reserve(str.size());
+    while (!str.empty()) {
+        if (str.substr(0, 4) == "#br#") {
+            out.push_back('\n');
+            str.remove_prefix(4);
+            continue;
+        }
+        auto semicolon = str[0] == '&' ? str.find(';') : std::string_view::npos;
+        if (semicolon == std::string_view::npos) {
+            out.push_back(str[0]);
+            str.remove_prefix(1);
+            continue;
+        }
+
+        auto entity = str.substr(1, semicolon - 1);
+        if (entity == "amp") {
+            out.push_back('&');
+        } else if (entity == "lt") {
+            out.push_back('<');
+        } else if (entity == "gt") {
+            out.push_back('>');
+        } else if (entity == "quot") {
+            out.push_back('"');
+        } else if (entity == "apos") {
+            out.push_back('\'');
+        } else if (entity.size() > 1 && entity[0] == '#') {
+            auto hex       = entity[1] == 'x' || entity[1] == 'X';
+            auto digits    = entity.substr(hex ? 2 : 1);
+            auto cp        = 0u;
+            auto [ptr, ec] = std::from_chars(digits.data(), digits.data() + digits.size(), cp, hex ? 16 : 10);
+            if (ec != std::errc{} || ptr != digits.data() + digits.size() || digits.empty() || cp > 0x10ffff) {
+                throw std::runtime_error{"invalid character reference &" + std::string{entity} + ";"};
+            }
+            appendUtf8(out, cp);
+        } else {
+            throw std::runtime_error{"unknown entity &" + std::string{entity} + ";"};
+        }
+        str.remove_prefix(semicolon + 1);
+    }
+    return out;
+}
+
+} // namespace detail
+
+} // namespace tdl
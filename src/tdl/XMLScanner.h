@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace tdl {
+
+namespace detail {
+
+/*!\brief A minimal pull scanner over the tags of an XML document, as written by `convertToCTD`
+ *
+ * No tree is built, `next` moves from tag to tag. Declarations, processing instructions,
+ * comments, CDATA sections and text are skipped, unless the text is read by `text`.
+ * A self closing tag is reported as a start tag directly followed by its end tag.
+ * The scanner refers to the document, which has to outlive it.
+ */
+class XMLScanner {
+public:
+    enum class Token { StartTag, EndTag, End };
+
+    explicit XMLScanner(std::string_view document) : document_{document} {}
+
+    //!\brief moves to the next tag, throws `std::runtime_error` if the document is malformed
+    auto next() -> Token;
+
+    //!\brief name of the current tag
+    auto name() const -> std::string_view {
+        return name_;
+    }
+
+    //!\brief the unescaped value of an attribute of the current start tag
+    auto attribute(std::string_view name) const -> std::optional<std::string>;
+
+    /*!\brief the text following the current start tag up to the next tag
+     *
+     * CDATA sections are taken as they are, other text is unescaped. Comments are skipped.
+     */
+    auto text() -> std::string;
+
+    //!\brief line of the current position, for error messages
+    auto line() const -> std::size_t;
+
+private:
+    [[noreturn]] void fail(std::string const & message) const;
+    void skipPast(std::string_view terminator);
+    void readStartTag();
+
+    std::string_view                                           document_;
+    std::size_t                                                pos_{};
+    std::string_view                                           name_{};
+    bool                                                       pendingEnd_{}; //!< the last start tag was self closing
+    std::vector<std::pair<std::string_view, std::string_view>> attributes_{}; //!< escaped attribute values
+};
+
+//!\brief replaces the entities and line breaks written by `escapeXML`
+auto unescapeXML(std::string_view str) -> std::string;
+
+} // namespace detail
+
+} // namespace tdl
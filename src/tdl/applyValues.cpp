@@ -0,0 +1,218 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "applyValues.h"
+
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <yaml-cpp/yaml.h>
+
+#include "ParamIndex.h"
+#include "XMLScanner.h"
+#include "cwl_v1_2.h"
+#include "parseValue.h"
+
+namespace tdl {
+
+namespace detail {
+
+inline auto isList(Node const & node) -> bool {
+    return std::holds_alternative<IntValueList>(node.value) || std::holds_alternative<DoubleValueList>(node.value)
+           || std::holds_alternative<StringValueList>(node.value);
+}
+
+inline void clearList(Node & node) {
+    std::visit(
+        [](auto & value) {
+            using V = std::decay_t<decltype(value)>;
+            if constexpr (std::is_same_v<V, IntValueList> || std::is_same_v<V, DoubleValueList>
+                          || std::is_same_v<V, StringValueList>) {
+                value.value.clear();
+            }
+        },
+        node.value);
+}
+
+/*!\brief finds the node of a path, dropping leading components until a node is found
+ *
+ * The last component alone is looked up as a leaf name. Throws if no node is found.
+ */
+inline auto lookupNode(MutableParamIndex const & index, std::string_view path) -> Node & {
+    for (auto suffix = path;;) {
+        if (auto node = index.find(suffix)) {
+            return *node;
+        }
+        if (index.isAmbiguousPath(suffix)) {
+            throw std::runtime_error{"parameter " + std::string{path} + " is ambiguous"};
+        }
+        auto pos = suffix.find(MutableParamIndex::separator);
+        if (pos == std::string_view::npos) {
+            if (auto node = index.findByName(suffix)) {
+                return *node;
+            }
+            if (index.isAmbiguous(suffix)) {
+                throw std::runtime_error{"parameter " + std::string{path} + " is ambiguous"};
+            }
+            break;
+        }
+        suffix.remove_prefix(pos + 1);
+    }
+    throw std::runtime_error{"unknown parameter " + std::string{path}};
+}
+
+//!\brief applies the ITEMs and ITEMLISTs of a CTD/INI document
+inline void applyCTDValues(ToolInfo & doc, std::string_view document) {
+    auto index   = MutableParamIndex{doc};
+    auto scanner = XMLScanner{document};
+
+    auto inParameters = false;
+    auto nodePath     = std::string{};              // names of the enclosing NODEs, separated by ':'
+    auto nodeLengths  = std::vector<std::size_t>{}; // length of nodePath before each NODE
+    auto itemPath     = std::string{};
+    auto list         = static_cast<Node *>(nullptr); // node of the open ITEMLIST
+
+    auto setItemPath = [&](std::string_view tag) -> std::string const & {
+        auto name = scanner.attribute("name");
+        if (!name) {
+            throw std::runtime_error{"missing name of " + std::string{tag} + " in line "
+                                     + std::to_string(scanner.line())};
+        }
+        itemPath = nodePath;
+        if (!itemPath.empty()) {
+            itemPath += MutableParamIndex::separator;
+        }
+        itemPath += *name;
+        return itemPath;
+    };
+
+    for (auto token = scanner.next(); token != XMLScanner::Token::End; token = scanner.next()) {
+        auto tag = scanner.name();
+        if (token == XMLScanner::Token::EndTag) {
+            if (tag == "PARAMETERS") {
+                inParameters = false;
+            } else if (tag == "NODE" && inParameters) {
+                if (nodeLengths.empty()) {
+                    throw std::runtime_error{"unmatched </NODE> in line " + std::to_string(scanner.line())};
+                }
+                nodePath.resize(nodeLengths.back());
+                nodeLengths.pop_back();
+            } else if (tag == "ITEMLIST") {
+                list = nullptr;
+            }
+            continue;
+        }
+
+        if (tag == "PARAMETERS") {
+            inParameters = true;
+        } else if (!inParameters) {
+            continue;
+        } else if (tag == "NODE") {
+            nodeLengths.push_back(nodePath.size());
+            auto const & path = setItemPath(tag);
+            nodePath          = path;
+        } else if (tag == "ITEM") {
+            auto const & path  = setItemPath(tag);
+            auto &       node  = lookupNode(index, path);
+            auto         value = scanner.attribute("value");
+            if (isList(node)) {
+                throw std::runtime_error{"parameter " + path + " expects an ITEMLIST"};
+            }
+            if (value) {
+                assignValue(node, path, *value, true);
+            }
+        } else if (tag == "ITEMLIST") {
+            auto const & path = setItemPath(tag);
+            list              = &lookupNode(index, path);
+            if (!isList(*list)) {
+                throw std::runtime_error{"parameter " + path + " expects an ITEM"};
+            }
+            clearList(*list);
+        } else if (tag == "LISTITEM") {
+            if (!list) {
+                throw std::runtime_error{"LISTITEM outside of an ITEMLIST in line " + std::to_string(scanner.line())};
+            }
+            if (auto value = scanner.attribute("value")) {
+                assignValue(*list, itemPath, *value, false);
+            }
+        }
+    }
+}
+
+//!\brief the string of a scalar or the path of a File or Directory object
+inline auto scalarOf(YAML::Node const & n, std::string const & path) -> std::string {
+    if (n.IsScalar()) {
+        return n.Scalar();
+    }
+    auto isPathObject = [&]() {
+        auto type = n.IsMap() && n["class"] ? n["class"].as<std::string>() : std::string{};
+        return type == "File" || type == "Directory";
+    };
+    if (isPathObject()) {
+        if (n["path"]) {
+            return n["path"].as<std::string>();
+        }
+        if (n["location"]) {
+            auto location = n["location"].as<std::string>();
+            if (location.rfind("file://", 0) == 0) {
+                location.erase(0, 7);
+            }
+            return location;
+        }
+    }
+    throw std::runtime_error{"parameter " + path + " expects a single value"};
+}
+
+inline void applyCWLValues(MutableParamIndex const & index, YAML::Node const & job, std::string const & prefix) {
+    if (!job.IsMap()) {
+        throw std::runtime_error{prefix.empty() ? std::string{"a CWL job has to be a map"}
+                                                : "parameter " + prefix + " expects a map"};
+    }
+    for (auto const & entry : job) {
+        auto const & value = entry.second;
+        if (value.IsNull()) {
+            continue;
+        }
+        auto path = entry.first.as<std::string>();
+        if (!prefix.empty()) {
+            path = prefix + MutableParamIndex::separator + path;
+        }
+        auto & node = lookupNode(index, path);
+
+        if (std::holds_alternative<Node::Children>(node.value)) {
+            applyCWLValues(index, value, path);
+        } else if (isList(node)) {
+            if (!value.IsSequence()) {
+                throw std::runtime_error{"parameter " + path + " expects a list"};
+            }
+            clearList(node);
+            for (auto const & element : value) {
+                assignValue(node, path, scalarOf(element, path), false);
+            }
+        } else {
+            assignValue(node, path, scalarOf(value, path), true);
+        }
+    }
+}
+
+} // namespace detail
+
+void applyValuesFromString(ToolInfo & doc, std::string_view content) {
+    auto first = content.find_first_not_of(" \t\r\n");
+    if (first != std::string_view::npos && content[first] == '<') {
+        detail::applyCTDValues(doc, content);
+        return;
+    }
+    auto job = YAML::Load(std::string{content});
+    if (!job.IsDefined() || job.IsNull()) {
+        return;
+    }
+    detail::applyCWLValues(MutableParamIndex{doc}, job, "");
+}
+
+void applyValues(ToolInfo & doc, std::filesystem::path const & path) {
+    applyValuesFromString(doc, w3id_org::cwl::read_document(path));
+}
+
+} // namespace tdl
@@ -0,0 +1,37 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <filesystem>
+#include <string_view>
+
+#include "ToolInfo.h"
+
+namespace tdl {
+
+/*!\brief writes the values of a parameter file into the matching nodes of a ToolInfo
+ *
+ * The file is either a CTD/INI parameter file or a CWL job file (YAML or JSON), documents
+ * starting with '<' are read as XML.
+ *
+ *  - CTD: the `ITEM` and `ITEMLIST` entries below `PARAMETERS` are matched by the names of their
+ *    enclosing `NODE`s and their own name. If that path does not exist, leading components are
+ *    dropped, so INI files with a top level node of the tool name are accepted as well.
+ *    Finally, the leaf name alone is looked up.
+ *  - CWL: the keys of the job are the names of the inputs, records are nested maps.
+ *    `File` and `Directory` objects provide their `path` or `location`. `null` values are skipped.
+ *
+ * Lists are replaced by the values of the file, all other nodes keep their values.
+ * The CTD file is scanned without building a document tree and each value is parsed and checked
+ * against the type, limits and valid values of its node as it is read.
+ * Throws `std::runtime_error` on unknown parameters and on malformed or invalid values, the values
+ * read up to that point are already written.
+ */
+void applyValues(ToolInfo & doc, std::filesystem::path const & path);
+
+//!\brief same as `applyValues`, but reads the parameters from a string
+void applyValuesFromString(ToolInfo & doc, std::string_view content);
+
+} // namespace tdl
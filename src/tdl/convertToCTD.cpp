@@ -8,6 +8,9 @@
 #include <iomanip>
 #include <limits>
 #include <sstream>
+#include <string_view>
+
+#include "ParamRef.h"
 
 namespace tdl {
 
@@ -52,14 +55,16 @@ inline auto escapeXML(std::string str) {
     return str;
 }
 
-//!\brief Converts this structures to a string
-auto XMLNode::generateString(std::vector<std::string> const & order, std::string const & ind) const -> std::string {
-    auto ss = std::stringstream{};
-    ss << ind << "<" << escapeXML(tag);
+//!\brief writes the start of the tag of `node` with all its attributes, without the closing '>' or '/>'
+inline void writeStartTag(std::ostream &                   ss,
+                          XMLNode const &                  node,
+                          std::vector<std::string> const & order,
+                          std::string const &              ind) {
+    ss << ind << "<" << escapeXML(node.tag);
 
     // orders the attributes according to the values in `order`
     auto attributes = [&]() {
-        auto t_attr = this->attr;
+        auto t_attr = node.attr;
         auto attr2  = std::vector<std::tuple<std::string, std::optional<std::string>>>{};
 
         for (auto const & o : order) {
@@ -83,6 +88,20 @@ auto XMLNode::generateString(std::vector<std::string> const & order, std::string
             ss << "=\"" << escapeXML(*v) << "\"";
         }
     }
+}
+
+//!\brief the start of the tag of `node`, see `writeStartTag`
+inline auto generateStartTag(XMLNode const & node, std::vector<std::string> const & order, std::string const & ind)
+    -> std::string {
+    auto ss = std::stringstream{};
+    writeStartTag(ss, node, order, ind);
+    return ss.str();
+}
+
+//!\brief Converts this structures to a string
+auto XMLNode::generateString(std::vector<std::string> const & order, std::string const & ind) const -> std::string {
+    auto ss = std::stringstream{};
+    writeStartTag(ss, *this, order, ind);
 
     assert(children.empty() || !data); // can only have children or data, not both
 
@@ -150,8 +169,9 @@ auto generateValidList(T const & value) -> std::optional<std::string> {
                            });
 }
 
-//!\brief converts a Node into an XMLNode
-auto convertToCTD(Node const & param) -> XMLNode {
+//!\brief converts a parameter into an XMLNode, `param` is a `ParamRef` of a Node or of a node of a FlatToolInfo
+template <typename Param>
+auto convertParamToCTD(Param const & param) -> XMLNode {
     // generate a single Node
     auto xmlNode = XMLNode{/*.tag = */ "NODE",
                            /*.attr = */ {{"name", param.name}, {"description", param.description}}};
@@ -159,96 +179,96 @@ auto convertToCTD(Node const & param) -> XMLNode {
     auto tags = param.tags; // copy tags to make them mutable
 
     // fill xmlNode depending on the actual type
-    std::visit(overloaded{
-                   [&](BoolValue value) {
-                       xmlNode.tag           = "ITEM";
-                       xmlNode.attr["type"]  = "bool";
-                       xmlNode.attr["value"] = value ? "true" : "false";
-                   },
-                   [&](IntValue value) {
-                       xmlNode.tag           = "ITEM";
-                       xmlNode.attr["type"]  = "int";
-                       xmlNode.attr["value"] = std::to_string(value.value);
-                       if (auto v = generateRestrictions(value))
-                           xmlNode.attr["restrictions"] = v;
-                   },
-                   [&](DoubleValue value) {
-                       xmlNode.tag           = "ITEM";
-                       xmlNode.attr["type"]  = "double";
-                       xmlNode.attr["value"] = convertToString(value.value);
-                       if (auto v = generateRestrictions(value))
-                           xmlNode.attr["restrictions"] = v;
-                   },
-                   [&](StringValue value) {
-                       xmlNode.tag = "ITEM";
-                       if (tags.count("input file") > 0) {
-                           tags.erase("input file");
-                           xmlNode.attr["type"] = "input-file";
-                           if (auto v = generateValidList(value))
-                               xmlNode.attr["supported_formats"] = v;
-                       } else if (tags.count("output file") > 0) {
-                           tags.erase("output file");
-                           xmlNode.attr["type"] = "output-file";
-                           if (auto v = generateValidList(value))
-                               xmlNode.attr["supported_formats"] = v;
-                       } else if (tags.count("output prefix") > 0) {
-                           tags.erase("output prefix");
-                           xmlNode.attr["type"] = "output-prefix";
-                           if (auto v = generateValidList(value))
-                               xmlNode.attr["supported_formats"] = v;
-                       } else {
-                           xmlNode.attr["type"] = "string";
-                           if (auto v = generateValidList(value))
-                               xmlNode.attr["restrictions"] = v;
-                       }
-                       xmlNode.attr["value"] = value.value;
-                   },
-                   [&](IntValueList value) {
-                       xmlNode.tag          = "ITEMLIST";
-                       xmlNode.attr["type"] = "int";
-                       for (auto const & v : value.value) {
-                           xmlNode.children.push_back({"LISTITEM", {{"value", convertToString(v)}}});
-                       }
-                       if (auto v = generateRestrictions(value))
-                           xmlNode.attr["restrictions"] = v;
-                   },
-                   [&](DoubleValueList value) {
-                       xmlNode.tag          = "ITEMLIST";
-                       xmlNode.attr["type"] = "double";
-                       for (auto const & v : value.value) {
-                           xmlNode.children.push_back({"LISTITEM", {{"value", convertToString(v)}}});
-                       }
-                       if (auto v = generateRestrictions(value))
-                           xmlNode.attr["restrictions"] = v;
-                   },
-                   [&](StringValueList value) {
-                       xmlNode.tag = "ITEMLIST";
-                       if (tags.count("input file") > 0) {
-                           tags.erase("input file");
-                           xmlNode.attr["type"] = "input-file";
-                           if (auto v = generateValidList(value))
-                               xmlNode.attr["supported_formats"] = v;
-                       } else if (tags.count("output file") > 0) {
-                           tags.erase("output file");
-                           xmlNode.attr["type"] = "output-file";
-                           if (auto v = generateValidList(value))
-                               xmlNode.attr["supported_formats"] = v;
-                       } else {
-                           xmlNode.attr["type"] = "string";
-                           if (auto v = generateValidList(value))
-                               xmlNode.attr["restrictions"] = v;
-                       }
-                       for (auto const & v : value.value) {
-                           xmlNode.children.push_back({"LISTITEM", {{"value", v}}});
-                       }
-                   },
-                   [&](Node::Children const & children) {
-                       for (auto const & child : children) {
-                           xmlNode.children.emplace_back(convertToCTD(child));
-                       }
-                   },
-               },
-               param.value);
+    param.visitValue(overloaded{
+                         [&](BoolValue value) {
+                             xmlNode.tag           = "ITEM";
+                             xmlNode.attr["type"]  = "bool";
+                             xmlNode.attr["value"] = value ? "true" : "false";
+                         },
+                         [&](IntValue value) {
+                             xmlNode.tag           = "ITEM";
+                             xmlNode.attr["type"]  = "int";
+                             xmlNode.attr["value"] = std::to_string(value.value);
+                             if (auto v = generateRestrictions(value))
+                                 xmlNode.attr["restrictions"] = v;
+                         },
+                         [&](DoubleValue value) {
+                             xmlNode.tag           = "ITEM";
+                             xmlNode.attr["type"]  = "double";
+                             xmlNode.attr["value"] = convertToString(value.value);
+                             if (auto v = generateRestrictions(value))
+                                 xmlNode.attr["restrictions"] = v;
+                         },
+                         [&](StringValue value) {
+                             xmlNode.tag = "ITEM";
+                             if (tags.contains(Tag::input_file)) {
+                                 tags.erase(Tag::input_file);
+                                 xmlNode.attr["type"] = "input-file";
+                                 if (auto v = generateValidList(value))
+                                     xmlNode.attr["supported_formats"] = v;
+                             } else if (tags.contains(Tag::output_file)) {
+                                 tags.erase(Tag::output_file);
+                                 xmlNode.attr["type"] = "output-file";
+                                 if (auto v = generateValidList(value))
+                                     xmlNode.attr["supported_formats"] = v;
+                             } else if (tags.contains(Tag::output_prefix)) {
+                                 tags.erase(Tag::output_prefix);
+                                 xmlNode.attr["type"] = "output-prefix";
+                                 if (auto v = generateValidList(value))
+                                     xmlNode.attr["supported_formats"] = v;
+                             } else {
+                                 xmlNode.attr["type"] = "string";
+                                 if (auto v = generateValidList(value))
+                                     xmlNode.attr["restrictions"] = v;
+                             }
+                             xmlNode.attr["value"] = value.value;
+                         },
+                         [&](IntValueList value) {
+                             xmlNode.tag          = "ITEMLIST";
+                             xmlNode.attr["type"] = "int";
+                             for (auto const & v : value.value) {
+                                 xmlNode.children.push_back({"LISTITEM", {{"value", convertToString(v)}}});
+                             }
+                             if (auto v = generateRestrictions(value))
+                                 xmlNode.attr["restrictions"] = v;
+                         },
+                         [&](DoubleValueList value) {
+                             xmlNode.tag          = "ITEMLIST";
+                             xmlNode.attr["type"] = "double";
+                             for (auto const & v : value.value) {
+                                 xmlNode.children.push_back({"LISTITEM", {{"value", convertToString(v)}}});
+                             }
+                             if (auto v = generateRestrictions(value))
+                                 xmlNode.attr["restrictions"] = v;
+                         },
+                         [&](StringValueList value) {
+                             xmlNode.tag = "ITEMLIST";
+                             if (tags.contains(Tag::input_file)) {
+                                 tags.erase(Tag::input_file);
+                                 xmlNode.attr["type"] = "input-file";
+                                 if (auto v = generateValidList(value))
+                                     xmlNode.attr["supported_formats"] = v;
+                             } else if (tags.contains(Tag::output_file)) {
+                                 tags.erase(Tag::output_file);
+                                 xmlNode.attr["type"] = "output-file";
+                                 if (auto v = generateValidList(value))
+                                     xmlNode.attr["supported_formats"] = v;
+                             } else {
+                                 xmlNode.attr["type"] = "string";
+                                 if (auto v = generateValidList(value))
+                                     xmlNode.attr["restrictions"] = v;
+                             }
+                             for (auto const & v : value.value) {
+                                 xmlNode.children.push_back({"LISTITEM", {{"value", v}}});
+                             }
+                         },
+                         [&](auto const & children) { // Node::Children or FlatChildren
+                             auto span = TraceSpan{"tdl.subtree", "subtree", param.name};
+                             forEachParam(children, [&](auto const & child) {
+                                 xmlNode.children.emplace_back(convertParamToCTD(child));
+                             });
+                         },
+                     });
 
     // add description if available
     if (!param.description.empty()) {
@@ -257,12 +277,12 @@ auto convertToCTD(Node const & param) -> XMLNode {
 
     if (xmlNode.tag != "NODE") {
         // convert special tags to special xml attributes
-        auto convertTagToAttr = [&](std::string const & tag) {
-            xmlNode.attr[tag] = tags.count(tag) ? "true" : "false";
+        auto convertTagToAttr = [&](Tag tag) {
+            xmlNode.attr[Tags::name(tag)] = tags.contains(tag) ? "true" : "false";
             tags.erase(tag);
         };
-        convertTagToAttr("required");
-        convertTagToAttr("advanced");
+        convertTagToAttr(Tag::required);
+        convertTagToAttr(Tag::advanced);
     }
 
     // add all other tags to the "tags" xml attribute
@@ -277,13 +297,17 @@ auto convertToCTD(Node const & param) -> XMLNode {
     return xmlNode;
 }
 
-} // namespace detail
+//!\brief converts a Node into an XMLNode
+auto convertToCTD(Node const & param) -> XMLNode {
+    return convertParamToCTD(paramRef(param));
+}
 
-/*!\brief converts a ToolInfo into a string that
- * holds the CTD representation of the given tool
+/*!\brief builds the XMLNode tree of the whole CTD document of a ToolInfo or a FlatToolInfo
+ *
+ * Without `withParameters`, the PARAMETERS element stays empty, `streamCTD` writes the parameters itself.
  */
-auto convertToCTD(ToolInfo const & doc) -> std::string {
-    auto const & node      = doc.params;
+template <typename Doc>
+auto buildCTD(Doc const & doc, bool withParameters = true) -> XMLNode {
     auto const & tool_info = doc.metaInfo;
 
     static auto const schema_location = std::string{"/SCHEMAS/Param_1_7_0.xsd"};
@@ -337,8 +361,10 @@ auto convertToCTD(ToolInfo const & doc) -> std::string {
                               "https://raw.githubusercontent.com/OpenMS/OpenMS/develop/share/OpenMS" + schema_location},
                              {"xmlns:xsi", "http://www.w3.org/2001/XMLSchema-instance"}}};
 
-        for (auto const & child : node) {
-            paramsNode.children.emplace_back(detail::convertToCTD(child));
+        if (withParameters) {
+            forEachParam(topLevelParams(doc), [&](auto const & child) {
+                paramsNode.children.emplace_back(convertParamToCTD(child));
+            });
         }
         toolNode.children.push_back(std::move(paramsNode));
     }
@@ -354,29 +380,131 @@ auto convertToCTD(ToolInfo const & doc) -> std::string {
         }
         toolNode.children.emplace_back(std::move(cliNode));
     }
+    return toolNode;
+}
 
+constexpr auto xmlDeclaration = std::string_view{"<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"};
+
+//!\brief the order of the attributes in the generated CTD, other attributes follow sorted by name
+inline auto attributeOrder() -> std::vector<std::string> const & {
+    static auto const order = std::vector<std::string>{"ctdVersion",
+                                                       "version",
+                                                       "name",
+                                                       "value",
+                                                       "type",
+                                                       "description",
+                                                       "docurl",
+                                                       "category",
+                                                       "xsi:noNamespaceSchemaLocation",
+                                                       "xmlns:xsi",
+                                                       "required",
+                                                       "advanced",
+                                                       "restrictions"};
+    return order;
+}
+
+//!\brief the text of the CTD document built by `buildCTD`
+inline auto generateCTD(XMLNode const & toolNode) -> std::string {
     auto ss = std::stringstream{};
     ss.precision(std::numeric_limits<double>::digits10);
 
-    static auto order = std::vector<std::string>{"ctdVersion",
-                                                 "version",
-                                                 "name",
-                                                 "value",
-                                                 "type",
-                                                 "description",
-                                                 "docurl",
-                                                 "category",
-                                                 "xsi:noNamespaceSchemaLocation",
-                                                 "xmlns:xsi",
-                                                 "required",
-                                                 "advanced",
-                                                 "restrictions"};
-
     // Write ctd specific stuff
-    ss << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
-    ss << toolNode.generateString(order);
-
+    ss << xmlDeclaration;
+    ss << toolNode.generateString(attributeOrder());
     return ss.str();
 }
 
+inline auto exportCTD(ToolInfo const & doc, ExportStats * stats) -> std::string {
+    auto span = TraceSpan{"tdl", "convertToCTD", doc.metaInfo.name};
+
+    auto toolNode = [&]() {
+        auto timer = PhaseTimer{stats, ExportPhase::CTDBuild};
+        return buildCTD(doc);
+    }();
+
+    auto timer  = PhaseTimer{stats, ExportPhase::CTDGenerate};
+    auto result = generateCTD(toolNode);
+    if (stats) {
+        stats->exports += 1;
+        stats->nodes += countNodes(doc.params);
+        stats->bytes += result.size();
+    }
+    return result;
+}
+
+//!\brief writes `node` like `XMLNode::generateString` does, but one child at a time
+inline void streamXML(XMLNode const & node, ChunkWriter & writer, std::string const & ind) {
+    if (node.children.empty()) {
+        writer.append(node.generateString(attributeOrder(), ind));
+        return;
+    }
+    writer.append(generateStartTag(node, attributeOrder(), ind));
+    writer.append(">\n");
+    for (auto const & child : node.children) {
+        writer.append(child.generateString(attributeOrder(), ind + "    "));
+    }
+    writer.append(ind + "</" + escapeXML(node.tag) + ">\n");
+}
+
+//!\brief writes a parameter like `XMLNode::generateString` does, groups are written child by child
+inline void streamCTD(Node const & param, ChunkWriter & writer, std::string const & ind) {
+    auto children = std::get_if<Node::Children>(&param.value);
+    if (!children || children->empty()) {
+        writer.append(convertToCTD(param).generateString(attributeOrder(), ind));
+        return;
+    }
+
+    auto span = TraceSpan{"tdl.subtree", "subtree", param.name};
+    auto node = convertToCTD(Node{param.name, param.description, param.tags, Node::Children{}});
+    writer.append(generateStartTag(node, attributeOrder(), ind));
+    writer.append(">\n");
+    for (auto const & child : *children) {
+        streamCTD(child, writer, ind + "    ");
+    }
+    writer.append(ind + "</" + escapeXML(node.tag) + ">\n");
+}
+
+} // namespace detail
+
+/*!\brief converts a ToolInfo into a string that
+ * holds the CTD representation of the given tool
+ */
+auto convertToCTD(ToolInfo const & doc) -> std::string {
+    return detail::exportCTD(doc, nullptr);
+}
+
+auto convertToCTD(ToolInfo const & doc, ExportStats & stats) -> std::string {
+    return detail::exportCTD(doc, &stats);
+}
+
+auto convertToCTD(FlatToolInfo const & doc) -> std::string {
+    auto span = detail::TraceSpan{"tdl", "convertToCTD", doc.metaInfo.name};
+    return detail::generateCTD(detail::buildCTD(doc));
+}
+
+void streamCTD(ToolInfo const & doc, ExportSink const & sink) {
+    auto span     = detail::TraceSpan{"tdl", "streamCTD", doc.metaInfo.name};
+    auto writer   = detail::ChunkWriter{sink};
+    auto toolNode = detail::buildCTD(doc, false);
+    auto indent   = std::string{"    "};
+
+    writer.append(detail::xmlDeclaration);
+    writer.append(detail::generateStartTag(toolNode, detail::attributeOrder(), ""));
+    writer.append(">\n");
+    for (auto const & child : toolNode.children) {
+        if (child.tag != "PARAMETERS" || doc.params.empty()) {
+            detail::streamXML(child, writer, indent);
+            continue;
+        }
+        writer.append(detail::generateStartTag(child, detail::attributeOrder(), indent));
+        writer.append(">\n");
+        for (auto const & param : doc.params) {
+            detail::streamCTD(param, writer, indent + indent);
+        }
+        writer.append(indent + "</PARAMETERS>\n");
+    }
+    writer.append("</tool>\n");
+    writer.flush();
+}
+
 } // namespace tdl
@@ -7,6 +7,9 @@
 #include <map>
 #include <string>
 
+#include "ExportSink.h"
+#include "ExportStats.h"
+#include "FlatToolInfo.h"
 #include "ToolInfo.h"
 
 namespace tdl {
@@ -28,4 +31,17 @@ auto convertToCTD(Node const & param) -> XMLNode;
 
 auto convertToCTD(ToolInfo const & doc) -> std::string;
 
+//!\brief converts a ToolInfo and adds the durations and sizes of the export to `stats`
+auto convertToCTD(ToolInfo const & doc, ExportStats & stats) -> std::string;
+
+//!\brief converts a FlatToolInfo directly, the result is the same as for the ToolInfo it was built from
+auto convertToCTD(FlatToolInfo const & doc) -> std::string;
+
+/*!\brief converts a ToolInfo and passes the CTD to `sink` in chunks, as the parameters are converted
+ *
+ * The concatenated chunks are the same as the result of `convertToCTD`. The parameters are converted
+ * one at a time, the text of the whole document is never held in memory.
+ */
+void streamCTD(ToolInfo const & doc, ExportSink const & sink);
+
 } // namespace tdl
@@ -11,6 +11,7 @@
 #include <map>
 #include <sstream>
 
+#include "ParamRef.h"
 #include "cwl_v1_2.h"
 
 namespace tdl {
@@ -37,8 +38,7 @@ auto convertToString(T v) -> std::string {
     return ss.str();
 }
 
-
-inline auto simplifyType(YAML::Node type) -> YAML::Node {
+auto simplifyType(YAML::Node type) -> YAML::Node {
     auto is_optional = [](YAML::Node const & node) {
         return node.IsSequence() && node.size() == 2u && node[0].Scalar() == "null";
     };
@@ -65,8 +65,9 @@ inline auto simplifyType(YAML::Node type) -> YAML::Node {
     return type;
 }
 
-inline auto findCLIMapping(std::string const & referenceName, ToolInfo const & doc) -> CLIMapping const * {
-    for (auto const & mapping : doc.cliMapping) {
+inline auto findCLIMapping(std::string const & referenceName, std::vector<CLIMapping> const & cliMappings)
+    -> CLIMapping const * {
+    for (auto const & mapping : cliMappings) {
         if (mapping.referenceName == referenceName) {
             return &mapping;
         }
@@ -84,15 +85,15 @@ void setIdOrName(InputType & input, std::string const & name) {
     }
 }
 
-template <typename TypeType, typename InputType, typename InputCB>
+template <typename TypeType, typename InputType, typename Param, typename InputCB>
 void addInput_impl(TypeType const &   type,
                    InputType          input,
-                   Node const &       child,
+                   Param const &      child,
                    InputCB const &    inputCB,
                    CLIMapping const * cliMapping) {
     setIdOrName(input, child.name);
 
-    if (child.tags.count("required")) {
+    if (child.tags.contains(Tag::required)) {
         input.type = type;
     } else {
         input.type = std::vector<std::variant<cwl::CWLType,
@@ -102,32 +103,32 @@ void addInput_impl(TypeType const &   type,
                                               std::string>>{cwl::CWLType::null, type};
     }
     if constexpr (std::is_same_v<InputType, cwl::CommandInputParameter>) {
-        if ((child.tags.count("required") == 0 && child.tags.count("no_default") == 0)
-            || (child.tags.count("required") && child.tags.count("default_as_hint"))) {
+        if ((!child.tags.contains(Tag::required) && !child.tags.contains(Tag::no_default))
+            || (child.tags.contains(Tag::required) && child.tags.contains(Tag::default_as_hint))) {
             // produce a default value
-            std::visit(overloaded{
-                           [&](BoolValue const & v) {
-                               *input.default_ = v;
-                           },
-                           [&](IntValue const & v) {
-                               *input.default_ = v.value;
-                           },
-                           [&](DoubleValue const & v) {
-                               *input.default_ = v.value;
-                           },
-                           [&](StringValue const & v) {
-                               if (!child.tags.count("output")
-                                    && !child.tags.count("file")
-                                    && !child.tags.count("directory")
-                                    && !child.tags.count("prefixed")) {
-
-                                   *input.default_ = v.value;
-                                } else {
-                                    *input.default_ = "unsupported default";
-                                }
-                           },
-                           [&](auto const&) {}
-            }, child.value);
+            child.visitValue(overloaded{
+                                 [&](BoolValue const & v) {
+                                     *input.default_ = v;
+                                 },
+                                 [&](IntValue const & v) {
+                                     *input.default_ = v.value;
+                                 },
+                                 [&](DoubleValue const & v) {
+                                     *input.default_ = v.value;
+                                 },
+                                 [&](StringValue const & v) {
+                                     if (!child.tags.contains(Tag::output)
+                                          && !child.tags.contains(Tag::file)
+                                          && !child.tags.contains(Tag::directory)
+                                          && !child.tags.contains(Tag::prefixed)) {
+
+                                         *input.default_ = v.value;
+                                      } else {
+                                          *input.default_ = "unsupported default";
+                                      }
+                                 },
+                                 [&](auto const&) {}
+            });
         }
     }
 
@@ -142,10 +143,10 @@ void addInput_impl(TypeType const &   type,
     inputCB(std::move(input));
 }
 
-template <typename TypeType, typename InputType, typename InputCB>
+template <typename TypeType, typename InputType, typename Param, typename InputCB>
 void addInputArray_impl(TypeType const &   type,
                         InputType          input,
-                        Node const &       child,
+                        Param const &      child,
                         InputCB const &    inputCB,
                         CLIMapping const * cliMapping) {
     setIdOrName(input, child.name);
@@ -153,7 +154,7 @@ void addInputArray_impl(TypeType const &   type,
     auto arrayType  = cwl::CommandInputArraySchema{};
     arrayType.items = type;
 
-    if (child.tags.count("required")) {
+    if (child.tags.contains(Tag::required)) {
         input.type = arrayType;
     } else {
         input.type = std::vector<std::variant<cwl::CWLType,
@@ -174,17 +175,22 @@ void addInputArray_impl(TypeType const &   type,
     inputCB(std::move(input));
 }
 
-template <typename TypeType, typename InputType, typename InputCB, typename OutputType, typename OutputCB>
+template <typename TypeType,
+          typename InputType,
+          typename Param,
+          typename InputCB,
+          typename OutputType,
+          typename OutputCB>
 void addOutput_impl(TypeType const &   type,
                     InputType          input,
-                    Node const &       child,
+                    Param const &      child,
                     InputCB const &    inputCB,
                     CLIMapping const * cliMapping,
                     OutputType         output,
                     OutputCB const &   outputCB) {
     setIdOrName(input, child.name);
 
-    if (child.tags.count("required")) {
+    if (child.tags.contains(Tag::required)) {
         input.type = cwl::CWLType::string;
     } else {
         input.type = std::vector<std::variant<cwl::CWLType,
@@ -206,7 +212,7 @@ void addOutput_impl(TypeType const &   type,
 
     setIdOrName(output, child.name);
 
-    if (child.tags.count("required")) {
+    if (child.tags.contains(Tag::required)) {
         output.type = type;
     } else {
         output.type = std::vector<std::variant<cwl::CWLType,
@@ -223,10 +229,15 @@ void addOutput_impl(TypeType const &   type,
     outputCB(std::move(output));
 }
 
-template <typename TypeType, typename InputType, typename InputCB, typename OutputType, typename OutputCB>
+template <typename TypeType,
+          typename InputType,
+          typename Param,
+          typename InputCB,
+          typename OutputType,
+          typename OutputCB>
 void addOutputPrefixed_impl(TypeType const &   type,
                             InputType          input,
-                            Node const &       child,
+                            Param const &      child,
                             InputCB const &    inputCB,
                             CLIMapping const * cliMapping,
                             OutputType         output,
@@ -234,7 +245,7 @@ void addOutputPrefixed_impl(TypeType const &   type,
                             bool               multipleFiles) {
     setIdOrName(input, child.name);
 
-    if (child.tags.count("required")) {
+    if (child.tags.contains(Tag::required)) {
         input.type = cwl::CWLType::string;
     } else {
         input.type = std::vector<std::variant<cwl::CWLType,
@@ -266,7 +277,7 @@ void addOutputPrefixed_impl(TypeType const &   type,
     }
 
     // Add a null, if not required and an array, if a list of files
-    if (!child.tags.count("required")) {
+    if (!child.tags.contains(Tag::required)) {
         output.type = std::vector<std::variant<cwl::CWLType,
                                                cwl::CommandOutputRecordSchema,
                                                cwl::CommandOutputEnumSchema,
@@ -291,21 +302,22 @@ void addOutputPrefixed_impl(TypeType const &   type,
 }
 
 //!\brief Recursive function that traverses the tree of the tool and generates the CWL representation.
-// CB = Callback
+// `children` are `Node::Children` or `FlatChildren`, CB = Callback
 template <typename InputType  = cwl::CommandInputParameter,
           typename OutputType = cwl::CommandOutputParameter,
           size_t deep         = 5,
+          typename Children,
           typename InputCB,
           typename OutputCB,
           typename BaseCommandCB>
-inline void generateCWL(Node::Children const & children,
-                        ToolInfo const &       doc,
-                        InputCB const &        inputCB,
-                        OutputCB const &       outputCB,
-                        BaseCommandCB const &  baseCommandCB) {
+inline void generateCWL(Children const &                children,
+                        std::vector<CLIMapping> const & cliMappings,
+                        InputCB const &                 inputCB,
+                        OutputCB const &                outputCB,
+                        BaseCommandCB const &           baseCommandCB) {
     if constexpr (deep > 0) {
-        for (auto child : children) {
-            auto cliMapping = findCLIMapping(child.name, doc);
+        forEachParam(children, [&](auto const & child) {
+            auto cliMapping = findCLIMapping(child.name, cliMappings);
 
             auto addInput = [&](auto type) {
                 addInput_impl(type, InputType{}, child, inputCB, cliMapping);
@@ -330,94 +342,96 @@ inline void generateCWL(Node::Children const & children,
                                        multipleFiles);
             };
 
-            std::visit(overloaded{
-                           [&](BoolValue const &) {
-                               addInput(cwl::CWLType::boolean);
-                           },
-                           [&](IntValue const &) {
-                               addInput(cwl::CWLType::long_);
-                           },
-                           [&](DoubleValue const &) {
-                               addInput(cwl::CWLType::double_);
-                           },
-                           [&](StringValue const &) {
-                               if (child.tags.count("output")) {
-                                   if (child.tags.count("file")) {
-                                       addOutput(cwl::CWLType::File);
-                                   } else if (child.tags.count("directory")) {
-                                       addOutput(cwl::CWLType::Directory);
-                                   } else if (child.tags.count("prefixed")) {
-                                       addOutputPrefixed(cwl::CWLType::File, /*.mutliplieFiles = */ false);
-                                   }
-                               } else if (child.tags.count("file")) {
-                                   addInput(cwl::CWLType::File);
-                               } else if (child.tags.count("directory")) {
-                                   addInput(cwl::CWLType::Directory);
-                               } else {
-                                   addInput(cwl::CWLType::string);
-                               }
-                           },
-                           [&](IntValueList const &) {
-                               addInputArray(cwl::CWLType::long_);
-                           },
-                           [&](DoubleValueList const &) {
-                               addInputArray(cwl::CWLType::double_);
-                           },
-                           [&](StringValueList const &) {
-                               if (child.tags.count("output")) {
-                                   if (child.tags.count("prefixed")) {
-                                       addOutputPrefixed(cwl::CWLType::File, /*.multipleFiles =*/true);
-                                   } else {
-                                       //! TODO not implemented
-                                   }
-                               } else if (child.tags.count("file")) {
-                                   addInputArray(cwl::CWLType::File);
-                               } else if (child.tags.count("directory")) {
-                                   addInputArray(cwl::CWLType::Directory);
-                               } else {
-                                   addInputArray(cwl::CWLType::string);
-                               }
-                           },
-                           [&](Node::Children const & recursive_children) {
-                               if (child.tags.count("basecommand")) {
-                                   baseCommandCB(child.name);
-
-                                   generateCWL<InputType, OutputType, deep - 1>(recursive_children,
-                                                                                doc,
-                                                                                inputCB,
-                                                                                outputCB,
-                                                                                baseCommandCB);
-                                   return;
-                               }
-
-                               auto inputs  = std::vector<cwl::CommandInputRecordField>{};
-                               auto outputs = std::vector<cwl::CommandOutputRecordField>{};
-
-                               generateCWL<cwl::CommandInputRecordField, cwl::CommandOutputRecordField, (deep - 1)>(
-                                   recursive_children,
-                                   doc,
-                                   [&](auto input) {
-                                       inputs.push_back(std::move(input));
-                                   },
-                                   [&](auto output) {
-                                       outputs.push_back(std::move(output));
-                                   },
-                                   baseCommandCB);
-
-                               auto inputType = cwl::CommandInputRecordSchema{};
-
-                               inputType.fields = inputs;
-                               addInput(inputType);
-                           },
-                       },
-                       child.value);
-        }
+            child.visitValue(overloaded{
+                                 [&](BoolValue const &) {
+                                     addInput(cwl::CWLType::boolean);
+                                 },
+                                 [&](IntValue const &) {
+                                     addInput(cwl::CWLType::long_);
+                                 },
+                                 [&](DoubleValue const &) {
+                                     addInput(cwl::CWLType::double_);
+                                 },
+                                 [&](StringValue const &) {
+                                     if (child.tags.contains(Tag::output)) {
+                                         if (child.tags.contains(Tag::file)) {
+                                             addOutput(cwl::CWLType::File);
+                                         } else if (child.tags.contains(Tag::directory)) {
+                                             addOutput(cwl::CWLType::Directory);
+                                         } else if (child.tags.contains(Tag::prefixed)) {
+                                             addOutputPrefixed(cwl::CWLType::File, /*.mutliplieFiles = */ false);
+                                         }
+                                     } else if (child.tags.contains(Tag::file)) {
+                                         addInput(cwl::CWLType::File);
+                                     } else if (child.tags.contains(Tag::directory)) {
+                                         addInput(cwl::CWLType::Directory);
+                                     } else {
+                                         addInput(cwl::CWLType::string);
+                                     }
+                                 },
+                                 [&](IntValueList const &) {
+                                     addInputArray(cwl::CWLType::long_);
+                                 },
+                                 [&](DoubleValueList const &) {
+                                     addInputArray(cwl::CWLType::double_);
+                                 },
+                                 [&](StringValueList const &) {
+                                     if (child.tags.contains(Tag::output)) {
+                                         if (child.tags.contains(Tag::prefixed)) {
+                                             addOutputPrefixed(cwl::CWLType::File, /*.multipleFiles =*/true);
+                                         } else {
+                                             //! TODO not implemented
+                                         }
+                                     } else if (child.tags.contains(Tag::file)) {
+                                         addInputArray(cwl::CWLType::File);
+                                     } else if (child.tags.contains(Tag::directory)) {
+                                         addInputArray(cwl::CWLType::Directory);
+                                     } else {
+                                         addInputArray(cwl::CWLType::string);
+                                     }
+                                 },
+                                 [&](auto const & recursive_children) { // Node::Children or FlatChildren
+                                     auto span = TraceSpan{"tdl.subtree", "subtree", child.name};
+                                     if (child.tags.contains(Tag::basecommand)) {
+                                         baseCommandCB(child.name);
+
+                                         generateCWL<InputType, OutputType, deep - 1>(recursive_children,
+                                                                                      cliMappings,
+                                                                                      inputCB,
+                                                                                      outputCB,
+                                                                                      baseCommandCB);
+                                         return;
+                                     }
+
+                                     auto inputs  = std::vector<cwl::CommandInputRecordField>{};
+                                     auto outputs = std::vector<cwl::CommandOutputRecordField>{};
+
+                                     generateCWL<cwl::CommandInputRecordField,
+                                                 cwl::CommandOutputRecordField,
+                                                 (deep - 1)>(
+                                         recursive_children,
+                                         cliMappings,
+                                         [&](auto input) {
+                                             inputs.push_back(std::move(input));
+                                         },
+                                         [&](auto output) {
+                                             outputs.push_back(std::move(output));
+                                         },
+                                         baseCommandCB);
+
+                                     auto inputType = cwl::CommandInputRecordSchema{};
+
+                                     inputType.fields = inputs;
+                                     addInput(inputType);
+                                 },
+                             });
+        });
     }
 }
 
-} // namespace detail
-
-auto tool_to_yaml(ToolInfo const & doc) -> YAML::Node {
+//!\brief builds the CommandLineTool of a ToolInfo or a FlatToolInfo
+template <typename Doc>
+auto buildCWL(Doc const & doc) -> cwl::CommandLineTool {
     auto & tool_info = doc.metaInfo;
 
     auto tool       = cwl::CommandLineTool{};
@@ -439,8 +453,8 @@ auto tool_to_yaml(ToolInfo const & doc) -> YAML::Node {
     baseCommand.push_back(std::filesystem::path{tool_info.executableName}.filename().string());
 
     detail::generateCWL(
-        doc.params,
-        doc,
+        topLevelParams(doc),
+        doc.cliMapping,
         [&](auto input) {
             tool.inputs->push_back(std::move(input));
         },
@@ -453,14 +467,20 @@ auto tool_to_yaml(ToolInfo const & doc) -> YAML::Node {
 
     tool.baseCommand = std::move(baseCommand);
 
-    return w3id_org::cwl::toYaml(tool, {});
+    return tool;
 }
 
-/*!\brief converts a ToolInfo into a string that
- * holds the CWL representation of the given tool
- */
-auto convertToCWL(ToolInfo const & doc) -> std::string {
-    auto yaml = tool_to_yaml(doc);
+//!\brief the yaml tree of the CWL document, with simplified types and post processed
+template <typename Doc>
+auto buildYaml(Doc const & doc, PostProcessCWL const & postProcess, ExportStats * stats) -> YAML::Node {
+    auto tool = [&]() {
+        auto timer = PhaseTimer{stats, ExportPhase::CWLBuild};
+        return buildCWL(doc);
+    }();
+    auto yaml = [&]() {
+        auto timer = PhaseTimer{stats, ExportPhase::CWLToYaml};
+        return w3id_org::cwl::toYaml(tool, {});
+    }();
 
     // function to traverse yaml tree and executes 'simplifyType' on all nodes with name 'type'
     auto traverseTree = std::function<void(YAML::Node)>{};
@@ -480,19 +500,131 @@ auto convertToCWL(ToolInfo const & doc) -> std::string {
         }
     };
 
-    // Post procssing inputs and outputs of the yaml object
-    for (auto param : {"inputs", "outputs"}) {
-        traverseTree(yaml[param]);
+    { // Post procssing inputs and outputs of the yaml object
+        auto timer = PhaseTimer{stats, ExportPhase::CWLSimplifyTypes};
+        for (auto param : {"inputs", "outputs"}) {
+            traverseTree(yaml[param]);
+        }
     }
 
     // post process generated cwl yaml file
-    if (post_process_cwl) {
-        post_process_cwl(yaml);
+    if (postProcess) {
+        auto timer = PhaseTimer{stats, ExportPhase::CWLPostProcess};
+        postProcess(yaml);
     }
+    return yaml;
+}
+
+inline auto exportCWL(ToolInfo const & doc, PostProcessCWL const & postProcess, ExportStats * stats) -> std::string {
+    auto span = TraceSpan{"tdl", "convertToCWL", doc.metaInfo.name};
+    auto yaml = buildYaml(doc, postProcess, stats);
 
+    auto timer = PhaseTimer{stats, ExportPhase::CWLEmit};
     YAML::Emitter out;
     out << yaml;
-    return out.c_str();
+
+    auto result = std::string{out.c_str(), out.size()};
+    if (stats) {
+        stats->exports += 1;
+        stats->nodes += countNodes(doc.params);
+        stats->bytes += result.size();
+    }
+    return result;
+}
+
+//!\brief `key: value` as the only entry of a map, the same text as the entry of a larger map
+inline auto emitEntry(YAML::Node const & key, YAML::Node const & value) -> std::string {
+    auto out = YAML::Emitter{};
+    out << YAML::BeginMap << YAML::Key << key << YAML::Value << value << YAML::EndMap;
+    return {out.c_str(), out.size()};
+}
+
+//!\brief `key:` and the nested entry `item`, as it is written inside of the map of `key`
+inline auto emitNestedEntry(YAML::Node const & key, YAML::Node const & itemKey, YAML::Node const & item)
+    -> std::string {
+    auto out = YAML::Emitter{};
+    out << YAML::BeginMap << YAML::Key << key << YAML::Value;
+    out << YAML::BeginMap << YAML::Key << itemKey << YAML::Value << item << YAML::EndMap;
+    out << YAML::EndMap;
+    return {out.c_str(), out.size()};
+}
+
+//!\brief true for a map that is written in block style, so its entries can be written one by one
+inline auto isBlockMap(YAML::Node const & node) -> bool {
+    return node.IsMap() && node.size() > 0 && node.Style() != YAML::EmitterStyle::Flow;
+}
+
+} // namespace detail
+
+auto tool_to_yaml(ToolInfo const & doc) -> YAML::Node {
+    return w3id_org::cwl::toYaml(detail::buildCWL(doc), {});
+}
+
+/*!\brief converts a ToolInfo into a string that
+ * holds the CWL representation of the given tool
+ */
+auto convertToCWL(ToolInfo const & doc) -> std::string {
+    return detail::exportCWL(doc, post_process_cwl, nullptr);
+}
+
+auto convertToCWL(ToolInfo const & doc, ExportStats & stats) -> std::string {
+    return detail::exportCWL(doc, post_process_cwl, &stats);
+}
+
+auto convertToCWL(ToolInfo const & doc, PostProcessCWL const & postProcess) -> std::string {
+    return detail::exportCWL(doc, postProcess, nullptr);
+}
+
+auto convertToCWL(ToolInfo const & doc, PostProcessCWL const & postProcess, ExportStats & stats) -> std::string {
+    return detail::exportCWL(doc, postProcess, &stats);
+}
+
+auto convertToCWL(FlatToolInfo const & doc) -> std::string {
+    auto span = detail::TraceSpan{"tdl", "convertToCWL", doc.metaInfo.name};
+    auto out  = YAML::Emitter{};
+    out << detail::buildYaml(doc, post_process_cwl, nullptr);
+    return {out.c_str(), out.size()};
+}
+
+void streamCWL(ToolInfo const & doc, ExportSink const & sink) {
+    streamCWL(doc, sink, post_process_cwl);
+}
+
+void streamCWL(ToolInfo const & doc, ExportSink const & sink, PostProcessCWL const & postProcess) {
+    auto span   = detail::TraceSpan{"tdl", "streamCWL", doc.metaInfo.name};
+    auto yaml   = detail::buildYaml(doc, postProcess, nullptr);
+    auto writer = detail::ChunkWriter{sink};
+
+    if (!detail::isBlockMap(yaml)) {
+        auto out = YAML::Emitter{};
+        out << yaml;
+        writer.append({out.c_str(), out.size()});
+        writer.flush();
+        return;
+    }
+
+    // the entries of a block map are separated by line breaks, the last one is not followed by one
+    auto separator = std::string_view{};
+    for (auto entry : yaml) {
+        auto const & key = entry.first;
+        if (!key.IsScalar() || (key.Scalar() != "inputs" && key.Scalar() != "outputs")
+            || !detail::isBlockMap(entry.second)) {
+            writer.append(separator);
+            writer.append(detail::emitEntry(key, entry.second));
+            separator = "\n";
+            continue;
+        }
+        // inputs and outputs are written one by one, "inputs:" only before the first one
+        auto first = true;
+        for (auto item : entry.second) {
+            auto text = detail::emitNestedEntry(key, item.first, item.second);
+            writer.append(separator);
+            writer.append(first ? std::string_view{text} : std::string_view{text}.substr(text.find('\n') + 1));
+            separator = "\n";
+            first     = false;
+        }
+    }
+    writer.flush();
 }
 
 } // namespace tdl
@@ -8,20 +8,59 @@
 
 #include <yaml-cpp/node/node.h>
 
+#include "ExportSink.h"
+#include "ExportStats.h"
+#include "FlatToolInfo.h"
 #include "ToolInfo.h"
 
 namespace tdl {
 
+//!\brief a callback that adjusts the yaml tree of a CWL document before it is written
+using PostProcessCWL = std::function<void(YAML::Node &)>;
+
 /**!\brief a global callback function to adjust the exporting for cwl
  *
  * This callback allows to adjust the exported yaml file to add/change/remove
  * cwl entries, which currently aren't controllable via tdl itself.
+ * It is used by the overloads of `convertToCWL` without a `PostProcessCWL` argument. It must not be
+ * changed while other threads export, pass the callback to each call instead.
  */
-inline std::function<void(YAML::Node &)> post_process_cwl;
+inline PostProcessCWL post_process_cwl;
+
+namespace detail {
+//!\brief collapses the CWL type `[null, T]` into "T?", `{type: array, items: T}` into "T[]" and both into "T[]?"
+auto simplifyType(YAML::Node type) -> YAML::Node;
+} // namespace detail
 
 /*!\brief converts a ToolInfo into a string that
  * holds the CWL representation of the given tool
  */
 auto convertToCWL(ToolInfo const & doc) -> std::string;
 
+//!\brief converts a ToolInfo and adds the durations and sizes of the export to `stats`
+auto convertToCWL(ToolInfo const & doc, ExportStats & stats) -> std::string;
+
+/*!\brief converts a ToolInfo, `postProcess` is called instead of the global `post_process_cwl`
+ *
+ * An empty `postProcess` skips the post processing.
+ */
+auto convertToCWL(ToolInfo const & doc, PostProcessCWL const & postProcess) -> std::string;
+
+//!\brief converts a ToolInfo with its own post processing and adds the durations and sizes to `stats`
+auto convertToCWL(ToolInfo const & doc, PostProcessCWL const & postProcess, ExportStats & stats) -> std::string;
+
+//!\brief converts a FlatToolInfo directly, the result is the same as for the ToolInfo it was built from
+auto convertToCWL(FlatToolInfo const & doc) -> std::string;
+
+/*!\brief converts a ToolInfo and passes the CWL to `sink` in chunks
+ *
+ * The concatenated chunks are the same as the result of `convertToCWL`. The yaml tree is built
+ * first, because the post processing works on the whole document. The text is then written one top
+ * level entry, one input or one output at a time, it is never held in memory as a whole.
+ */
+void streamCWL(ToolInfo const & doc, ExportSink const & sink);
+
+//!\brief converts a ToolInfo in chunks, `postProcess` is called instead of the global `post_process_cwl`
+void streamCWL(ToolInfo const & doc, ExportSink const & sink, PostProcessCWL const & postProcess);
+
 } // namespace tdl
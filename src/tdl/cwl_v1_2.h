@@ -5,6 +5,10 @@
 /* This file was generated using schema-salad code generator.
  *
  * The embedded document is subject to the license of the original schema.
+ *
+ * Only declarations are kept in this header, the definitions of the
+ * toYaml/fromYaml members and of the document loading/storing functions
+ * live in cwl_v1_2.cpp.
  */
 
 #include <any>
@@ -125,6 +129,9 @@ inline auto toYaml(std::monostate const&, [[maybe_unused]] store_config const&)
 inline auto toYaml(std::string const& v, [[maybe_unused]] store_config const&) {
     return YAML::Node{v};
 }
+inline auto toYaml(YAML::Node const& v, [[maybe_unused]] store_config const&) {
+    return v;
+}
 
 template <typename T, typename ...Args>
 auto anyToYaml_impl(std::any const& a, [[maybe_unused]] store_config const& config) {
@@ -150,7 +157,8 @@ inline auto toYaml(std::any const& a, [[maybe_unused]] store_config const& confi
                           uint32_t,
                           int64_t,
                           uint64_t,
-                          std::string>(a, config);
+                          std::string,
+                          YAML::Node>(a, config);
 }
 
 // declaring fromYaml
@@ -172,7 +180,9 @@ inline void fromYaml(YAML::Node const& n, int64_t& v) {
 inline void fromYaml(YAML::Node const& n, std::string& v) {
     v = n.as<std::string>();
 }
-inline void fromYaml(YAML::Node const&, std::any&) {
+// untyped values (e.g. defaults) are kept as their yaml node
+inline void fromYaml(YAML::Node const& n, std::any& v) {
+    v = n;
 }
 inline void fromYaml(YAML::Node const&, std::monostate&) {
 }
@@ -242,6 +252,81 @@ void fromYaml(YAML::Node const& n, T& t);
 template <typename ...Args>
 void fromYaml(YAML::Node const& n, std::variant<Args...>& t);
 
+// emits a list directly in map form (see convertListToMap), without building the list node first
+template <typename T>
+auto toYamlAsMap(std::vector<T> const& v, std::string const& mapSubject,
+                 std::string const& mapPredicate, store_config const& config) -> YAML::Node {
+    if (!config.transformListsToMaps || mapSubject.empty() || v.empty()) return toYaml(v, config);
+    auto map = YAML::Node(YAML::NodeType::Map);
+    for (auto const& e : v) {
+        auto n = toYaml(e, config);
+        auto key = n[mapSubject].template as<std::string>();
+        // force_insert skips the linear search for an existing key, the subjects are unique
+        if (mapPredicate.empty() || n[mapPredicate].IsMap() || n.size() > 2) {
+            n.remove(mapSubject);
+            map.force_insert(key, n);
+        } else {
+            map.force_insert(key, n[mapPredicate]);
+        }
+    }
+    return map;
+}
+template <typename T>
+auto toYamlAsMap(T const& v, std::string const& mapSubject,
+                 std::string const& mapPredicate, store_config const& config) -> YAML::Node {
+    return convertListToMap(toYaml(v, config), mapSubject, mapPredicate, config);
+}
+template <typename ...Args>
+auto toYamlAsMap(std::variant<Args...> const& v, std::string const& mapSubject,
+                 std::string const& mapPredicate, store_config const& config) -> YAML::Node {
+    return std::visit([&](auto const& e) {
+        return toYamlAsMap(e, mapSubject, mapPredicate, config);
+    }, v);
+}
+
+// reads a list that might be given in map form (see convertMapToList), without building a list node first
+template <typename T>
+void fromYamlAsList(YAML::Node const& n, std::string const& mapSubject,
+                    std::string const& mapPredicate, std::vector<T>& v) {
+    if (mapSubject.empty() || !n.IsDefined() || !n.IsMap()) {
+        fromYaml(n, v);
+        return;
+    }
+    v.reserve(v.size() + n.size());
+    for (auto e : n) {
+        v.emplace_back();
+        if (mapPredicate.empty() || e.second.IsMap()) {
+            e.second[mapSubject] = e.first;
+            fromYaml(e.second, v.back());
+            continue;
+        }
+        // Scalars are copied by value. Assigning a node of the document would merge
+        // all nodes of the document into the memory of the new node.
+        auto entry = YAML::Node{};
+        entry[mapSubject] = e.first.Scalar();
+        if (e.second.IsScalar()) {
+            entry[mapPredicate] = e.second.Scalar();
+        } else {
+            entry[mapPredicate] = e.second;
+        }
+        fromYaml(entry, v.back());
+    }
+}
+template <typename T>
+void fromYamlAsList(YAML::Node const& n, std::string const& mapSubject,
+                    std::string const& mapPredicate, T& v) {
+    fromYaml(convertMapToList(n, mapSubject, mapPredicate), v);
+}
+template <typename T>
+void fromYamlAsList(YAML::Node const& n, std::string const& mapSubject,
+                    std::string const& mapPredicate, std::variant<std::monostate, std::vector<T>>& v) {
+    if (mapSubject.empty() || !n.IsDefined() || !n.IsMap()) {
+        fromYaml(n, v);
+        return;
+    }
+    fromYamlAsList(n, mapSubject, mapPredicate, v.template emplace<std::vector<T>>());
+}
+
 template <typename T>
 struct DetectAndExtractFromYaml {
     auto operator()(YAML::Node const&) const -> std::optional<T> {
@@ -291,6 +376,14 @@ template <> struct DetectAndExtractFromYaml<int32_t>     : DetectAndExtractFromY
 template <> struct DetectAndExtractFromYaml<int64_t>     : DetectAndExtractFromYaml_implScalar<int64_t>{};
 template <> struct DetectAndExtractFromYaml<std::string> : DetectAndExtractFromYaml_implScalar<std::string>{};
 
+template <>
+struct DetectAndExtractFromYaml<std::any> {
+    auto operator()(YAML::Node const& n) const -> std::optional<std::any> {
+        if (!n.IsDefined()) return std::nullopt;
+        return std::any{n};
+    }
+};
+
 template <typename T>
 struct DetectAndExtractFromYaml<std::vector<T>> {
     auto operator()(YAML::Node const& n) const -> std::optional<std::vector<T>> {
@@ -2738,5897 +2831,386 @@ template <typename T> heap_object<T>::~heap_object() = default;
 }
 
 inline w3id_org::cwl::salad::Documented::~Documented() = default;
-inline auto w3id_org::cwl::salad::Documented::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("Documented");
-    }
-    {
-         auto member = toYaml(*doc, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "doc", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::salad::Documented::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["doc"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *doc);
-    }
-}
-inline auto w3id_org::cwl::salad::RecordField::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("RecordField");
-    }
-    n = mergeYaml(n, w3id_org::cwl::salad::Documented::toYaml(config));
-    {
-         auto member = toYaml(*name, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "name", member);
-    }
-    {
-         auto member = toYaml(*type, config);
-         member = simplifyType(member, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "type", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::salad::RecordField::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::salad::Documented::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["name"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *name);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["type"], "", "");
-        auto expandedNode = expandType(nodeAsList);
-        fromYaml(expandedNode, *type);
-    }
-}
 namespace w3id_org::cwl {
 template <>
 struct DetectAndExtractFromYaml<::w3id_org::cwl::salad::RecordField> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::salad::RecordField> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::salad::RecordField{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.name)::value_t>::value) try {
-            fromYaml(n["name"], *res.name);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) try {
-            fromYaml(n["type"], *res.type);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::salad::RecordField>;
 };
 }
-inline auto w3id_org::cwl::salad::RecordSchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("RecordSchema");
-    }
-    {
-         auto member = toYaml(*fields, config);
-         member = convertListToMap(member, "name", "type", config);
-        addYamlField(n, "fields", member);
-    }
-    {
-         auto member = toYaml(*type, config);
-         member = simplifyType(member, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "type", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::salad::RecordSchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["fields"], "name", "type");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *fields);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["type"], "", "");
-        auto expandedNode = expandType(nodeAsList);
-        fromYaml(expandedNode, *type);
-    }
-}
 namespace w3id_org::cwl {
 template <>
 struct DetectAndExtractFromYaml<::w3id_org::cwl::salad::RecordSchema> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::salad::RecordSchema> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::salad::RecordSchema{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.fields)::value_t>::value) try {
-            fromYaml(n["fields"], *res.fields);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) try {
-            fromYaml(n["type"], *res.type);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::salad::RecordSchema>;
 };
 }
-inline auto w3id_org::cwl::salad::EnumSchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("EnumSchema");
-    }
-    {
-         auto member = toYaml(*name, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "name", member);
-    }
-    {
-         auto member = toYaml(*symbols, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "symbols", member);
-    }
-    {
-         auto member = toYaml(*type, config);
-         member = simplifyType(member, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "type", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::salad::EnumSchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["name"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *name);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["symbols"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *symbols);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["type"], "", "");
-        auto expandedNode = expandType(nodeAsList);
-        fromYaml(expandedNode, *type);
-    }
-}
 namespace w3id_org::cwl {
 template <>
 struct DetectAndExtractFromYaml<::w3id_org::cwl::salad::EnumSchema> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::salad::EnumSchema> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::salad::EnumSchema{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.name)::value_t>::value) try {
-            fromYaml(n["name"], *res.name);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.symbols)::value_t>::value) try {
-            fromYaml(n["symbols"], *res.symbols);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) try {
-            fromYaml(n["type"], *res.type);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::salad::EnumSchema>;
 };
 }
-inline auto w3id_org::cwl::salad::ArraySchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("ArraySchema");
-    }
-    {
-         auto member = toYaml(*items, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "items", member);
-    }
-    {
-         auto member = toYaml(*type, config);
-         member = simplifyType(member, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "type", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::salad::ArraySchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["items"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *items);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["type"], "", "");
-        auto expandedNode = expandType(nodeAsList);
-        fromYaml(expandedNode, *type);
-    }
-}
 namespace w3id_org::cwl {
 template <>
 struct DetectAndExtractFromYaml<::w3id_org::cwl::salad::ArraySchema> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::salad::ArraySchema> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::salad::ArraySchema{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.items)::value_t>::value) try {
-            fromYaml(n["items"], *res.items);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) try {
-            fromYaml(n["type"], *res.type);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::salad::ArraySchema>;
 };
 }
-inline auto w3id_org::cwl::cwl::File::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("File");
-    }
-    {
-         auto member = toYaml(*class_, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "class", member);
-    }
-    {
-         auto member = toYaml(*location, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "location", member);
-    }
-    {
-         auto member = toYaml(*path, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "path", member);
-    }
-    {
-         auto member = toYaml(*basename, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "basename", member);
-    }
-    {
-         auto member = toYaml(*dirname, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "dirname", member);
-    }
-    {
-         auto member = toYaml(*nameroot, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "nameroot", member);
-    }
-    {
-         auto member = toYaml(*nameext, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "nameext", member);
-    }
-    {
-         auto member = toYaml(*checksum, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "checksum", member);
-    }
-    {
-         auto member = toYaml(*size, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "size", member);
-    }
-    {
-         auto member = toYaml(*secondaryFiles, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "secondaryFiles", member);
-    }
-    {
-         auto member = toYaml(*format, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "format", member);
-    }
-    {
-         auto member = toYaml(*contents, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "contents", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::File::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["class"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *class_);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["location"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *location);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["path"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *path);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["basename"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *basename);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["dirname"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *dirname);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["nameroot"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *nameroot);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["nameext"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *nameext);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["checksum"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *checksum);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["size"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *size);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["secondaryFiles"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *secondaryFiles);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["format"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *format);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["contents"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *contents);
-    }
-}
 namespace w3id_org::cwl {
 template <>
 struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::File> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::File> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::File{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) try {
-            fromYaml(n["class"], *res.class_);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.location)::value_t>::value) try {
-            fromYaml(n["location"], *res.location);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.path)::value_t>::value) try {
-            fromYaml(n["path"], *res.path);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.basename)::value_t>::value) try {
-            fromYaml(n["basename"], *res.basename);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.dirname)::value_t>::value) try {
-            fromYaml(n["dirname"], *res.dirname);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.nameroot)::value_t>::value) try {
-            fromYaml(n["nameroot"], *res.nameroot);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.nameext)::value_t>::value) try {
-            fromYaml(n["nameext"], *res.nameext);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.checksum)::value_t>::value) try {
-            fromYaml(n["checksum"], *res.checksum);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.size)::value_t>::value) try {
-            fromYaml(n["size"], *res.size);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.secondaryFiles)::value_t>::value) try {
-            fromYaml(n["secondaryFiles"], *res.secondaryFiles);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.format)::value_t>::value) try {
-            fromYaml(n["format"], *res.format);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.contents)::value_t>::value) try {
-            fromYaml(n["contents"], *res.contents);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::File>;
 };
 }
-inline auto w3id_org::cwl::cwl::Directory::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("Directory");
-    }
-    {
-         auto member = toYaml(*class_, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "class", member);
-    }
-    {
-         auto member = toYaml(*location, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "location", member);
-    }
-    {
-         auto member = toYaml(*path, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "path", member);
-    }
-    {
-         auto member = toYaml(*basename, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "basename", member);
-    }
-    {
-         auto member = toYaml(*listing, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "listing", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::Directory::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["class"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *class_);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["location"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *location);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["path"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *path);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["basename"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *basename);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["listing"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *listing);
-    }
-}
 namespace w3id_org::cwl {
 template <>
 struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::Directory> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::Directory> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::Directory{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) try {
-            fromYaml(n["class"], *res.class_);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.location)::value_t>::value) try {
-            fromYaml(n["location"], *res.location);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.path)::value_t>::value) try {
-            fromYaml(n["path"], *res.path);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.basename)::value_t>::value) try {
-            fromYaml(n["basename"], *res.basename);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.listing)::value_t>::value) try {
-            fromYaml(n["listing"], *res.listing);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::Directory>;
 };
 }
 inline w3id_org::cwl::cwl::Labeled::~Labeled() = default;
-inline auto w3id_org::cwl::cwl::Labeled::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("Labeled");
-    }
-    {
-         auto member = toYaml(*label, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "label", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::Labeled::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["label"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *label);
-    }
-}
 inline w3id_org::cwl::cwl::Identified::~Identified() = default;
-inline auto w3id_org::cwl::cwl::Identified::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("Identified");
-    }
-    {
-         auto member = toYaml(*id, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "id", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::Identified::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["id"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *id);
-    }
-}
 inline w3id_org::cwl::cwl::LoadContents::~LoadContents() = default;
-inline auto w3id_org::cwl::cwl::LoadContents::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("LoadContents");
-    }
-    {
-         auto member = toYaml(*loadContents, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "loadContents", member);
-    }
-    {
-         auto member = toYaml(*loadListing, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "loadListing", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::LoadContents::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["loadContents"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *loadContents);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["loadListing"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *loadListing);
-    }
-}
 inline w3id_org::cwl::cwl::FieldBase::~FieldBase() = default;
-inline auto w3id_org::cwl::cwl::FieldBase::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("FieldBase");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::Labeled::toYaml(config));
-    {
-         auto member = toYaml(*secondaryFiles, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "secondaryFiles", member);
-    }
-    {
-         auto member = toYaml(*streamable, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "streamable", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::FieldBase::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::Labeled::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["secondaryFiles"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *secondaryFiles);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["streamable"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *streamable);
-    }
-}
 inline w3id_org::cwl::cwl::InputFormat::~InputFormat() = default;
-inline auto w3id_org::cwl::cwl::InputFormat::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("InputFormat");
-    }
-    {
-         auto member = toYaml(*format, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "format", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::InputFormat::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["format"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *format);
-    }
-}
 inline w3id_org::cwl::cwl::OutputFormat::~OutputFormat() = default;
-inline auto w3id_org::cwl::cwl::OutputFormat::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("OutputFormat");
-    }
-    {
-         auto member = toYaml(*format, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "format", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::OutputFormat::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["format"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *format);
-    }
-}
 inline w3id_org::cwl::cwl::Parameter::~Parameter() = default;
-inline auto w3id_org::cwl::cwl::Parameter::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("Parameter");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::FieldBase::toYaml(config));
-    n = mergeYaml(n, w3id_org::cwl::salad::Documented::toYaml(config));
-    n = mergeYaml(n, w3id_org::cwl::cwl::Identified::toYaml(config));
-    return n;
-}
-inline void w3id_org::cwl::cwl::Parameter::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::FieldBase::fromYaml(n);
-    w3id_org::cwl::salad::Documented::fromYaml(n);
-    w3id_org::cwl::cwl::Identified::fromYaml(n);
-}
-inline auto w3id_org::cwl::cwl::InputBinding::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("InputBinding");
-    }
-    {
-         auto member = toYaml(*loadContents, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "loadContents", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::InputBinding::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["loadContents"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *loadContents);
-    }
-}
 namespace w3id_org::cwl {
 template <>
 struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::InputBinding> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::InputBinding> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::InputBinding{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.loadContents)::value_t>::value) try {
-            fromYaml(n["loadContents"], *res.loadContents);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::InputBinding>;
 };
 }
 inline w3id_org::cwl::cwl::IOSchema::~IOSchema() = default;
-inline auto w3id_org::cwl::cwl::IOSchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("IOSchema");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::Labeled::toYaml(config));
-    n = mergeYaml(n, w3id_org::cwl::salad::Documented::toYaml(config));
-    {
-         auto member = toYaml(*name, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "name", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::IOSchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::Labeled::fromYaml(n);
-    w3id_org::cwl::salad::Documented::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["name"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *name);
-    }
-}
 inline w3id_org::cwl::cwl::InputSchema::~InputSchema() = default;
-inline auto w3id_org::cwl::cwl::InputSchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("InputSchema");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::IOSchema::toYaml(config));
-    return n;
-}
-inline void w3id_org::cwl::cwl::InputSchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::IOSchema::fromYaml(n);
-}
 inline w3id_org::cwl::cwl::OutputSchema::~OutputSchema() = default;
-inline auto w3id_org::cwl::cwl::OutputSchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("OutputSchema");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::IOSchema::toYaml(config));
-    return n;
-}
-inline void w3id_org::cwl::cwl::OutputSchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::IOSchema::fromYaml(n);
-}
-inline auto w3id_org::cwl::cwl::InputRecordField::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("InputRecordField");
-    }
-    {
-         auto member = toYaml(*doc, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "doc", member);
-    }
-    {
-         auto member = toYaml(*name, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "name", member);
-    }
-    {
-         auto member = toYaml(*type, config);
-         member = simplifyType(member, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "type", member);
-    }
-    {
-         auto member = toYaml(*label, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "label", member);
-    }
-    {
-         auto member = toYaml(*secondaryFiles, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "secondaryFiles", member);
-    }
-    {
-         auto member = toYaml(*streamable, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "streamable", member);
-    }
-    {
-         auto member = toYaml(*format, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "format", member);
-    }
-    {
-         auto member = toYaml(*loadContents, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "loadContents", member);
-    }
-    {
-         auto member = toYaml(*loadListing, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "loadListing", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::InputRecordField::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["doc"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *doc);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["name"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *name);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["type"], "", "");
-        auto expandedNode = expandType(nodeAsList);
-        fromYaml(expandedNode, *type);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["label"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *label);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["secondaryFiles"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *secondaryFiles);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["streamable"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *streamable);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["format"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *format);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["loadContents"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *loadContents);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["loadListing"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *loadListing);
-    }
-}
 namespace w3id_org::cwl {
 template <>
 struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::InputRecordField> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::InputRecordField> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::InputRecordField{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) try {
-            fromYaml(n["doc"], *res.doc);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.name)::value_t>::value) try {
-            fromYaml(n["name"], *res.name);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) try {
-            fromYaml(n["type"], *res.type);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) try {
-            fromYaml(n["label"], *res.label);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.secondaryFiles)::value_t>::value) try {
-            fromYaml(n["secondaryFiles"], *res.secondaryFiles);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.streamable)::value_t>::value) try {
-            fromYaml(n["streamable"], *res.streamable);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.format)::value_t>::value) try {
-            fromYaml(n["format"], *res.format);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.loadContents)::value_t>::value) try {
-            fromYaml(n["loadContents"], *res.loadContents);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.loadListing)::value_t>::value) try {
-            fromYaml(n["loadListing"], *res.loadListing);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::InputRecordField>;
 };
 }
-inline auto w3id_org::cwl::cwl::InputRecordSchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("InputRecordSchema");
-    }
-    {
-         auto member = toYaml(*fields, config);
-         member = convertListToMap(member, "name", "type", config);
-        addYamlField(n, "fields", member);
-    }
-    {
-         auto member = toYaml(*type, config);
-         member = simplifyType(member, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "type", member);
-    }
-    {
-         auto member = toYaml(*label, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "label", member);
-    }
-    {
-         auto member = toYaml(*doc, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "doc", member);
-    }
-    {
-         auto member = toYaml(*name, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "name", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::InputRecordSchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["fields"], "name", "type");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *fields);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["type"], "", "");
-        auto expandedNode = expandType(nodeAsList);
-        fromYaml(expandedNode, *type);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["label"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *label);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["doc"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *doc);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["name"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *name);
-    }
-}
 namespace w3id_org::cwl {
 template <>
 struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::InputRecordSchema> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::InputRecordSchema> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::InputRecordSchema{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.fields)::value_t>::value) try {
-            fromYaml(n["fields"], *res.fields);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) try {
-            fromYaml(n["type"], *res.type);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) try {
-            fromYaml(n["label"], *res.label);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) try {
-            fromYaml(n["doc"], *res.doc);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.name)::value_t>::value) try {
-            fromYaml(n["name"], *res.name);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::InputRecordSchema>;
 };
 }
-inline auto w3id_org::cwl::cwl::InputEnumSchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("InputEnumSchema");
-    }
-    n = mergeYaml(n, w3id_org::cwl::salad::EnumSchema::toYaml(config));
-    n = mergeYaml(n, w3id_org::cwl::cwl::InputSchema::toYaml(config));
-    return n;
-}
-inline void w3id_org::cwl::cwl::InputEnumSchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::salad::EnumSchema::fromYaml(n);
-    w3id_org::cwl::cwl::InputSchema::fromYaml(n);
-}
 namespace w3id_org::cwl {
 template <>
 struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::InputEnumSchema> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::InputEnumSchema> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::InputEnumSchema{};
-
-        return std::nullopt;
-    }
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::InputEnumSchema>;
 };
 }
-inline auto w3id_org::cwl::cwl::InputArraySchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("InputArraySchema");
-    }
-    {
-         auto member = toYaml(*items, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "items", member);
-    }
-    {
-         auto member = toYaml(*type, config);
-         member = simplifyType(member, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "type", member);
-    }
-    {
-         auto member = toYaml(*label, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "label", member);
-    }
-    {
-         auto member = toYaml(*doc, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "doc", member);
-    }
-    {
-         auto member = toYaml(*name, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "name", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::InputArraySchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["items"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *items);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["type"], "", "");
-        auto expandedNode = expandType(nodeAsList);
-        fromYaml(expandedNode, *type);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["label"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *label);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["doc"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *doc);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["name"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *name);
-    }
-}
 namespace w3id_org::cwl {
 template <>
 struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::InputArraySchema> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::InputArraySchema> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::InputArraySchema{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.items)::value_t>::value) try {
-            fromYaml(n["items"], *res.items);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) try {
-            fromYaml(n["type"], *res.type);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) try {
-            fromYaml(n["label"], *res.label);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) try {
-            fromYaml(n["doc"], *res.doc);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.name)::value_t>::value) try {
-            fromYaml(n["name"], *res.name);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::InputArraySchema>;
 };
 }
-inline auto w3id_org::cwl::cwl::OutputRecordField::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("OutputRecordField");
-    }
-    {
-         auto member = toYaml(*doc, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "doc", member);
-    }
-    {
-         auto member = toYaml(*name, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "name", member);
-    }
-    {
-         auto member = toYaml(*type, config);
-         member = simplifyType(member, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "type", member);
-    }
-    {
-         auto member = toYaml(*label, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "label", member);
-    }
-    {
-         auto member = toYaml(*secondaryFiles, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "secondaryFiles", member);
-    }
-    {
-         auto member = toYaml(*streamable, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "streamable", member);
-    }
-    {
-         auto member = toYaml(*format, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "format", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::OutputRecordField::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["doc"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *doc);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["name"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *name);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["type"], "", "");
-        auto expandedNode = expandType(nodeAsList);
-        fromYaml(expandedNode, *type);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["label"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *label);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["secondaryFiles"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *secondaryFiles);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["streamable"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *streamable);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["format"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *format);
-    }
-}
 namespace w3id_org::cwl {
 template <>
 struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::OutputRecordField> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::OutputRecordField> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::OutputRecordField{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) try {
-            fromYaml(n["doc"], *res.doc);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.name)::value_t>::value) try {
-            fromYaml(n["name"], *res.name);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) try {
-            fromYaml(n["type"], *res.type);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) try {
-            fromYaml(n["label"], *res.label);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.secondaryFiles)::value_t>::value) try {
-            fromYaml(n["secondaryFiles"], *res.secondaryFiles);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.streamable)::value_t>::value) try {
-            fromYaml(n["streamable"], *res.streamable);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.format)::value_t>::value) try {
-            fromYaml(n["format"], *res.format);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::OutputRecordField>;
 };
 }
-inline auto w3id_org::cwl::cwl::OutputRecordSchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("OutputRecordSchema");
-    }
-    {
-         auto member = toYaml(*fields, config);
-         member = convertListToMap(member, "name", "type", config);
-        addYamlField(n, "fields", member);
-    }
-    {
-         auto member = toYaml(*type, config);
-         member = simplifyType(member, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "type", member);
-    }
-    {
-         auto member = toYaml(*label, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "label", member);
-    }
-    {
-         auto member = toYaml(*doc, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "doc", member);
-    }
-    {
-         auto member = toYaml(*name, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "name", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::OutputRecordSchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["fields"], "name", "type");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *fields);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["type"], "", "");
-        auto expandedNode = expandType(nodeAsList);
-        fromYaml(expandedNode, *type);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["label"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *label);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["doc"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *doc);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["name"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *name);
-    }
-}
 namespace w3id_org::cwl {
 template <>
 struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::OutputRecordSchema> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::OutputRecordSchema> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::OutputRecordSchema{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.fields)::value_t>::value) try {
-            fromYaml(n["fields"], *res.fields);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) try {
-            fromYaml(n["type"], *res.type);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) try {
-            fromYaml(n["label"], *res.label);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) try {
-            fromYaml(n["doc"], *res.doc);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.name)::value_t>::value) try {
-            fromYaml(n["name"], *res.name);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::OutputRecordSchema>;
 };
 }
-inline auto w3id_org::cwl::cwl::OutputEnumSchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("OutputEnumSchema");
-    }
-    n = mergeYaml(n, w3id_org::cwl::salad::EnumSchema::toYaml(config));
-    n = mergeYaml(n, w3id_org::cwl::cwl::OutputSchema::toYaml(config));
-    return n;
-}
-inline void w3id_org::cwl::cwl::OutputEnumSchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::salad::EnumSchema::fromYaml(n);
-    w3id_org::cwl::cwl::OutputSchema::fromYaml(n);
-}
 namespace w3id_org::cwl {
 template <>
 struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::OutputEnumSchema> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::OutputEnumSchema> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::OutputEnumSchema{};
-
-        return std::nullopt;
-    }
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::OutputEnumSchema>;
 };
 }
-inline auto w3id_org::cwl::cwl::OutputArraySchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("OutputArraySchema");
-    }
-    {
-         auto member = toYaml(*items, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "items", member);
-    }
-    {
-         auto member = toYaml(*type, config);
-         member = simplifyType(member, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "type", member);
-    }
-    {
-         auto member = toYaml(*label, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "label", member);
-    }
-    {
-         auto member = toYaml(*doc, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "doc", member);
-    }
-    {
-         auto member = toYaml(*name, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "name", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::OutputArraySchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["items"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *items);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["type"], "", "");
-        auto expandedNode = expandType(nodeAsList);
-        fromYaml(expandedNode, *type);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["label"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *label);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["doc"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *doc);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["name"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *name);
-    }
-}
 namespace w3id_org::cwl {
 template <>
 struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::OutputArraySchema> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::OutputArraySchema> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::OutputArraySchema{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.items)::value_t>::value) try {
-            fromYaml(n["items"], *res.items);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) try {
-            fromYaml(n["type"], *res.type);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) try {
-            fromYaml(n["label"], *res.label);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) try {
-            fromYaml(n["doc"], *res.doc);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.name)::value_t>::value) try {
-            fromYaml(n["name"], *res.name);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::OutputArraySchema>;
 };
 }
 inline w3id_org::cwl::cwl::InputParameter::~InputParameter() = default;
-inline auto w3id_org::cwl::cwl::InputParameter::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("InputParameter");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::Parameter::toYaml(config));
-    n = mergeYaml(n, w3id_org::cwl::cwl::InputFormat::toYaml(config));
-    n = mergeYaml(n, w3id_org::cwl::cwl::LoadContents::toYaml(config));
-    {
-         auto member = toYaml(*default_, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "default", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::InputParameter::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::Parameter::fromYaml(n);
-    w3id_org::cwl::cwl::InputFormat::fromYaml(n);
-    w3id_org::cwl::cwl::LoadContents::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["default"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *default_);
-    }
-}
 inline w3id_org::cwl::cwl::OutputParameter::~OutputParameter() = default;
-inline auto w3id_org::cwl::cwl::OutputParameter::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("OutputParameter");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::Parameter::toYaml(config));
-    n = mergeYaml(n, w3id_org::cwl::cwl::OutputFormat::toYaml(config));
-    return n;
-}
-inline void w3id_org::cwl::cwl::OutputParameter::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::Parameter::fromYaml(n);
-    w3id_org::cwl::cwl::OutputFormat::fromYaml(n);
-}
 inline w3id_org::cwl::cwl::ProcessRequirement::~ProcessRequirement() = default;
-inline auto w3id_org::cwl::cwl::ProcessRequirement::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("ProcessRequirement");
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::ProcessRequirement::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-}
 inline w3id_org::cwl::cwl::Process::~Process() = default;
-inline auto w3id_org::cwl::cwl::Process::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("Process");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::Identified::toYaml(config));
-    n = mergeYaml(n, w3id_org::cwl::cwl::Labeled::toYaml(config));
-    n = mergeYaml(n, w3id_org::cwl::salad::Documented::toYaml(config));
-    {
-         auto member = toYaml(*inputs, config);
-         member = convertListToMap(member, "id", "type", config);
-        addYamlField(n, "inputs", member);
-    }
-    {
-         auto member = toYaml(*outputs, config);
-         member = convertListToMap(member, "id", "type", config);
-        addYamlField(n, "outputs", member);
-    }
-    {
-         auto member = toYaml(*requirements, config);
-         member = convertListToMap(member, "class", "", config);
-        addYamlField(n, "requirements", member);
-    }
-    {
-         auto member = toYaml(*hints, config);
-         member = convertListToMap(member, "class", "", config);
-        addYamlField(n, "hints", member);
-    }
-    {
-         auto member = toYaml(*cwlVersion, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "cwlVersion", member);
-    }
-    {
-         auto member = toYaml(*intent, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "intent", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::Process::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::Identified::fromYaml(n);
-    w3id_org::cwl::cwl::Labeled::fromYaml(n);
-    w3id_org::cwl::salad::Documented::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["inputs"], "id", "type");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *inputs);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["outputs"], "id", "type");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *outputs);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["requirements"], "class", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *requirements);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["hints"], "class", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *hints);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["cwlVersion"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *cwlVersion);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["intent"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *intent);
-    }
-}
-inline auto w3id_org::cwl::cwl::InlineJavascriptRequirement::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("InlineJavascriptRequirement");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
-    {
-         auto member = toYaml(*class_, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "class", member);
-    }
-    {
-         auto member = toYaml(*expressionLib, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "expressionLib", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::InlineJavascriptRequirement::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["class"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *class_);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["expressionLib"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *expressionLib);
-    }
-}
-namespace w3id_org::cwl {
-template <>
-struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::InlineJavascriptRequirement> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::InlineJavascriptRequirement> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::InlineJavascriptRequirement{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) try {
-            fromYaml(n["class"], *res.class_);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.expressionLib)::value_t>::value) try {
-            fromYaml(n["expressionLib"], *res.expressionLib);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
-};
+namespace w3id_org::cwl {
+template <>
+struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::InlineJavascriptRequirement> {
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::InlineJavascriptRequirement>;
+};
 }
 inline w3id_org::cwl::cwl::CommandInputSchema::~CommandInputSchema() = default;
-inline auto w3id_org::cwl::cwl::CommandInputSchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("CommandInputSchema");
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::CommandInputSchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-}
-inline auto w3id_org::cwl::cwl::SchemaDefRequirement::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("SchemaDefRequirement");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
-    {
-         auto member = toYaml(*class_, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "class", member);
-    }
-    {
-         auto member = toYaml(*types, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "types", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::SchemaDefRequirement::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["class"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *class_);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["types"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *types);
-    }
-}
 namespace w3id_org::cwl {
 template <>
 struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::SchemaDefRequirement> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::SchemaDefRequirement> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::SchemaDefRequirement{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) try {
-            fromYaml(n["class"], *res.class_);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.types)::value_t>::value) try {
-            fromYaml(n["types"], *res.types);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::SchemaDefRequirement>;
 };
 }
-inline auto w3id_org::cwl::cwl::SecondaryFileSchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("SecondaryFileSchema");
-    }
-    {
-         auto member = toYaml(*pattern, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "pattern", member);
-    }
-    {
-         auto member = toYaml(*required, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "required", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::SecondaryFileSchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["pattern"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *pattern);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["required"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *required);
-    }
-}
 namespace w3id_org::cwl {
 template <>
 struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::SecondaryFileSchema> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::SecondaryFileSchema> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::SecondaryFileSchema{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.pattern)::value_t>::value) try {
-            fromYaml(n["pattern"], *res.pattern);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.required)::value_t>::value) try {
-            fromYaml(n["required"], *res.required);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::SecondaryFileSchema>;
 };
 }
-inline auto w3id_org::cwl::cwl::LoadListingRequirement::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("LoadListingRequirement");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
-    {
-         auto member = toYaml(*class_, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "class", member);
-    }
-    {
-         auto member = toYaml(*loadListing, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "loadListing", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::LoadListingRequirement::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["class"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *class_);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["loadListing"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *loadListing);
-    }
-}
 namespace w3id_org::cwl {
 template <>
 struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::LoadListingRequirement> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::LoadListingRequirement> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::LoadListingRequirement{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) try {
-            fromYaml(n["class"], *res.class_);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.loadListing)::value_t>::value) try {
-            fromYaml(n["loadListing"], *res.loadListing);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::LoadListingRequirement>;
 };
 }
-inline auto w3id_org::cwl::cwl::EnvironmentDef::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("EnvironmentDef");
-    }
-    {
-         auto member = toYaml(*envName, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "envName", member);
-    }
-    {
-         auto member = toYaml(*envValue, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "envValue", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::EnvironmentDef::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["envName"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *envName);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["envValue"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *envValue);
-    }
-}
 namespace w3id_org::cwl {
 template <>
 struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::EnvironmentDef> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::EnvironmentDef> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::EnvironmentDef{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.envName)::value_t>::value) try {
-            fromYaml(n["envName"], *res.envName);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.envValue)::value_t>::value) try {
-            fromYaml(n["envValue"], *res.envValue);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::EnvironmentDef>;
 };
 }
-inline auto w3id_org::cwl::cwl::CommandLineBinding::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("CommandLineBinding");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::InputBinding::toYaml(config));
-    {
-         auto member = toYaml(*position, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "position", member);
-    }
-    {
-         auto member = toYaml(*prefix, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "prefix", member);
-    }
-    {
-         auto member = toYaml(*separate, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "separate", member);
-    }
-    {
-         auto member = toYaml(*itemSeparator, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "itemSeparator", member);
-    }
-    {
-         auto member = toYaml(*valueFrom, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "valueFrom", member);
-    }
-    {
-         auto member = toYaml(*shellQuote, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "shellQuote", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::CommandLineBinding::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::InputBinding::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["position"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *position);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["prefix"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *prefix);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["separate"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *separate);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["itemSeparator"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *itemSeparator);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["valueFrom"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *valueFrom);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["shellQuote"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *shellQuote);
-    }
-}
 namespace w3id_org::cwl {
 template <>
 struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandLineBinding> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandLineBinding> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::CommandLineBinding{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.position)::value_t>::value) try {
-            fromYaml(n["position"], *res.position);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.prefix)::value_t>::value) try {
-            fromYaml(n["prefix"], *res.prefix);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.separate)::value_t>::value) try {
-            fromYaml(n["separate"], *res.separate);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.itemSeparator)::value_t>::value) try {
-            fromYaml(n["itemSeparator"], *res.itemSeparator);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.valueFrom)::value_t>::value) try {
-            fromYaml(n["valueFrom"], *res.valueFrom);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.shellQuote)::value_t>::value) try {
-            fromYaml(n["shellQuote"], *res.shellQuote);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandLineBinding>;
 };
 }
-inline auto w3id_org::cwl::cwl::CommandOutputBinding::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("CommandOutputBinding");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::LoadContents::toYaml(config));
-    {
-         auto member = toYaml(*glob, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "glob", member);
-    }
-    {
-         auto member = toYaml(*outputEval, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "outputEval", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::CommandOutputBinding::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::LoadContents::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["glob"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *glob);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["outputEval"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *outputEval);
-    }
-}
 namespace w3id_org::cwl {
 template <>
 struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandOutputBinding> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandOutputBinding> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::CommandOutputBinding{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.glob)::value_t>::value) try {
-            fromYaml(n["glob"], *res.glob);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.outputEval)::value_t>::value) try {
-            fromYaml(n["outputEval"], *res.outputEval);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
-};
-}
-inline auto w3id_org::cwl::cwl::CommandLineBindable::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("CommandLineBindable");
-    }
-    {
-         auto member = toYaml(*inputBinding, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "inputBinding", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::CommandLineBindable::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["inputBinding"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *inputBinding);
-    }
-}
-namespace w3id_org::cwl {
-template <>
-struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandLineBindable> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandLineBindable> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::CommandLineBindable{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.inputBinding)::value_t>::value) try {
-            fromYaml(n["inputBinding"], *res.inputBinding);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
-};
-}
-inline auto w3id_org::cwl::cwl::CommandInputRecordField::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("CommandInputRecordField");
-    }
-    {
-         auto member = toYaml(*doc, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "doc", member);
-    }
-    {
-         auto member = toYaml(*name, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "name", member);
-    }
-    {
-         auto member = toYaml(*type, config);
-         member = simplifyType(member, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "type", member);
-    }
-    {
-         auto member = toYaml(*label, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "label", member);
-    }
-    {
-         auto member = toYaml(*secondaryFiles, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "secondaryFiles", member);
-    }
-    {
-         auto member = toYaml(*streamable, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "streamable", member);
-    }
-    {
-         auto member = toYaml(*format, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "format", member);
-    }
-    {
-         auto member = toYaml(*loadContents, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "loadContents", member);
-    }
-    {
-         auto member = toYaml(*loadListing, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "loadListing", member);
-    }
-    {
-         auto member = toYaml(*inputBinding, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "inputBinding", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::CommandInputRecordField::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["doc"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *doc);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["name"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *name);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["type"], "", "");
-        auto expandedNode = expandType(nodeAsList);
-        fromYaml(expandedNode, *type);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["label"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *label);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["secondaryFiles"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *secondaryFiles);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["streamable"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *streamable);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["format"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *format);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["loadContents"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *loadContents);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["loadListing"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *loadListing);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["inputBinding"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *inputBinding);
-    }
-}
-namespace w3id_org::cwl {
-template <>
-struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandInputRecordField> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandInputRecordField> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::CommandInputRecordField{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) try {
-            fromYaml(n["doc"], *res.doc);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.name)::value_t>::value) try {
-            fromYaml(n["name"], *res.name);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) try {
-            fromYaml(n["type"], *res.type);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) try {
-            fromYaml(n["label"], *res.label);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.secondaryFiles)::value_t>::value) try {
-            fromYaml(n["secondaryFiles"], *res.secondaryFiles);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.streamable)::value_t>::value) try {
-            fromYaml(n["streamable"], *res.streamable);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.format)::value_t>::value) try {
-            fromYaml(n["format"], *res.format);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.loadContents)::value_t>::value) try {
-            fromYaml(n["loadContents"], *res.loadContents);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.loadListing)::value_t>::value) try {
-            fromYaml(n["loadListing"], *res.loadListing);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.inputBinding)::value_t>::value) try {
-            fromYaml(n["inputBinding"], *res.inputBinding);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandOutputBinding>;
 };
 }
-inline auto w3id_org::cwl::cwl::CommandInputRecordSchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("CommandInputRecordSchema");
-    }
-    {
-         auto member = toYaml(*fields, config);
-         member = convertListToMap(member, "name", "type", config);
-        addYamlField(n, "fields", member);
-    }
-    {
-         auto member = toYaml(*type, config);
-         member = simplifyType(member, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "type", member);
-    }
-    {
-         auto member = toYaml(*label, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "label", member);
-    }
-    {
-         auto member = toYaml(*doc, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "doc", member);
-    }
-    {
-         auto member = toYaml(*name, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "name", member);
-    }
-    {
-         auto member = toYaml(*inputBinding, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "inputBinding", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::CommandInputRecordSchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["fields"], "name", "type");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *fields);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["type"], "", "");
-        auto expandedNode = expandType(nodeAsList);
-        fromYaml(expandedNode, *type);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["label"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *label);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["doc"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *doc);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["name"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *name);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["inputBinding"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *inputBinding);
-    }
-}
-namespace w3id_org::cwl {
-template <>
-struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandInputRecordSchema> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandInputRecordSchema> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::CommandInputRecordSchema{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.fields)::value_t>::value) try {
-            fromYaml(n["fields"], *res.fields);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) try {
-            fromYaml(n["type"], *res.type);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) try {
-            fromYaml(n["label"], *res.label);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) try {
-            fromYaml(n["doc"], *res.doc);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.name)::value_t>::value) try {
-            fromYaml(n["name"], *res.name);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.inputBinding)::value_t>::value) try {
-            fromYaml(n["inputBinding"], *res.inputBinding);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
-};
-}
-inline auto w3id_org::cwl::cwl::CommandInputEnumSchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("CommandInputEnumSchema");
-    }
-    {
-         auto member = toYaml(*name, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "name", member);
-    }
-    {
-         auto member = toYaml(*symbols, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "symbols", member);
-    }
-    {
-         auto member = toYaml(*type, config);
-         member = simplifyType(member, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "type", member);
-    }
-    {
-         auto member = toYaml(*label, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "label", member);
-    }
-    {
-         auto member = toYaml(*doc, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "doc", member);
-    }
-    {
-         auto member = toYaml(*inputBinding, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "inputBinding", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::CommandInputEnumSchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["name"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *name);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["symbols"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *symbols);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["type"], "", "");
-        auto expandedNode = expandType(nodeAsList);
-        fromYaml(expandedNode, *type);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["label"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *label);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["doc"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *doc);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["inputBinding"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *inputBinding);
-    }
-}
-namespace w3id_org::cwl {
-template <>
-struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandInputEnumSchema> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandInputEnumSchema> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::CommandInputEnumSchema{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.name)::value_t>::value) try {
-            fromYaml(n["name"], *res.name);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.symbols)::value_t>::value) try {
-            fromYaml(n["symbols"], *res.symbols);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) try {
-            fromYaml(n["type"], *res.type);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) try {
-            fromYaml(n["label"], *res.label);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) try {
-            fromYaml(n["doc"], *res.doc);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.inputBinding)::value_t>::value) try {
-            fromYaml(n["inputBinding"], *res.inputBinding);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
-};
-}
-inline auto w3id_org::cwl::cwl::CommandInputArraySchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("CommandInputArraySchema");
-    }
-    {
-         auto member = toYaml(*items, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "items", member);
-    }
-    {
-         auto member = toYaml(*type, config);
-         member = simplifyType(member, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "type", member);
-    }
-    {
-         auto member = toYaml(*label, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "label", member);
-    }
-    {
-         auto member = toYaml(*doc, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "doc", member);
-    }
-    {
-         auto member = toYaml(*name, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "name", member);
-    }
-    {
-         auto member = toYaml(*inputBinding, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "inputBinding", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::CommandInputArraySchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["items"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *items);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["type"], "", "");
-        auto expandedNode = expandType(nodeAsList);
-        fromYaml(expandedNode, *type);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["label"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *label);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["doc"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *doc);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["name"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *name);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["inputBinding"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *inputBinding);
-    }
-}
-namespace w3id_org::cwl {
-template <>
-struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandInputArraySchema> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandInputArraySchema> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::CommandInputArraySchema{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.items)::value_t>::value) try {
-            fromYaml(n["items"], *res.items);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) try {
-            fromYaml(n["type"], *res.type);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) try {
-            fromYaml(n["label"], *res.label);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) try {
-            fromYaml(n["doc"], *res.doc);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.name)::value_t>::value) try {
-            fromYaml(n["name"], *res.name);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.inputBinding)::value_t>::value) try {
-            fromYaml(n["inputBinding"], *res.inputBinding);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
-};
-}
-inline auto w3id_org::cwl::cwl::CommandOutputRecordField::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("CommandOutputRecordField");
-    }
-    {
-         auto member = toYaml(*doc, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "doc", member);
-    }
-    {
-         auto member = toYaml(*name, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "name", member);
-    }
-    {
-         auto member = toYaml(*type, config);
-         member = simplifyType(member, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "type", member);
-    }
-    {
-         auto member = toYaml(*label, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "label", member);
-    }
-    {
-         auto member = toYaml(*secondaryFiles, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "secondaryFiles", member);
-    }
-    {
-         auto member = toYaml(*streamable, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "streamable", member);
-    }
-    {
-         auto member = toYaml(*format, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "format", member);
-    }
-    {
-         auto member = toYaml(*outputBinding, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "outputBinding", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::CommandOutputRecordField::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["doc"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *doc);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["name"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *name);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["type"], "", "");
-        auto expandedNode = expandType(nodeAsList);
-        fromYaml(expandedNode, *type);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["label"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *label);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["secondaryFiles"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *secondaryFiles);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["streamable"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *streamable);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["format"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *format);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["outputBinding"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *outputBinding);
-    }
-}
-namespace w3id_org::cwl {
-template <>
-struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandOutputRecordField> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandOutputRecordField> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::CommandOutputRecordField{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) try {
-            fromYaml(n["doc"], *res.doc);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.name)::value_t>::value) try {
-            fromYaml(n["name"], *res.name);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) try {
-            fromYaml(n["type"], *res.type);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) try {
-            fromYaml(n["label"], *res.label);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.secondaryFiles)::value_t>::value) try {
-            fromYaml(n["secondaryFiles"], *res.secondaryFiles);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.streamable)::value_t>::value) try {
-            fromYaml(n["streamable"], *res.streamable);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.format)::value_t>::value) try {
-            fromYaml(n["format"], *res.format);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.outputBinding)::value_t>::value) try {
-            fromYaml(n["outputBinding"], *res.outputBinding);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
-};
-}
-inline auto w3id_org::cwl::cwl::CommandOutputRecordSchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("CommandOutputRecordSchema");
-    }
-    {
-         auto member = toYaml(*fields, config);
-         member = convertListToMap(member, "name", "type", config);
-        addYamlField(n, "fields", member);
-    }
-    {
-         auto member = toYaml(*type, config);
-         member = simplifyType(member, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "type", member);
-    }
-    {
-         auto member = toYaml(*label, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "label", member);
-    }
-    {
-         auto member = toYaml(*doc, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "doc", member);
-    }
-    {
-         auto member = toYaml(*name, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "name", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::CommandOutputRecordSchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["fields"], "name", "type");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *fields);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["type"], "", "");
-        auto expandedNode = expandType(nodeAsList);
-        fromYaml(expandedNode, *type);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["label"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *label);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["doc"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *doc);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["name"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *name);
-    }
-}
-namespace w3id_org::cwl {
-template <>
-struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandOutputRecordSchema> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandOutputRecordSchema> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::CommandOutputRecordSchema{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.fields)::value_t>::value) try {
-            fromYaml(n["fields"], *res.fields);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) try {
-            fromYaml(n["type"], *res.type);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) try {
-            fromYaml(n["label"], *res.label);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) try {
-            fromYaml(n["doc"], *res.doc);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.name)::value_t>::value) try {
-            fromYaml(n["name"], *res.name);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
-};
-}
-inline auto w3id_org::cwl::cwl::CommandOutputEnumSchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("CommandOutputEnumSchema");
-    }
-    {
-         auto member = toYaml(*name, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "name", member);
-    }
-    {
-         auto member = toYaml(*symbols, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "symbols", member);
-    }
-    {
-         auto member = toYaml(*type, config);
-         member = simplifyType(member, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "type", member);
-    }
-    {
-         auto member = toYaml(*label, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "label", member);
-    }
-    {
-         auto member = toYaml(*doc, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "doc", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::CommandOutputEnumSchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["name"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *name);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["symbols"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *symbols);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["type"], "", "");
-        auto expandedNode = expandType(nodeAsList);
-        fromYaml(expandedNode, *type);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["label"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *label);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["doc"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *doc);
-    }
-}
-namespace w3id_org::cwl {
-template <>
-struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandOutputEnumSchema> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandOutputEnumSchema> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::CommandOutputEnumSchema{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.name)::value_t>::value) try {
-            fromYaml(n["name"], *res.name);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.symbols)::value_t>::value) try {
-            fromYaml(n["symbols"], *res.symbols);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) try {
-            fromYaml(n["type"], *res.type);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) try {
-            fromYaml(n["label"], *res.label);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) try {
-            fromYaml(n["doc"], *res.doc);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
-};
-}
-inline auto w3id_org::cwl::cwl::CommandOutputArraySchema::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("CommandOutputArraySchema");
-    }
-    {
-         auto member = toYaml(*items, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "items", member);
-    }
-    {
-         auto member = toYaml(*type, config);
-         member = simplifyType(member, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "type", member);
-    }
-    {
-         auto member = toYaml(*label, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "label", member);
-    }
-    {
-         auto member = toYaml(*doc, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "doc", member);
-    }
-    {
-         auto member = toYaml(*name, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "name", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::CommandOutputArraySchema::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["items"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *items);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["type"], "", "");
-        auto expandedNode = expandType(nodeAsList);
-        fromYaml(expandedNode, *type);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["label"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *label);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["doc"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *doc);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["name"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *name);
-    }
-}
-namespace w3id_org::cwl {
-template <>
-struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandOutputArraySchema> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandOutputArraySchema> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::CommandOutputArraySchema{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.items)::value_t>::value) try {
-            fromYaml(n["items"], *res.items);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) try {
-            fromYaml(n["type"], *res.type);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) try {
-            fromYaml(n["label"], *res.label);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) try {
-            fromYaml(n["doc"], *res.doc);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.name)::value_t>::value) try {
-            fromYaml(n["name"], *res.name);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
-};
-}
-inline auto w3id_org::cwl::cwl::CommandInputParameter::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("CommandInputParameter");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::InputParameter::toYaml(config));
-    {
-         auto member = toYaml(*type, config);
-         member = simplifyType(member, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "type", member);
-    }
-    {
-         auto member = toYaml(*inputBinding, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "inputBinding", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::CommandInputParameter::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::InputParameter::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["type"], "", "");
-        auto expandedNode = expandType(nodeAsList);
-        fromYaml(expandedNode, *type);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["inputBinding"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *inputBinding);
-    }
-}
-namespace w3id_org::cwl {
-template <>
-struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandInputParameter> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandInputParameter> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::CommandInputParameter{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) try {
-            fromYaml(n["type"], *res.type);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.inputBinding)::value_t>::value) try {
-            fromYaml(n["inputBinding"], *res.inputBinding);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
-};
-}
-inline auto w3id_org::cwl::cwl::CommandOutputParameter::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("CommandOutputParameter");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::OutputParameter::toYaml(config));
-    {
-         auto member = toYaml(*type, config);
-         member = simplifyType(member, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "type", member);
-    }
-    {
-         auto member = toYaml(*outputBinding, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "outputBinding", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::CommandOutputParameter::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::OutputParameter::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["type"], "", "");
-        auto expandedNode = expandType(nodeAsList);
-        fromYaml(expandedNode, *type);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["outputBinding"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *outputBinding);
-    }
-}
-namespace w3id_org::cwl {
-template <>
-struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandOutputParameter> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandOutputParameter> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::CommandOutputParameter{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) try {
-            fromYaml(n["type"], *res.type);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.outputBinding)::value_t>::value) try {
-            fromYaml(n["outputBinding"], *res.outputBinding);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
-};
-}
-inline auto w3id_org::cwl::cwl::CommandLineTool::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("CommandLineTool");
-    }
-    {
-         auto member = toYaml(*id, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "id", member);
-    }
-    {
-         auto member = toYaml(*label, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "label", member);
-    }
-    {
-         auto member = toYaml(*doc, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "doc", member);
-    }
-    {
-         auto member = toYaml(*inputs, config);
-         member = convertListToMap(member, "id", "type", config);
-        addYamlField(n, "inputs", member);
-    }
-    {
-         auto member = toYaml(*outputs, config);
-         member = convertListToMap(member, "id", "type", config);
-        addYamlField(n, "outputs", member);
-    }
-    {
-         auto member = toYaml(*requirements, config);
-         member = convertListToMap(member, "class", "", config);
-        addYamlField(n, "requirements", member);
-    }
-    {
-         auto member = toYaml(*hints, config);
-         member = convertListToMap(member, "class", "", config);
-        addYamlField(n, "hints", member);
-    }
-    {
-         auto member = toYaml(*cwlVersion, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "cwlVersion", member);
-    }
-    {
-         auto member = toYaml(*intent, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "intent", member);
-    }
-    {
-         auto member = toYaml(*class_, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "class", member);
-    }
-    {
-         auto member = toYaml(*baseCommand, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "baseCommand", member);
-    }
-    {
-         auto member = toYaml(*arguments, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "arguments", member);
-    }
-    {
-         auto member = toYaml(*stdin_, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "stdin", member);
-    }
-    {
-         auto member = toYaml(*stderr_, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "stderr", member);
-    }
-    {
-         auto member = toYaml(*stdout_, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "stdout", member);
-    }
-    {
-         auto member = toYaml(*successCodes, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "successCodes", member);
-    }
-    {
-         auto member = toYaml(*temporaryFailCodes, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "temporaryFailCodes", member);
-    }
-    {
-         auto member = toYaml(*permanentFailCodes, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "permanentFailCodes", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::CommandLineTool::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["id"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *id);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["label"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *label);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["doc"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *doc);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["inputs"], "id", "type");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *inputs);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["outputs"], "id", "type");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *outputs);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["requirements"], "class", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *requirements);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["hints"], "class", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *hints);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["cwlVersion"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *cwlVersion);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["intent"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *intent);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["class"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *class_);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["baseCommand"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *baseCommand);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["arguments"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *arguments);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["stdin"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *stdin_);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["stderr"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *stderr_);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["stdout"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *stdout_);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["successCodes"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *successCodes);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["temporaryFailCodes"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *temporaryFailCodes);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["permanentFailCodes"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *permanentFailCodes);
-    }
-}
-namespace w3id_org::cwl {
-template <>
-struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandLineTool> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandLineTool> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::CommandLineTool{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.id)::value_t>::value) try {
-            fromYaml(n["id"], *res.id);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) try {
-            fromYaml(n["label"], *res.label);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) try {
-            fromYaml(n["doc"], *res.doc);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.inputs)::value_t>::value) try {
-            fromYaml(n["inputs"], *res.inputs);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.outputs)::value_t>::value) try {
-            fromYaml(n["outputs"], *res.outputs);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.requirements)::value_t>::value) try {
-            fromYaml(n["requirements"], *res.requirements);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.hints)::value_t>::value) try {
-            fromYaml(n["hints"], *res.hints);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.cwlVersion)::value_t>::value) try {
-            fromYaml(n["cwlVersion"], *res.cwlVersion);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.intent)::value_t>::value) try {
-            fromYaml(n["intent"], *res.intent);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) try {
-            fromYaml(n["class"], *res.class_);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.baseCommand)::value_t>::value) try {
-            fromYaml(n["baseCommand"], *res.baseCommand);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.arguments)::value_t>::value) try {
-            fromYaml(n["arguments"], *res.arguments);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.stdin_)::value_t>::value) try {
-            fromYaml(n["stdin"], *res.stdin_);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.stderr_)::value_t>::value) try {
-            fromYaml(n["stderr"], *res.stderr_);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.stdout_)::value_t>::value) try {
-            fromYaml(n["stdout"], *res.stdout_);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.successCodes)::value_t>::value) try {
-            fromYaml(n["successCodes"], *res.successCodes);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.temporaryFailCodes)::value_t>::value) try {
-            fromYaml(n["temporaryFailCodes"], *res.temporaryFailCodes);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.permanentFailCodes)::value_t>::value) try {
-            fromYaml(n["permanentFailCodes"], *res.permanentFailCodes);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
-};
-}
-inline auto w3id_org::cwl::cwl::DockerRequirement::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("DockerRequirement");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
-    {
-         auto member = toYaml(*class_, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "class", member);
-    }
-    {
-         auto member = toYaml(*dockerPull, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "dockerPull", member);
-    }
-    {
-         auto member = toYaml(*dockerLoad, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "dockerLoad", member);
-    }
-    {
-         auto member = toYaml(*dockerFile, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "dockerFile", member);
-    }
-    {
-         auto member = toYaml(*dockerImport, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "dockerImport", member);
-    }
-    {
-         auto member = toYaml(*dockerImageId, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "dockerImageId", member);
-    }
-    {
-         auto member = toYaml(*dockerOutputDirectory, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "dockerOutputDirectory", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::DockerRequirement::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["class"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *class_);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["dockerPull"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *dockerPull);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["dockerLoad"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *dockerLoad);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["dockerFile"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *dockerFile);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["dockerImport"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *dockerImport);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["dockerImageId"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *dockerImageId);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["dockerOutputDirectory"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *dockerOutputDirectory);
-    }
-}
-namespace w3id_org::cwl {
-template <>
-struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::DockerRequirement> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::DockerRequirement> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::DockerRequirement{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) try {
-            fromYaml(n["class"], *res.class_);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.dockerPull)::value_t>::value) try {
-            fromYaml(n["dockerPull"], *res.dockerPull);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.dockerLoad)::value_t>::value) try {
-            fromYaml(n["dockerLoad"], *res.dockerLoad);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.dockerFile)::value_t>::value) try {
-            fromYaml(n["dockerFile"], *res.dockerFile);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.dockerImport)::value_t>::value) try {
-            fromYaml(n["dockerImport"], *res.dockerImport);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.dockerImageId)::value_t>::value) try {
-            fromYaml(n["dockerImageId"], *res.dockerImageId);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.dockerOutputDirectory)::value_t>::value) try {
-            fromYaml(n["dockerOutputDirectory"], *res.dockerOutputDirectory);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
-};
-}
-inline auto w3id_org::cwl::cwl::SoftwareRequirement::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("SoftwareRequirement");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
-    {
-         auto member = toYaml(*class_, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "class", member);
-    }
-    {
-         auto member = toYaml(*packages, config);
-         member = convertListToMap(member, "package", "specs", config);
-        addYamlField(n, "packages", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::SoftwareRequirement::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["class"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *class_);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["packages"], "package", "specs");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *packages);
-    }
-}
-namespace w3id_org::cwl {
-template <>
-struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::SoftwareRequirement> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::SoftwareRequirement> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::SoftwareRequirement{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) try {
-            fromYaml(n["class"], *res.class_);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.packages)::value_t>::value) try {
-            fromYaml(n["packages"], *res.packages);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
-};
-}
-inline auto w3id_org::cwl::cwl::SoftwarePackage::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("SoftwarePackage");
-    }
-    {
-         auto member = toYaml(*package, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "package", member);
-    }
-    {
-         auto member = toYaml(*version, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "version", member);
-    }
-    {
-         auto member = toYaml(*specs, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "specs", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::SoftwarePackage::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["package"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *package);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["version"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *version);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["specs"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *specs);
-    }
-}
-namespace w3id_org::cwl {
-template <>
-struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::SoftwarePackage> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::SoftwarePackage> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::SoftwarePackage{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.package)::value_t>::value) try {
-            fromYaml(n["package"], *res.package);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.version)::value_t>::value) try {
-            fromYaml(n["version"], *res.version);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.specs)::value_t>::value) try {
-            fromYaml(n["specs"], *res.specs);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
-};
-}
-inline auto w3id_org::cwl::cwl::Dirent::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("Dirent");
-    }
-    {
-         auto member = toYaml(*entryname, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "entryname", member);
-    }
-    {
-         auto member = toYaml(*entry, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "entry", member);
-    }
-    {
-         auto member = toYaml(*writable, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "writable", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::Dirent::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["entryname"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *entryname);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["entry"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *entry);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["writable"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *writable);
-    }
-}
-namespace w3id_org::cwl {
-template <>
-struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::Dirent> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::Dirent> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::Dirent{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.entryname)::value_t>::value) try {
-            fromYaml(n["entryname"], *res.entryname);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.entry)::value_t>::value) try {
-            fromYaml(n["entry"], *res.entry);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.writable)::value_t>::value) try {
-            fromYaml(n["writable"], *res.writable);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
-};
-}
-inline auto w3id_org::cwl::cwl::InitialWorkDirRequirement::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("InitialWorkDirRequirement");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
-    {
-         auto member = toYaml(*class_, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "class", member);
-    }
-    {
-         auto member = toYaml(*listing, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "listing", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::InitialWorkDirRequirement::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["class"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *class_);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["listing"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *listing);
-    }
-}
-namespace w3id_org::cwl {
-template <>
-struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::InitialWorkDirRequirement> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::InitialWorkDirRequirement> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::InitialWorkDirRequirement{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) try {
-            fromYaml(n["class"], *res.class_);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.listing)::value_t>::value) try {
-            fromYaml(n["listing"], *res.listing);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
-};
-}
-inline auto w3id_org::cwl::cwl::EnvVarRequirement::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("EnvVarRequirement");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
-    {
-         auto member = toYaml(*class_, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "class", member);
-    }
-    {
-         auto member = toYaml(*envDef, config);
-         member = convertListToMap(member, "envName", "envValue", config);
-        addYamlField(n, "envDef", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::EnvVarRequirement::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["class"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *class_);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["envDef"], "envName", "envValue");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *envDef);
-    }
-}
-namespace w3id_org::cwl {
-template <>
-struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::EnvVarRequirement> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::EnvVarRequirement> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::EnvVarRequirement{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) try {
-            fromYaml(n["class"], *res.class_);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.envDef)::value_t>::value) try {
-            fromYaml(n["envDef"], *res.envDef);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
-};
-}
-inline auto w3id_org::cwl::cwl::ShellCommandRequirement::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("ShellCommandRequirement");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
-    {
-         auto member = toYaml(*class_, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "class", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::ShellCommandRequirement::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["class"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *class_);
-    }
-}
-namespace w3id_org::cwl {
-template <>
-struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::ShellCommandRequirement> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::ShellCommandRequirement> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::ShellCommandRequirement{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) try {
-            fromYaml(n["class"], *res.class_);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
-};
-}
-inline auto w3id_org::cwl::cwl::ResourceRequirement::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("ResourceRequirement");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
-    {
-         auto member = toYaml(*class_, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "class", member);
-    }
-    {
-         auto member = toYaml(*coresMin, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "coresMin", member);
-    }
-    {
-         auto member = toYaml(*coresMax, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "coresMax", member);
-    }
-    {
-         auto member = toYaml(*ramMin, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "ramMin", member);
-    }
-    {
-         auto member = toYaml(*ramMax, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "ramMax", member);
-    }
-    {
-         auto member = toYaml(*tmpdirMin, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "tmpdirMin", member);
-    }
-    {
-         auto member = toYaml(*tmpdirMax, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "tmpdirMax", member);
-    }
-    {
-         auto member = toYaml(*outdirMin, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "outdirMin", member);
-    }
-    {
-         auto member = toYaml(*outdirMax, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "outdirMax", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::ResourceRequirement::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["class"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *class_);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["coresMin"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *coresMin);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["coresMax"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *coresMax);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["ramMin"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *ramMin);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["ramMax"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *ramMax);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["tmpdirMin"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *tmpdirMin);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["tmpdirMax"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *tmpdirMax);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["outdirMin"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *outdirMin);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["outdirMax"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *outdirMax);
-    }
-}
-namespace w3id_org::cwl {
-template <>
-struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::ResourceRequirement> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::ResourceRequirement> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::ResourceRequirement{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) try {
-            fromYaml(n["class"], *res.class_);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.coresMin)::value_t>::value) try {
-            fromYaml(n["coresMin"], *res.coresMin);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.coresMax)::value_t>::value) try {
-            fromYaml(n["coresMax"], *res.coresMax);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.ramMin)::value_t>::value) try {
-            fromYaml(n["ramMin"], *res.ramMin);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.ramMax)::value_t>::value) try {
-            fromYaml(n["ramMax"], *res.ramMax);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.tmpdirMin)::value_t>::value) try {
-            fromYaml(n["tmpdirMin"], *res.tmpdirMin);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.tmpdirMax)::value_t>::value) try {
-            fromYaml(n["tmpdirMax"], *res.tmpdirMax);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.outdirMin)::value_t>::value) try {
-            fromYaml(n["outdirMin"], *res.outdirMin);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.outdirMax)::value_t>::value) try {
-            fromYaml(n["outdirMax"], *res.outdirMax);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
-};
-}
-inline auto w3id_org::cwl::cwl::WorkReuse::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("WorkReuse");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
-    {
-         auto member = toYaml(*class_, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "class", member);
-    }
-    {
-         auto member = toYaml(*enableReuse, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "enableReuse", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::WorkReuse::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["class"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *class_);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["enableReuse"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *enableReuse);
-    }
-}
 namespace w3id_org::cwl {
 template <>
-struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::WorkReuse> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::WorkReuse> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::WorkReuse{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) try {
-            fromYaml(n["class"], *res.class_);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.enableReuse)::value_t>::value) try {
-            fromYaml(n["enableReuse"], *res.enableReuse);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandLineBindable> {
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandLineBindable>;
 };
 }
-inline auto w3id_org::cwl::cwl::NetworkAccess::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("NetworkAccess");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
-    {
-         auto member = toYaml(*class_, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "class", member);
-    }
-    {
-         auto member = toYaml(*networkAccess, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "networkAccess", member);
-    }
-    return n;
+namespace w3id_org::cwl {
+template <>
+struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandInputRecordField> {
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandInputRecordField>;
+};
 }
-inline void w3id_org::cwl::cwl::NetworkAccess::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["class"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *class_);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["networkAccess"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *networkAccess);
-    }
+namespace w3id_org::cwl {
+template <>
+struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandInputRecordSchema> {
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandInputRecordSchema>;
+};
 }
 namespace w3id_org::cwl {
 template <>
-struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::NetworkAccess> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::NetworkAccess> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::NetworkAccess{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) try {
-            fromYaml(n["class"], *res.class_);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.networkAccess)::value_t>::value) try {
-            fromYaml(n["networkAccess"], *res.networkAccess);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandInputEnumSchema> {
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandInputEnumSchema>;
 };
 }
-inline auto w3id_org::cwl::cwl::InplaceUpdateRequirement::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("InplaceUpdateRequirement");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
-    {
-         auto member = toYaml(*class_, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "class", member);
-    }
-    {
-         auto member = toYaml(*inplaceUpdate, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "inplaceUpdate", member);
-    }
-    return n;
+namespace w3id_org::cwl {
+template <>
+struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandInputArraySchema> {
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandInputArraySchema>;
+};
 }
-inline void w3id_org::cwl::cwl::InplaceUpdateRequirement::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["class"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *class_);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["inplaceUpdate"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *inplaceUpdate);
-    }
+namespace w3id_org::cwl {
+template <>
+struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandOutputRecordField> {
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandOutputRecordField>;
+};
 }
 namespace w3id_org::cwl {
 template <>
-struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::InplaceUpdateRequirement> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::InplaceUpdateRequirement> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::InplaceUpdateRequirement{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) try {
-            fromYaml(n["class"], *res.class_);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.inplaceUpdate)::value_t>::value) try {
-            fromYaml(n["inplaceUpdate"], *res.inplaceUpdate);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandOutputRecordSchema> {
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandOutputRecordSchema>;
 };
 }
-inline auto w3id_org::cwl::cwl::ToolTimeLimit::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("ToolTimeLimit");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
-    {
-         auto member = toYaml(*class_, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "class", member);
-    }
-    {
-         auto member = toYaml(*timelimit, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "timelimit", member);
-    }
-    return n;
+namespace w3id_org::cwl {
+template <>
+struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandOutputEnumSchema> {
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandOutputEnumSchema>;
+};
 }
-inline void w3id_org::cwl::cwl::ToolTimeLimit::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["class"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *class_);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["timelimit"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *timelimit);
-    }
+namespace w3id_org::cwl {
+template <>
+struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandOutputArraySchema> {
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandOutputArraySchema>;
+};
 }
 namespace w3id_org::cwl {
 template <>
-struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::ToolTimeLimit> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::ToolTimeLimit> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::ToolTimeLimit{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) try {
-            fromYaml(n["class"], *res.class_);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.timelimit)::value_t>::value) try {
-            fromYaml(n["timelimit"], *res.timelimit);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandInputParameter> {
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandInputParameter>;
 };
 }
-inline auto w3id_org::cwl::cwl::ExpressionToolOutputParameter::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("ExpressionToolOutputParameter");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::OutputParameter::toYaml(config));
-    {
-         auto member = toYaml(*type, config);
-         member = simplifyType(member, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "type", member);
-    }
-    return n;
+namespace w3id_org::cwl {
+template <>
+struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandOutputParameter> {
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandOutputParameter>;
+};
 }
-inline void w3id_org::cwl::cwl::ExpressionToolOutputParameter::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::OutputParameter::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["type"], "", "");
-        auto expandedNode = expandType(nodeAsList);
-        fromYaml(expandedNode, *type);
-    }
+namespace w3id_org::cwl {
+template <>
+struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::CommandLineTool> {
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::CommandLineTool>;
+};
 }
 namespace w3id_org::cwl {
 template <>
-struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::ExpressionToolOutputParameter> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::ExpressionToolOutputParameter> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::ExpressionToolOutputParameter{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) try {
-            fromYaml(n["type"], *res.type);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::DockerRequirement> {
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::DockerRequirement>;
 };
 }
-inline auto w3id_org::cwl::cwl::WorkflowInputParameter::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("WorkflowInputParameter");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::InputParameter::toYaml(config));
-    {
-         auto member = toYaml(*type, config);
-         member = simplifyType(member, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "type", member);
-    }
-    {
-         auto member = toYaml(*inputBinding, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "inputBinding", member);
-    }
-    return n;
+namespace w3id_org::cwl {
+template <>
+struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::SoftwareRequirement> {
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::SoftwareRequirement>;
+};
 }
-inline void w3id_org::cwl::cwl::WorkflowInputParameter::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::InputParameter::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["type"], "", "");
-        auto expandedNode = expandType(nodeAsList);
-        fromYaml(expandedNode, *type);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["inputBinding"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *inputBinding);
-    }
+namespace w3id_org::cwl {
+template <>
+struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::SoftwarePackage> {
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::SoftwarePackage>;
+};
 }
 namespace w3id_org::cwl {
 template <>
-struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::WorkflowInputParameter> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::WorkflowInputParameter> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::WorkflowInputParameter{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) try {
-            fromYaml(n["type"], *res.type);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.inputBinding)::value_t>::value) try {
-            fromYaml(n["inputBinding"], *res.inputBinding);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::Dirent> {
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::Dirent>;
 };
 }
-inline auto w3id_org::cwl::cwl::ExpressionTool::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("ExpressionTool");
-    }
-    {
-         auto member = toYaml(*id, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "id", member);
-    }
-    {
-         auto member = toYaml(*label, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "label", member);
-    }
-    {
-         auto member = toYaml(*doc, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "doc", member);
-    }
-    {
-         auto member = toYaml(*inputs, config);
-         member = convertListToMap(member, "id", "type", config);
-        addYamlField(n, "inputs", member);
-    }
-    {
-         auto member = toYaml(*outputs, config);
-         member = convertListToMap(member, "id", "type", config);
-        addYamlField(n, "outputs", member);
-    }
-    {
-         auto member = toYaml(*requirements, config);
-         member = convertListToMap(member, "class", "", config);
-        addYamlField(n, "requirements", member);
-    }
-    {
-         auto member = toYaml(*hints, config);
-         member = convertListToMap(member, "class", "", config);
-        addYamlField(n, "hints", member);
-    }
-    {
-         auto member = toYaml(*cwlVersion, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "cwlVersion", member);
-    }
-    {
-         auto member = toYaml(*intent, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "intent", member);
-    }
-    {
-         auto member = toYaml(*class_, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "class", member);
-    }
-    {
-         auto member = toYaml(*expression, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "expression", member);
-    }
-    return n;
+namespace w3id_org::cwl {
+template <>
+struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::InitialWorkDirRequirement> {
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::InitialWorkDirRequirement>;
+};
 }
-inline void w3id_org::cwl::cwl::ExpressionTool::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["id"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *id);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["label"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *label);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["doc"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *doc);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["inputs"], "id", "type");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *inputs);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["outputs"], "id", "type");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *outputs);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["requirements"], "class", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *requirements);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["hints"], "class", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *hints);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["cwlVersion"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *cwlVersion);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["intent"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *intent);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["class"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *class_);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["expression"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *expression);
-    }
+namespace w3id_org::cwl {
+template <>
+struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::EnvVarRequirement> {
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::EnvVarRequirement>;
+};
 }
 namespace w3id_org::cwl {
 template <>
-struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::ExpressionTool> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::ExpressionTool> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::ExpressionTool{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.id)::value_t>::value) try {
-            fromYaml(n["id"], *res.id);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) try {
-            fromYaml(n["label"], *res.label);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) try {
-            fromYaml(n["doc"], *res.doc);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.inputs)::value_t>::value) try {
-            fromYaml(n["inputs"], *res.inputs);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.outputs)::value_t>::value) try {
-            fromYaml(n["outputs"], *res.outputs);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.requirements)::value_t>::value) try {
-            fromYaml(n["requirements"], *res.requirements);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.hints)::value_t>::value) try {
-            fromYaml(n["hints"], *res.hints);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.cwlVersion)::value_t>::value) try {
-            fromYaml(n["cwlVersion"], *res.cwlVersion);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.intent)::value_t>::value) try {
-            fromYaml(n["intent"], *res.intent);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) try {
-            fromYaml(n["class"], *res.class_);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.expression)::value_t>::value) try {
-            fromYaml(n["expression"], *res.expression);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::ShellCommandRequirement> {
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::ShellCommandRequirement>;
 };
 }
-inline auto w3id_org::cwl::cwl::WorkflowOutputParameter::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("WorkflowOutputParameter");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::OutputParameter::toYaml(config));
-    {
-         auto member = toYaml(*outputSource, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "outputSource", member);
-    }
-    {
-         auto member = toYaml(*linkMerge, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "linkMerge", member);
-    }
-    {
-         auto member = toYaml(*pickValue, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "pickValue", member);
-    }
-    {
-         auto member = toYaml(*type, config);
-         member = simplifyType(member, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "type", member);
-    }
-    return n;
+namespace w3id_org::cwl {
+template <>
+struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::ResourceRequirement> {
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::ResourceRequirement>;
+};
 }
-inline void w3id_org::cwl::cwl::WorkflowOutputParameter::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::OutputParameter::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["outputSource"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *outputSource);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["linkMerge"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *linkMerge);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["pickValue"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *pickValue);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["type"], "", "");
-        auto expandedNode = expandType(nodeAsList);
-        fromYaml(expandedNode, *type);
-    }
+namespace w3id_org::cwl {
+template <>
+struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::WorkReuse> {
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::WorkReuse>;
+};
 }
 namespace w3id_org::cwl {
 template <>
-struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::WorkflowOutputParameter> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::WorkflowOutputParameter> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::WorkflowOutputParameter{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.outputSource)::value_t>::value) try {
-            fromYaml(n["outputSource"], *res.outputSource);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.linkMerge)::value_t>::value) try {
-            fromYaml(n["linkMerge"], *res.linkMerge);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.pickValue)::value_t>::value) try {
-            fromYaml(n["pickValue"], *res.pickValue);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) try {
-            fromYaml(n["type"], *res.type);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::NetworkAccess> {
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::NetworkAccess>;
 };
 }
-inline w3id_org::cwl::cwl::Sink::~Sink() = default;
-inline auto w3id_org::cwl::cwl::Sink::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("Sink");
-    }
-    {
-         auto member = toYaml(*source, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "source", member);
-    }
-    {
-         auto member = toYaml(*linkMerge, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "linkMerge", member);
-    }
-    {
-         auto member = toYaml(*pickValue, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "pickValue", member);
-    }
-    return n;
+namespace w3id_org::cwl {
+template <>
+struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::InplaceUpdateRequirement> {
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::InplaceUpdateRequirement>;
+};
 }
-inline void w3id_org::cwl::cwl::Sink::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["source"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *source);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["linkMerge"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *linkMerge);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["pickValue"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *pickValue);
-    }
+namespace w3id_org::cwl {
+template <>
+struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::ToolTimeLimit> {
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::ToolTimeLimit>;
+};
 }
-inline auto w3id_org::cwl::cwl::WorkflowStepInput::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("WorkflowStepInput");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::Identified::toYaml(config));
-    n = mergeYaml(n, w3id_org::cwl::cwl::Sink::toYaml(config));
-    n = mergeYaml(n, w3id_org::cwl::cwl::LoadContents::toYaml(config));
-    n = mergeYaml(n, w3id_org::cwl::cwl::Labeled::toYaml(config));
-    {
-         auto member = toYaml(*default_, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "default", member);
-    }
-    {
-         auto member = toYaml(*valueFrom, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "valueFrom", member);
-    }
-    return n;
+namespace w3id_org::cwl {
+template <>
+struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::ExpressionToolOutputParameter> {
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::ExpressionToolOutputParameter>;
+};
 }
-inline void w3id_org::cwl::cwl::WorkflowStepInput::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::Identified::fromYaml(n);
-    w3id_org::cwl::cwl::Sink::fromYaml(n);
-    w3id_org::cwl::cwl::LoadContents::fromYaml(n);
-    w3id_org::cwl::cwl::Labeled::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["default"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *default_);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["valueFrom"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *valueFrom);
-    }
+namespace w3id_org::cwl {
+template <>
+struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::WorkflowInputParameter> {
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::WorkflowInputParameter>;
+};
 }
 namespace w3id_org::cwl {
 template <>
-struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::WorkflowStepInput> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::WorkflowStepInput> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::WorkflowStepInput{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.default_)::value_t>::value) try {
-            fromYaml(n["default"], *res.default_);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.valueFrom)::value_t>::value) try {
-            fromYaml(n["valueFrom"], *res.valueFrom);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::ExpressionTool> {
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::ExpressionTool>;
 };
 }
-inline auto w3id_org::cwl::cwl::WorkflowStepOutput::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("WorkflowStepOutput");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::Identified::toYaml(config));
-    return n;
+namespace w3id_org::cwl {
+template <>
+struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::WorkflowOutputParameter> {
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::WorkflowOutputParameter>;
+};
 }
-inline void w3id_org::cwl::cwl::WorkflowStepOutput::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::Identified::fromYaml(n);
+inline w3id_org::cwl::cwl::Sink::~Sink() = default;
+namespace w3id_org::cwl {
+template <>
+struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::WorkflowStepInput> {
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::WorkflowStepInput>;
+};
 }
 namespace w3id_org::cwl {
 template <>
 struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::WorkflowStepOutput> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::WorkflowStepOutput> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::WorkflowStepOutput{};
-
-        return std::nullopt;
-    }
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::WorkflowStepOutput>;
 };
 }
-inline auto w3id_org::cwl::cwl::WorkflowStep::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("WorkflowStep");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::Identified::toYaml(config));
-    n = mergeYaml(n, w3id_org::cwl::cwl::Labeled::toYaml(config));
-    n = mergeYaml(n, w3id_org::cwl::salad::Documented::toYaml(config));
-    {
-         auto member = toYaml(*in, config);
-         member = convertListToMap(member, "id", "source", config);
-        addYamlField(n, "in", member);
-    }
-    {
-         auto member = toYaml(*out, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "out", member);
-    }
-    {
-         auto member = toYaml(*requirements, config);
-         member = convertListToMap(member, "class", "", config);
-        addYamlField(n, "requirements", member);
-    }
-    {
-         auto member = toYaml(*hints, config);
-         member = convertListToMap(member, "class", "", config);
-        addYamlField(n, "hints", member);
-    }
-    {
-         auto member = toYaml(*run, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "run", member);
-    }
-    {
-         auto member = toYaml(*when, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "when", member);
-    }
-    {
-         auto member = toYaml(*scatter, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "scatter", member);
-    }
-    {
-         auto member = toYaml(*scatterMethod, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "scatterMethod", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::WorkflowStep::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::Identified::fromYaml(n);
-    w3id_org::cwl::cwl::Labeled::fromYaml(n);
-    w3id_org::cwl::salad::Documented::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["in"], "id", "source");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *in);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["out"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *out);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["requirements"], "class", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *requirements);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["hints"], "class", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *hints);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["run"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *run);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["when"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *when);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["scatter"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *scatter);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["scatterMethod"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *scatterMethod);
-    }
-}
 namespace w3id_org::cwl {
 template <>
 struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::WorkflowStep> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::WorkflowStep> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::WorkflowStep{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.in)::value_t>::value) try {
-            fromYaml(n["in"], *res.in);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.out)::value_t>::value) try {
-            fromYaml(n["out"], *res.out);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.requirements)::value_t>::value) try {
-            fromYaml(n["requirements"], *res.requirements);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.hints)::value_t>::value) try {
-            fromYaml(n["hints"], *res.hints);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.run)::value_t>::value) try {
-            fromYaml(n["run"], *res.run);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.when)::value_t>::value) try {
-            fromYaml(n["when"], *res.when);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.scatter)::value_t>::value) try {
-            fromYaml(n["scatter"], *res.scatter);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.scatterMethod)::value_t>::value) try {
-            fromYaml(n["scatterMethod"], *res.scatterMethod);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::WorkflowStep>;
 };
 }
-inline auto w3id_org::cwl::cwl::Workflow::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("Workflow");
-    }
-    {
-         auto member = toYaml(*id, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "id", member);
-    }
-    {
-         auto member = toYaml(*label, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "label", member);
-    }
-    {
-         auto member = toYaml(*doc, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "doc", member);
-    }
-    {
-         auto member = toYaml(*inputs, config);
-         member = convertListToMap(member, "id", "type", config);
-        addYamlField(n, "inputs", member);
-    }
-    {
-         auto member = toYaml(*outputs, config);
-         member = convertListToMap(member, "id", "type", config);
-        addYamlField(n, "outputs", member);
-    }
-    {
-         auto member = toYaml(*requirements, config);
-         member = convertListToMap(member, "class", "", config);
-        addYamlField(n, "requirements", member);
-    }
-    {
-         auto member = toYaml(*hints, config);
-         member = convertListToMap(member, "class", "", config);
-        addYamlField(n, "hints", member);
-    }
-    {
-         auto member = toYaml(*cwlVersion, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "cwlVersion", member);
-    }
-    {
-         auto member = toYaml(*intent, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "intent", member);
-    }
-    {
-         auto member = toYaml(*class_, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "class", member);
-    }
-    {
-         auto member = toYaml(*steps, config);
-         member = convertListToMap(member, "id", "", config);
-        addYamlField(n, "steps", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::Workflow::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["id"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *id);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["label"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *label);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["doc"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *doc);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["inputs"], "id", "type");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *inputs);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["outputs"], "id", "type");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *outputs);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["requirements"], "class", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *requirements);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["hints"], "class", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *hints);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["cwlVersion"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *cwlVersion);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["intent"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *intent);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["class"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *class_);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["steps"], "id", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *steps);
-    }
-}
 namespace w3id_org::cwl {
 template <>
 struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::Workflow> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::Workflow> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::Workflow{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.id)::value_t>::value) try {
-            fromYaml(n["id"], *res.id);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) try {
-            fromYaml(n["label"], *res.label);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) try {
-            fromYaml(n["doc"], *res.doc);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.inputs)::value_t>::value) try {
-            fromYaml(n["inputs"], *res.inputs);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.outputs)::value_t>::value) try {
-            fromYaml(n["outputs"], *res.outputs);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.requirements)::value_t>::value) try {
-            fromYaml(n["requirements"], *res.requirements);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.hints)::value_t>::value) try {
-            fromYaml(n["hints"], *res.hints);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.cwlVersion)::value_t>::value) try {
-            fromYaml(n["cwlVersion"], *res.cwlVersion);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.intent)::value_t>::value) try {
-            fromYaml(n["intent"], *res.intent);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) try {
-            fromYaml(n["class"], *res.class_);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.steps)::value_t>::value) try {
-            fromYaml(n["steps"], *res.steps);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::Workflow>;
 };
 }
-inline auto w3id_org::cwl::cwl::SubworkflowFeatureRequirement::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("SubworkflowFeatureRequirement");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
-    {
-         auto member = toYaml(*class_, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "class", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::SubworkflowFeatureRequirement::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["class"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *class_);
-    }
-}
 namespace w3id_org::cwl {
 template <>
 struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::SubworkflowFeatureRequirement> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::SubworkflowFeatureRequirement> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::SubworkflowFeatureRequirement{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) try {
-            fromYaml(n["class"], *res.class_);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::SubworkflowFeatureRequirement>;
 };
 }
-inline auto w3id_org::cwl::cwl::ScatterFeatureRequirement::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("ScatterFeatureRequirement");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
-    {
-         auto member = toYaml(*class_, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "class", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::ScatterFeatureRequirement::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["class"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *class_);
-    }
-}
 namespace w3id_org::cwl {
 template <>
 struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::ScatterFeatureRequirement> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::ScatterFeatureRequirement> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::ScatterFeatureRequirement{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) try {
-            fromYaml(n["class"], *res.class_);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::ScatterFeatureRequirement>;
 };
 }
-inline auto w3id_org::cwl::cwl::MultipleInputFeatureRequirement::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("MultipleInputFeatureRequirement");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
-    {
-         auto member = toYaml(*class_, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "class", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::MultipleInputFeatureRequirement::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["class"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *class_);
-    }
-}
 namespace w3id_org::cwl {
 template <>
 struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::MultipleInputFeatureRequirement> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::MultipleInputFeatureRequirement> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::MultipleInputFeatureRequirement{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) try {
-            fromYaml(n["class"], *res.class_);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::MultipleInputFeatureRequirement>;
 };
 }
-inline auto w3id_org::cwl::cwl::StepInputExpressionRequirement::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("StepInputExpressionRequirement");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::ProcessRequirement::toYaml(config));
-    {
-         auto member = toYaml(*class_, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "class", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::StepInputExpressionRequirement::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::ProcessRequirement::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["class"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *class_);
-    }
-}
 namespace w3id_org::cwl {
 template <>
 struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::StepInputExpressionRequirement> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::StepInputExpressionRequirement> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::StepInputExpressionRequirement{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) try {
-            fromYaml(n["class"], *res.class_);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::StepInputExpressionRequirement>;
 };
 }
-inline auto w3id_org::cwl::cwl::OperationInputParameter::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("OperationInputParameter");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::InputParameter::toYaml(config));
-    {
-         auto member = toYaml(*type, config);
-         member = simplifyType(member, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "type", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::OperationInputParameter::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::InputParameter::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["type"], "", "");
-        auto expandedNode = expandType(nodeAsList);
-        fromYaml(expandedNode, *type);
-    }
-}
 namespace w3id_org::cwl {
 template <>
 struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::OperationInputParameter> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::OperationInputParameter> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::OperationInputParameter{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) try {
-            fromYaml(n["type"], *res.type);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::OperationInputParameter>;
 };
 }
-inline auto w3id_org::cwl::cwl::OperationOutputParameter::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("OperationOutputParameter");
-    }
-    n = mergeYaml(n, w3id_org::cwl::cwl::OutputParameter::toYaml(config));
-    {
-         auto member = toYaml(*type, config);
-         member = simplifyType(member, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "type", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::OperationOutputParameter::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    w3id_org::cwl::cwl::OutputParameter::fromYaml(n);
-    {
-        auto nodeAsList = convertMapToList(n["type"], "", "");
-        auto expandedNode = expandType(nodeAsList);
-        fromYaml(expandedNode, *type);
-    }
-}
 namespace w3id_org::cwl {
 template <>
 struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::OperationOutputParameter> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::OperationOutputParameter> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::OperationOutputParameter{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.type)::value_t>::value) try {
-            fromYaml(n["type"], *res.type);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::OperationOutputParameter>;
 };
 }
-inline auto w3id_org::cwl::cwl::Operation::toYaml([[maybe_unused]] ::w3id_org::cwl::store_config const& config) const -> YAML::Node {
-    using ::w3id_org::cwl::toYaml;
-    auto n = YAML::Node{};
-    if (config.generateTags) {
-        n.SetTag("Operation");
-    }
-    {
-         auto member = toYaml(*id, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "id", member);
-    }
-    {
-         auto member = toYaml(*label, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "label", member);
-    }
-    {
-         auto member = toYaml(*doc, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "doc", member);
-    }
-    {
-         auto member = toYaml(*inputs, config);
-         member = convertListToMap(member, "id", "type", config);
-        addYamlField(n, "inputs", member);
-    }
-    {
-         auto member = toYaml(*outputs, config);
-         member = convertListToMap(member, "id", "type", config);
-        addYamlField(n, "outputs", member);
-    }
-    {
-         auto member = toYaml(*requirements, config);
-         member = convertListToMap(member, "class", "", config);
-        addYamlField(n, "requirements", member);
-    }
-    {
-         auto member = toYaml(*hints, config);
-         member = convertListToMap(member, "class", "", config);
-        addYamlField(n, "hints", member);
-    }
-    {
-         auto member = toYaml(*cwlVersion, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "cwlVersion", member);
-    }
-    {
-         auto member = toYaml(*intent, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "intent", member);
-    }
-    {
-         auto member = toYaml(*class_, config);
-         member = convertListToMap(member, "", "", config);
-        addYamlField(n, "class", member);
-    }
-    return n;
-}
-inline void w3id_org::cwl::cwl::Operation::fromYaml([[maybe_unused]] YAML::Node const& n) {
-    using ::w3id_org::cwl::fromYaml;
-    {
-        auto nodeAsList = convertMapToList(n["id"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *id);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["label"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *label);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["doc"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *doc);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["inputs"], "id", "type");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *inputs);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["outputs"], "id", "type");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *outputs);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["requirements"], "class", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *requirements);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["hints"], "class", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *hints);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["cwlVersion"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *cwlVersion);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["intent"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *intent);
-    }
-    {
-        auto nodeAsList = convertMapToList(n["class"], "", "");
-        auto expandedNode = (nodeAsList);
-        fromYaml(expandedNode, *class_);
-    }
-}
 namespace w3id_org::cwl {
 template <>
 struct DetectAndExtractFromYaml<::w3id_org::cwl::cwl::Operation> {
-    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::Operation> {
-        if (!n.IsDefined()) return std::nullopt;
-        if (!n.IsMap()) return std::nullopt;
-        auto res = ::w3id_org::cwl::cwl::Operation{};
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.id)::value_t>::value) try {
-            fromYaml(n["id"], *res.id);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.label)::value_t>::value) try {
-            fromYaml(n["label"], *res.label);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.doc)::value_t>::value) try {
-            fromYaml(n["doc"], *res.doc);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.inputs)::value_t>::value) try {
-            fromYaml(n["inputs"], *res.inputs);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.outputs)::value_t>::value) try {
-            fromYaml(n["outputs"], *res.outputs);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.requirements)::value_t>::value) try {
-            fromYaml(n["requirements"], *res.requirements);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.hints)::value_t>::value) try {
-            fromYaml(n["hints"], *res.hints);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.cwlVersion)::value_t>::value) try {
-            fromYaml(n["cwlVersion"], *res.cwlVersion);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.intent)::value_t>::value) try {
-            fromYaml(n["intent"], *res.intent);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        if constexpr (::w3id_org::cwl::IsConstant<decltype(res.class_)::value_t>::value) try {
-            fromYaml(n["class"], *res.class_);
-            fromYaml(n, res);
-            return res;
-        } catch(...) {}
-
-        return std::nullopt;
-    }
+    auto operator()(YAML::Node const& n) const -> std::optional<::w3id_org::cwl::cwl::Operation>;
 };
 }
 namespace w3id_org::cwl {
@@ -8726,32 +3308,25 @@ void fromYaml(YAML::Node const& n, std::variant<Args...>& v){
     if (!found) throw std::runtime_error{"didn't find any overload"};
 }
 using DocumentRootType = std::variant<w3id_org::cwl::cwl::CommandLineTool, w3id_org::cwl::cwl::ExpressionTool, w3id_org::cwl::cwl::Workflow, w3id_org::cwl::cwl::Operation>;
-auto load_document_from_yaml(YAML::Node n) -> DocumentRootType {
-    DocumentRootType root;
-    fromYaml(n, root);
-    return root;
-}
-auto load_document_from_string(std::string document) -> DocumentRootType {
-    return load_document_from_yaml(YAML::Load(document));
-}
-auto load_document(std::filesystem::path path) -> DocumentRootType {
-    return load_document_from_yaml(YAML::LoadFile(path.string()));
-}
-void store_document(DocumentRootType const& root, std::ostream& ostream, store_config config={}) {
-    auto y = toYaml(root, config);
-
-    YAML::Emitter out;
-    out << y;
-    ostream << out.c_str() << std::endl;
-}
-void store_document(DocumentRootType const& root, std::filesystem::path const& path, store_config config={}) {
-    auto ofs = std::ofstream{path};
-    store_document(root, ofs, config);
-}
-auto store_document_as_string(DocumentRootType const& root, store_config config={}) -> std::string {
-    auto ss = std::stringstream{};
-    store_document(root, ss, config);
-    return ss.str();
-}
+auto load_document_from_yaml(YAML::Node n) -> DocumentRootType;
+auto load_document_from_string(std::string document) -> DocumentRootType;
+// reads the whole file with a single read call instead of streaming it through YAML::LoadFile
+auto read_document(std::filesystem::path const& path) -> std::string;
+auto load_document(std::filesystem::path path) -> DocumentRootType;
+// result of loading a single document via load_documents
+struct load_result {
+    std::optional<DocumentRootType> document; // the loaded document, if successful
+    std::string error;                        // error message, if loading failed
+
+    explicit operator bool() const noexcept { return document.has_value(); }
+};
+// loads multiple documents in parallel, threads == 0 uses all available cores
+auto load_documents(std::vector<std::filesystem::path> const& paths, std::size_t threads = 0) -> std::vector<load_result>;
+// writes the document directly into the stream, the stream is not flushed
+void store_document(DocumentRootType const& root, std::ostream& ostream, store_config config={});
+void store_document(DocumentRootType const& root, std::filesystem::path const& path, store_config config={});
+// appends the document to a caller provided buffer, allowing to reuse its memory for multiple documents
+void store_document_to_buffer(DocumentRootType const& root, std::string& buffer, store_config config={});
+auto store_document_as_string(DocumentRootType const& root, store_config config={}) -> std::string;
 
 }
\ No newline at end of file
@@ -0,0 +1,298 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "diff.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+
+namespace tdl {
+
+namespace detail {
+
+/*!\brief matches the elements of `a` and `b` by key
+ *
+ * Calls `removed(x)` for all elements of `a` without a match, then `visit(y, position, x)`
+ * for all elements `y` of `b` in order, `x` is the matching element of `a` or nullptr.
+ * Returns true if the matched elements have a different order in `b`.
+ *
+ * Usually most elements are unchanged, so a common prefix and suffix are matched by position
+ * and only the elements in between are matched through hash tables.
+ */
+template <typename T, typename Key, typename Removed, typename Visit>
+auto matchByKey(std::vector<T> const & a, std::vector<T> const & b, Key key, Removed removed, Visit visit) -> bool {
+    auto common = std::min(a.size(), b.size());
+    auto prefix = std::size_t{};
+    while (prefix < common && key(a[prefix]) == key(b[prefix])) {
+        ++prefix;
+    }
+    auto suffix = std::size_t{};
+    while (suffix < common - prefix && key(a[a.size() - 1 - suffix]) == key(b[b.size() - 1 - suffix])) {
+        ++suffix;
+    }
+
+    auto indexOf = [&](std::vector<T> const & elements) {
+        auto index = std::unordered_map<std::string_view, T const *>{};
+        index.reserve(elements.size() - prefix - suffix);
+        for (auto i = prefix; i < elements.size() - suffix; ++i) {
+            if (!index.emplace(key(elements[i]), &elements[i]).second) {
+                throw std::runtime_error{"duplicate entry " + std::string{key(elements[i])}};
+            }
+        }
+        return index;
+    };
+    auto indexA = indexOf(a);
+    auto indexB = indexOf(b);
+
+    for (auto i = prefix; i < a.size() - suffix; ++i) {
+        if (indexB.count(key(a[i])) == 0) {
+            removed(a[i]);
+        }
+    }
+
+    auto reordered = false;
+    auto last      = static_cast<T const *>(nullptr); // the last match in the middle part
+    for (std::size_t i = 0; i < b.size(); ++i) {
+        auto match = static_cast<T const *>(nullptr);
+        if (i < prefix) {
+            match = &a[i];
+        } else if (i >= b.size() - suffix) {
+            match = &a[i + a.size() - b.size()];
+        } else if (auto iter = indexA.find(key(b[i])); iter != indexA.end()) {
+            match     = iter->second;
+            reordered = reordered || (last && match < last);
+            last      = match;
+        }
+        visit(b[i], i, match);
+    }
+    return reordered;
+}
+
+inline auto sameMetaInfo(MetaInfo const & a, MetaInfo const & b) -> bool {
+    auto sameCitations = std::equal(a.citations.begin(),
+                                    a.citations.end(),
+                                    b.citations.begin(),
+                                    b.citations.end(),
+                                    [](Citation const & x, Citation const & y) {
+                                        return x.doi == y.doi && x.url == y.url;
+                                    });
+    return a.version == b.version && a.name == b.name && a.docurl == b.docurl && a.category == b.category
+           && a.description == b.description && a.executableName == b.executableName && sameCitations;
+}
+
+//!\brief compares two values, children are not compared
+inline auto sameValue(Node::Value const & a, Node::Value const & b) -> bool {
+    if (a.index() != b.index()) {
+        return false;
+    }
+    return std::visit(
+        [&](auto const & x) {
+            using V      = std::decay_t<decltype(x)>;
+            auto const & y = std::get<V>(b);
+            if constexpr (std::is_same_v<V, BoolValue>) {
+                return x == y;
+            } else if constexpr (std::is_same_v<V, Node::Children>) {
+                return true;
+            } else if constexpr (std::is_same_v<V, StringValue> || std::is_same_v<V, StringValueList>) {
+                return x.value == y.value && x.validValues == y.validValues;
+            } else {
+                return x.value == y.value && x.minLimit == y.minLimit && x.maxLimit == y.maxLimit;
+            }
+        },
+        a);
+}
+
+template <typename T, typename Key>
+auto keysOf(std::vector<T> const & elements, Key key) -> std::vector<std::string> {
+    auto keys = std::vector<std::string>{};
+    keys.reserve(elements.size());
+    for (auto const & element : elements) {
+        keys.emplace_back(key(element));
+    }
+    return keys;
+}
+
+struct Differ {
+    Patch & patch;
+
+    static auto nameOf(Node const & node) -> std::string_view {
+        return node.name;
+    }
+
+    static auto optionOf(CLIMapping const & mapping) -> std::string_view {
+        return mapping.optionIdentifier;
+    }
+
+    void diffChildren(Node::Children const & a, Node::Children const & b, std::string const & parent) {
+        auto pathOf = [&](Node const & node) {
+            return parent.empty() ? node.name : parent + ':' + node.name;
+        };
+
+        auto groups = std::vector<std::pair<Node const *, Node const *>>{}; // groups in both trees
+        auto removed = [&](Node const & old) {
+            patch.nodes.push_back({Patch::Kind::Removed, pathOf(old), 0, {}, {}});
+        };
+        auto visit = [&](Node const & node, std::size_t position, Node const * old) {
+            if (!old) {
+                patch.nodes.push_back({Patch::Kind::Added, pathOf(node), position, node, {}});
+                return;
+            }
+            auto sameNode = old->description == node.description && old->tags == node.tags;
+            if (std::holds_alternative<Node::Children>(old->value) && std::holds_alternative<Node::Children>(node.value)) {
+                if (!sameNode) {
+                    auto changed = Node{node.name, node.description, node.tags, Node::Children{}};
+                    patch.nodes.push_back({Patch::Kind::Changed, pathOf(node), 0, std::move(changed), {}});
+                }
+                groups.emplace_back(old, &node);
+            } else if (!sameNode || !sameValue(old->value, node.value)) {
+                patch.nodes.push_back({Patch::Kind::Changed, pathOf(node), 0, node, {}});
+            }
+        };
+
+        if (matchByKey(a, b, nameOf, removed, visit)) {
+            patch.nodes.push_back({Patch::Kind::Reordered, parent, 0, {}, keysOf(b, nameOf)});
+        }
+
+        for (auto [old, node] : groups) {
+            diffChildren(std::get<Node::Children>(old->value), std::get<Node::Children>(node->value), pathOf(*node));
+        }
+    }
+
+    void diffMappings(std::vector<CLIMapping> const & a, std::vector<CLIMapping> const & b) {
+        auto removed = [&](CLIMapping const & old) {
+            patch.cliMapping.push_back({Patch::Kind::Removed, 0, {old.optionIdentifier, {}}, {}});
+        };
+        auto visit = [&](CLIMapping const & mapping, std::size_t position, CLIMapping const * old) {
+            if (!old) {
+                patch.cliMapping.push_back({Patch::Kind::Added, position, mapping, {}});
+            } else if (old->referenceName != mapping.referenceName) {
+                patch.cliMapping.push_back({Patch::Kind::Changed, 0, mapping, {}});
+            }
+        };
+
+        if (matchByKey(a, b, optionOf, removed, visit)) {
+            patch.cliMapping.push_back({Patch::Kind::Reordered, 0, {}, keysOf(b, optionOf)});
+        }
+    }
+};
+
+//!\brief the children of the node with the given path, the top level for an empty path
+inline auto findChildren(Node::Children & params, std::string_view path) -> Node::Children & {
+    auto * children = &params;
+    while (!path.empty()) {
+        auto pos  = path.find(':');
+        auto name = path.substr(0, pos);
+        auto iter = std::find_if(children->begin(), children->end(), [&](Node const & node) {
+            return node.name == name;
+        });
+        auto grandChildren = iter != children->end() ? std::get_if<Node::Children>(&iter->value) : nullptr;
+        if (!grandChildren) {
+            throw std::runtime_error{"patch refers to a missing group " + std::string{name}};
+        }
+        children = grandChildren;
+        path     = pos == std::string_view::npos ? std::string_view{} : path.substr(pos + 1);
+    }
+    return *children;
+}
+
+//!\brief splits a path into the children of its parent and its name
+inline auto findParent(Node::Children & params, std::string_view path) -> std::pair<Node::Children &, std::string_view> {
+    auto pos = path.rfind(':');
+    if (pos == std::string_view::npos) {
+        return {params, path};
+    }
+    return {findChildren(params, path.substr(0, pos)), path.substr(pos + 1)};
+}
+
+template <typename T, typename Key>
+auto findByKey(std::vector<T> & elements, std::string_view name, Key key) -> typename std::vector<T>::iterator {
+    auto iter = std::find_if(elements.begin(), elements.end(), [&](T const & element) {
+        return key(element) == name;
+    });
+    if (iter == elements.end()) {
+        throw std::runtime_error{"patch refers to a missing entry " + std::string{name}};
+    }
+    return iter;
+}
+
+//!\brief moves the elements into the given order, elements that are not listed stay at the end
+template <typename T, typename Key>
+void reorder(std::vector<T> & elements, std::vector<std::string> const & order, Key key) {
+    auto rank = std::unordered_map<std::string_view, std::size_t>{};
+    for (std::size_t i = 0; i < order.size(); ++i) {
+        rank.emplace(order[i], i);
+    }
+    std::stable_sort(elements.begin(), elements.end(), [&](T const & lhs, T const & rhs) {
+        auto l = rank.find(key(lhs));
+        auto r = rank.find(key(rhs));
+        return (l != rank.end() ? l->second : order.size()) < (r != rank.end() ? r->second : order.size());
+    });
+}
+
+} // namespace detail
+
+auto diff(ToolInfo const & a, ToolInfo const & b) -> Patch {
+    auto patch = Patch{};
+    if (!detail::sameMetaInfo(a.metaInfo, b.metaInfo)) {
+        patch.metaInfo = b.metaInfo;
+    }
+    auto differ = detail::Differ{patch};
+    differ.diffChildren(a.params, b.params, "");
+    differ.diffMappings(a.cliMapping, b.cliMapping);
+    return patch;
+}
+
+void apply(ToolInfo & doc, Patch const & patch) {
+    if (patch.metaInfo) {
+        doc.metaInfo = *patch.metaInfo;
+    }
+
+    auto nameOf = [](Node const & node) -> std::string_view {
+        return node.name;
+    };
+    for (auto const & edit : patch.nodes) {
+        if (edit.kind == Patch::Kind::Reordered) {
+            detail::reorder(detail::findChildren(doc.params, edit.path), edit.order, nameOf);
+            continue;
+        }
+        auto [siblings, name] = detail::findParent(doc.params, edit.path);
+        if (edit.kind == Patch::Kind::Added) {
+            siblings.insert(siblings.begin() + std::min(edit.position, siblings.size()), edit.node);
+        } else if (edit.kind == Patch::Kind::Removed) {
+            siblings.erase(detail::findByKey(siblings, name, nameOf));
+        } else {
+            auto & node = *detail::findByKey(siblings, name, nameOf);
+            auto   keep = std::holds_alternative<Node::Children>(node.value)
+                        && std::holds_alternative<Node::Children>(edit.node.value);
+            node.name        = edit.node.name;
+            node.description = edit.node.description;
+            node.tags        = edit.node.tags;
+            if (!keep) {
+                node.value = edit.node.value;
+            }
+        }
+    }
+
+    auto optionOf = [](CLIMapping const & mapping) -> std::string_view {
+        return mapping.optionIdentifier;
+    };
+    for (auto const & edit : patch.cliMapping) {
+        auto & mappings = doc.cliMapping;
+        if (edit.kind == Patch::Kind::Added) {
+            mappings.insert(mappings.begin() + std::min(edit.position, mappings.size()), edit.mapping);
+        } else if (edit.kind == Patch::Kind::Removed) {
+            mappings.erase(detail::findByKey(mappings, edit.mapping.optionIdentifier, optionOf));
+        } else if (edit.kind == Patch::Kind::Changed) {
+            detail::findByKey(mappings, edit.mapping.optionIdentifier, optionOf)->referenceName =
+                edit.mapping.referenceName;
+        } else {
+            detail::reorder(mappings, edit.order, optionOf);
+        }
+    }
+}
+
+} // namespace tdl
@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "ToolInfo.h"
+
+namespace tdl {
+
+/*!\brief The differences between two ToolInfos, see `diff` and `apply`
+ *
+ * Nodes are addressed by their path, the names from the top level down to the node separated by ':'.
+ * Mappings are addressed by their `optionIdentifier`.
+ */
+struct Patch {
+    enum class Kind {
+        Added,
+        Removed,
+        Changed,
+        Reordered //!< the same children or mappings, in a different order
+    };
+
+    struct NodeEdit {
+        Kind        kind{};
+        std::string path{};     //!< Path of the node, of the parent for `Reordered` (empty for the top level)
+        std::size_t position{}; //!< `Added`: position among its siblings
+        /*!\brief `Added`: the new node, `Changed`: the new name, description, tags and value
+         *
+         * If the old and the new node both have children, a `Changed` node has no children,
+         * the children are kept and edited by edits of their own.
+         */
+        Node                     node{};
+        std::vector<std::string> order{}; //!< `Reordered`: names of all children in their new order
+    };
+
+    struct MappingEdit {
+        Kind                     kind{};
+        std::size_t              position{}; //!< `Added`: position in the cli mapping
+        CLIMapping               mapping{};  //!< The new mapping, only `optionIdentifier` for `Removed`
+        std::vector<std::string> order{};    //!< `Reordered`: all option identifiers in their new order
+    };
+
+    std::optional<MetaInfo>  metaInfo{}; //!< The new meta info, if it changed
+    std::vector<NodeEdit>    nodes{};
+    std::vector<MappingEdit> cliMapping{};
+
+    auto empty() const -> bool {
+        return !metaInfo && nodes.empty() && cliMapping.empty();
+    }
+};
+
+/*!\brief the edits that turn `a` into `b`
+ *
+ * Children are matched by name and mappings by option identifier, so the time is linear in
+ * the size of both trees. Unchanged leading and trailing entries are matched by position, the
+ * entries in between through hash tables. A renamed node is removed and added again.
+ * Names of siblings and option identifiers are expected to be unique, duplicates among the
+ * entries in between throw `std::runtime_error`.
+ */
+auto diff(ToolInfo const & a, ToolInfo const & b) -> Patch;
+
+/*!\brief applies the edits of a patch, `apply(a, diff(a, b))` turns `a` into `b`
+ *
+ * Throws `std::runtime_error` if an edit refers to a node or mapping that does not exist.
+ */
+void apply(ToolInfo & doc, Patch const & patch);
+
+} // namespace tdl
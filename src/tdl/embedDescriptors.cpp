@@ -0,0 +1,130 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "embedDescriptors.h"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "convertToCTD.h"
+#include "convertToCWL.h"
+#include "writeFile.h"
+
+namespace tdl {
+
+namespace detail {
+
+//!\brief true if `name` consists of identifiers separated by "::"
+inline auto isQualifiedName(std::string_view name) -> bool {
+    auto isStart = [](char c) {
+        return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_';
+    };
+    auto isDigit = [](char c) {
+        return c >= '0' && c <= '9';
+    };
+    auto atStart = true;
+    for (std::size_t i = 0; i < name.size(); ++i) {
+        if (atStart) {
+            if (!isStart(name[i])) {
+                return false;
+            }
+            atStart = false;
+        } else if (name.substr(i, 2) == "::") {
+            atStart = true;
+            ++i;
+        } else if (!isStart(name[i]) && !isDigit(name[i])) {
+            return false;
+        }
+    }
+    return !atStart;
+}
+
+/*!\brief appends the bytes of `data` as an initializer list of char literals
+ *
+ * A single string literal would be shorter, but some compilers limit their length to 64KiB.
+ */
+inline void appendCharArray(std::string & out, std::string_view data) {
+    constexpr char hexDigits[] = "0123456789abcdef";
+    constexpr auto perLine     = std::size_t{16};
+
+    out.reserve(out.size() + data.size() * 8);
+    for (std::size_t i = 0; i < data.size(); ++i) {
+        out += i % perLine == 0 ? "\n    " : " ";
+        auto c = static_cast<unsigned char>(data[i]);
+        if (c >= 0x20 && c < 0x7f && c != '\'' && c != '\\') {
+            out += '\'';
+            out += static_cast<char>(c);
+            out += "',";
+        } else {
+            out += "'\\x";
+            out += hexDigits[c >> 4];
+            out += hexDigits[c & 0xf];
+            out += "',";
+        }
+    }
+    out += data.empty() ? " '\\0'" : "\n    '\\0'";
+}
+
+inline auto descriptorName(DescriptorFormat format) -> std::string_view {
+    return format == DescriptorFormat::CTD ? "ctd" : "cwl";
+}
+
+} // namespace detail
+
+auto embedDescriptors(ToolInfo const &                      doc,
+                      std::vector<DescriptorFormat> const & formats,
+                      std::string_view                      namespaceName,
+                      std::string_view                      headerName) -> EmbeddedDescriptors {
+    if (!detail::isQualifiedName(namespaceName)) {
+        throw std::runtime_error{"invalid namespace name '" + std::string{namespaceName} + "'"};
+    }
+
+    auto result = EmbeddedDescriptors{};
+
+    result.header = "// generated by tdl, do not edit\n\n"
+                    "#pragma once\n\n"
+                    "#include <string_view>\n\n"
+                    "namespace " + std::string{namespaceName} + " {\n\n";
+    result.source = "// generated by tdl, do not edit\n\n"
+                    "#include \"" + std::string{headerName} + "\"\n\n"
+                    "namespace " + std::string{namespaceName} + " {\n";
+
+    auto seen = std::vector<DescriptorFormat>{};
+    for (auto format : formats) {
+        if (std::find(seen.begin(), seen.end(), format) != seen.end()) {
+            continue;
+        }
+        seen.push_back(format);
+
+        auto name = std::string{detail::descriptorName(format)};
+        auto data = format == DescriptorFormat::CTD ? convertToCTD(doc) : convertToCWL(doc);
+
+        result.header += "//!\\brief the " + std::string{format == DescriptorFormat::CTD ? "CTD" : "CWL"}
+                         + " descriptor of the tool, null terminated\n"
+                         "extern std::string_view const " + name + ";\n\n";
+
+        result.source += "\nnamespace {\n"
+                         "constexpr char " + name + "Data[] = {";
+        detail::appendCharArray(result.source, data);
+        result.source += "};\n"
+                         "} // namespace\n\n"
+                         "std::string_view const " + name + "{" + name + "Data, sizeof(" + name + "Data) - 1};\n";
+    }
+
+    result.header += "} // namespace " + std::string{namespaceName} + "\n";
+    result.source += "\n} // namespace " + std::string{namespaceName} + "\n";
+    return result;
+}
+
+void writeEmbeddedDescriptors(ToolInfo const &                      doc,
+                              std::vector<DescriptorFormat> const & formats,
+                              std::string_view                      namespaceName,
+                              std::filesystem::path const &         headerPath,
+                              std::filesystem::path const &         sourcePath) {
+    auto [header, source] = embedDescriptors(doc, formats, namespaceName, headerPath.filename().string());
+    writeFileIfChanged(headerPath, header);
+    writeFileIfChanged(sourcePath, source);
+}
+
+} // namespace tdl
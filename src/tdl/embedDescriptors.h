@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "DescriptorFormat.h"
+#include "ToolInfo.h"
+
+namespace tdl {
+
+//!\brief C++ header and source that hold generated descriptors as constant data
+struct EmbeddedDescriptors {
+    std::string header{};
+    std::string source{};
+};
+
+/*!\brief generates a C++ header and source that hold the descriptors of a ToolInfo
+ *
+ * For each format the header declares a `std::string_view const` named `ctd` or `cwl` in namespace
+ * `namespaceName` (nested namespaces are written as "a::b"). The data is null terminated and
+ * constant initialized, so it can be used in static initializers.
+ * The generated files only include `<string_view>`, programs using them do not have to link TDL.
+ * The source includes the header as `#include "<headerName>"`.
+ *
+ * This is the generator side of the CMake function `tdl_generate_descriptors`.
+ */
+auto embedDescriptors(ToolInfo const &                      doc,
+                      std::vector<DescriptorFormat> const & formats,
+                      std::string_view                      namespaceName,
+                      std::string_view                      headerName) -> EmbeddedDescriptors;
+
+/*!\brief writes the output of `embedDescriptors` into two files, throws `std::runtime_error` on failure
+ *
+ * Files that already hold the output are not touched, so their dependents are not rebuilt.
+ */
+void writeEmbeddedDescriptors(ToolInfo const &                      doc,
+                              std::vector<DescriptorFormat> const & formats,
+                              std::string_view                      namespaceName,
+                              std::filesystem::path const &         headerPath,
+                              std::filesystem::path const &         sourcePath);
+
+} // namespace tdl
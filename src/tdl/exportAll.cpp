@@ -0,0 +1,73 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "exportAll.h"
+
+#include <exception>
+
+#include "convertToCTD.h"
+#include "parallelFor.h"
+
+namespace tdl {
+
+namespace detail {
+
+//!\brief converts into one format, measures only if `stats` is set
+inline auto exportOne(ToolInfo const &         doc,
+                      DescriptorFormat         format,
+                      ExportAllOptions const & options,
+                      ExportStats *            stats) -> std::string {
+    if (format == DescriptorFormat::CTD) {
+        return stats ? convertToCTD(doc, *stats) : convertToCTD(doc);
+    }
+    return stats ? convertToCWL(doc, options.postProcessCWL, *stats) : convertToCWL(doc, options.postProcessCWL);
+}
+
+} // namespace detail
+
+auto exportAll(ToolInfo const *                      docs,
+               std::size_t                           count,
+               std::vector<DescriptorFormat> const & formats,
+               ExportAllOptions const &              options) -> std::vector<std::vector<std::string>> {
+    auto results = std::vector<std::vector<std::string>>(count);
+    auto errors  = std::vector<std::exception_ptr>(count);
+
+    // one ExportStats per worker, summed up at the end
+    auto stats = std::vector<ExportStats>(detail::workerCount(options.threads, count));
+    for (auto & s : stats) {
+        s.allocationCounter = options.stats ? options.stats->allocationCounter : nullptr;
+    }
+
+    detail::parallelFor(count, options.threads, [&](std::size_t i, std::size_t worker) {
+        auto measure = options.stats ? &stats[worker] : nullptr;
+        try {
+            results[i].reserve(formats.size());
+            for (auto format : formats) {
+                results[i].push_back(detail::exportOne(docs[i], format, options, measure));
+            }
+        } catch (...) {
+            errors[i] = std::current_exception();
+        }
+    });
+
+    for (auto const & error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+    if (options.stats) {
+        for (auto const & s : stats) {
+            *options.stats += s;
+        }
+    }
+    return results;
+}
+
+auto exportAll(std::vector<ToolInfo> const &         docs,
+               std::vector<DescriptorFormat> const & formats,
+               ExportAllOptions const &              options) -> std::vector<std::vector<std::string>> {
+    return exportAll(docs.data(), docs.size(), formats, options);
+}
+
+} // namespace tdl
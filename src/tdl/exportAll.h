@@ -0,0 +1,45 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "DescriptorFormat.h"
+#include "ExportStats.h"
+#include "ToolInfo.h"
+#include "convertToCWL.h"
+
+namespace tdl {
+
+//!\brief Options of `exportAll`
+struct ExportAllOptions {
+    std::size_t    threads{};                        //!< Number of threads, 0 uses all cores
+    PostProcessCWL postProcessCWL{post_process_cwl}; //!< Used instead of the global `post_process_cwl`
+    ExportStats *  stats{};                          //!< If set, the stats of all exports are added to it
+};
+
+/*!\brief converts many ToolInfos in parallel
+ *
+ * `result[i][j]` is the descriptor of `docs[i]` in `formats[j]`, independent of the number of threads.
+ * Each worker takes the next ToolInfo that is not converted yet, so a few large tools do not stall the
+ * others. The workers collect their stats separately, they are added to `options.stats` at the end.
+ * `options.postProcessCWL` is called by several threads at once.
+ *
+ * If an export throws, the other ToolInfos are still converted, then the exception of the first
+ * failed ToolInfo is rethrown.
+ */
+auto exportAll(ToolInfo const *                      docs,
+               std::size_t                           count,
+               std::vector<DescriptorFormat> const & formats,
+               ExportAllOptions const &              options = {}) -> std::vector<std::vector<std::string>>;
+
+//!\brief converts all ToolInfos of `docs` in parallel, see above
+auto exportAll(std::vector<ToolInfo> const &         docs,
+               std::vector<DescriptorFormat> const & formats,
+               ExportAllOptions const &              options = {}) -> std::vector<std::vector<std::string>>;
+
+} // namespace tdl
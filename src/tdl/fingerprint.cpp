@@ -0,0 +1,166 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "fingerprint.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <type_traits>
+
+namespace tdl {
+
+namespace detail {
+
+//!\brief fixed numbers of the value alternatives, independent of their order in `Node::Value`
+template <typename V>
+constexpr auto alternativeId() -> uint64_t {
+    if constexpr (std::is_same_v<V, BoolValue>) {
+        return 0;
+    } else if constexpr (std::is_same_v<V, IntValue>) {
+        return 1;
+    } else if constexpr (std::is_same_v<V, DoubleValue>) {
+        return 2;
+    } else if constexpr (std::is_same_v<V, StringValue>) {
+        return 3;
+    } else if constexpr (std::is_same_v<V, IntValueList>) {
+        return 4;
+    } else if constexpr (std::is_same_v<V, DoubleValueList>) {
+        return 5;
+    } else if constexpr (std::is_same_v<V, StringValueList>) {
+        return 6;
+    } else {
+        static_assert(std::is_same_v<V, Node::Children>);
+        return 7;
+    }
+}
+
+//!\brief feeds the fields of a ToolInfo into the hash, see `fingerprint` for the encoding
+struct FingerprintWriter {
+    Fnv1a128 hash{};
+
+    void add(uint64_t v) {
+        for (int i = 0; i < 8; ++i) {
+            hash.update(static_cast<unsigned char>(v >> (8 * i)));
+        }
+    }
+
+    void add(bool v) {
+        hash.update(static_cast<unsigned char>(v));
+    }
+
+    void add(int v) {
+        add(static_cast<uint64_t>(static_cast<int64_t>(v)));
+    }
+
+    void add(double v) {
+        if (std::isnan(v)) {
+            v = std::numeric_limits<double>::quiet_NaN();
+        }
+        static_assert(sizeof(double) == sizeof(uint64_t) && std::numeric_limits<double>::is_iec559);
+        auto bits = uint64_t{};
+        std::memcpy(&bits, &v, sizeof(bits));
+        add(bits);
+    }
+
+    void add(std::string_view v) {
+        add(static_cast<uint64_t>(v.size()));
+        hash.update(v);
+    }
+
+    void add(std::string const & v) {
+        add(std::string_view{v});
+    }
+
+    template <typename T>
+    void add(std::optional<T> const & v) {
+        add(v.has_value());
+        if (v) {
+            add(*v);
+        }
+    }
+
+    template <typename T>
+    void add(std::vector<T> const & v) {
+        add(static_cast<uint64_t>(v.size()));
+        for (auto const & e : v) {
+            add(e);
+        }
+    }
+
+    void add(Tags const & tags) {
+        add(static_cast<uint64_t>(tags.size()));
+        for (auto const & tag : tags) {
+            add(tag);
+        }
+    }
+
+    void add(Node const & node) {
+        add(node.name);
+        add(node.description);
+        add(node.tags);
+
+        std::visit(
+            [&](auto const & value) {
+                using V = std::decay_t<decltype(value)>;
+                add(alternativeId<V>());
+                if constexpr (std::is_same_v<V, BoolValue> || std::is_same_v<V, Node::Children>) {
+                    add(value);
+                } else if constexpr (std::is_same_v<V, StringValue> || std::is_same_v<V, StringValueList>) {
+                    add(value.value);
+                    add(value.validValues);
+                } else {
+                    add(value.value);
+                    add(value.minLimit);
+                    add(value.maxLimit);
+                }
+            },
+            node.value);
+    }
+
+    void add(Citation const & citation) {
+        add(citation.doi);
+        add(citation.url);
+    }
+
+    void add(CLIMapping const & mapping) {
+        add(mapping.optionIdentifier);
+        add(mapping.referenceName);
+    }
+
+    void add(MetaInfo const & info) {
+        add(info.version);
+        add(info.name);
+        add(info.docurl);
+        add(info.category);
+        add(info.description);
+        add(info.executableName);
+        add(info.citations);
+    }
+};
+
+} // namespace detail
+
+auto Fingerprint::toString() const -> std::string {
+    constexpr auto digits = std::string_view{"0123456789abcdef"};
+
+    auto str = std::string(32, '0');
+    for (int i = 0; i < 16; ++i) {
+        str[15 - i] = digits[(high >> (4 * i)) & 0xf];
+        str[31 - i] = digits[(low >> (4 * i)) & 0xf];
+    }
+    return str;
+}
+
+auto fingerprint(ToolInfo const & doc) -> Fingerprint {
+    auto writer = detail::FingerprintWriter{};
+    writer.add(std::string_view{"tdl-fingerprint-1"});
+    writer.add(doc.metaInfo);
+    writer.add(doc.params);
+    writer.add(doc.cliMapping);
+    return writer.hash.value();
+}
+
+} // namespace tdl
@@ -0,0 +1,80 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <tuple>
+
+#include "ToolInfo.h"
+
+namespace tdl {
+
+//!\brief A 128 bit hash value
+struct Fingerprint {
+    uint64_t high{};
+    uint64_t low{};
+
+    //!\brief 32 lower case hex digits, high bits first
+    auto toString() const -> std::string;
+
+    friend bool operator==(Fingerprint const & lhs, Fingerprint const & rhs) {
+        return lhs.high == rhs.high && lhs.low == rhs.low;
+    }
+    friend bool operator!=(Fingerprint const & lhs, Fingerprint const & rhs) {
+        return !(lhs == rhs);
+    }
+    friend bool operator<(Fingerprint const & lhs, Fingerprint const & rhs) {
+        return std::tie(lhs.high, lhs.low) < std::tie(rhs.high, rhs.low);
+    }
+};
+
+namespace detail {
+
+//!\brief 128 bit FNV-1a, without relying on a 128 bit integer type
+class Fnv1a128 {
+public:
+    void update(unsigned char byte) {
+        state_.low ^= byte;
+        // multiply by the prime 2^88 + 0x13b, modulo 2^128
+        constexpr uint64_t c     = 0x13b;
+        auto const         carry = ((state_.low >> 32) * c + (((state_.low & 0xffffffffu) * c) >> 32)) >> 32;
+        state_.high              = state_.high * c + carry + (state_.low << 24);
+        state_.low               = state_.low * c;
+    }
+
+    void update(std::string_view bytes) {
+        for (auto byte : bytes) {
+            update(static_cast<unsigned char>(byte));
+        }
+    }
+
+    auto value() const -> Fingerprint {
+        return state_;
+    }
+
+private:
+    Fingerprint state_{0x6c62272e07bb0142u, 0x62b821756295c58du}; //!< offset basis
+};
+
+} // namespace detail
+
+/*!\brief a hash over everything that ends up in a generated CTD or CWL document
+ *
+ * Covers the meta info, the parameter tree (names, descriptions, tags, the alternative
+ * of each value with its value, limits and valid values) and the cli mapping. Two ToolInfos
+ * have the same fingerprint if and only if (up to hash collisions) these are equal.
+ *
+ * The fingerprint is computed in a single pass without allocations. It does not depend on
+ * the platform, the compiler or the standard library: all fields are fed into a 128 bit FNV-1a
+ * in a fixed order with a fixed encoding (integers as little endian, strings with their length,
+ * doubles by their IEEE 754 bits). It is meant to be used as a persistent cache key and stays the
+ * same across releases. A change of the encoding would change the version string that is hashed first.
+ */
+auto fingerprint(ToolInfo const & doc) -> Fingerprint;
+
+} // namespace tdl
@@ -0,0 +1,292 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "importCTD.h"
+
+#include <cerrno>
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+
+#include "MappedFile.h"
+#include "XMLScanner.h"
+#include "parseValue.h"
+
+namespace tdl {
+
+namespace detail {
+
+//!\brief splits a comma separated list, as written by `convertToCTD`
+inline auto splitList(std::string_view str) -> std::vector<std::string> {
+    auto result = std::vector<std::string>{};
+    while (true) {
+        auto comma = str.find(',');
+        result.emplace_back(str.substr(0, comma));
+        if (comma == std::string_view::npos) {
+            return result;
+        }
+        str.remove_prefix(comma + 1);
+    }
+}
+
+inline auto readNumber(std::string_view path, std::string_view str, int) -> int {
+    return parseNumber(path, str, int{});
+}
+
+/*!\brief like `parseNumber`, but values beyond the range of double are clamped
+ *
+ * OpenMS writes the largest double with 15 digits, rounded up, e.g. as the upper end of a range.
+ */
+inline auto readNumber(std::string_view path, std::string_view str, double) -> double {
+    auto   copy  = std::string{str};
+    char * end   = nullptr;
+    errno        = 0;
+    auto   value = std::strtod(copy.c_str(), &end);
+    if (copy.empty() || end != copy.c_str() + copy.size()) {
+        throwInvalidValue(path, str, "expected a number");
+    }
+    if (errno == ERANGE && std::isinf(value)) {
+        value = std::copysign(std::numeric_limits<double>::max(), value);
+    }
+    return value;
+}
+
+//!\brief reads restrictions of the form "min:max", both limits are optional
+template <typename T, typename ListType>
+void readLimits(TValue<T, ListType> & value, std::string_view path, std::optional<std::string> const & restrictions) {
+    if (!restrictions || restrictions->empty()) {
+        return;
+    }
+    auto str   = std::string_view{*restrictions};
+    auto colon = str.find(':');
+    if (colon == std::string_view::npos) {
+        throwInvalidValue(path, str, "expected restrictions of the form min:max");
+    }
+    if (colon > 0) {
+        value.minLimit = readNumber(path, str.substr(0, colon), T{});
+    }
+    if (colon + 1 < str.size()) {
+        value.maxLimit = readNumber(path, str.substr(colon + 1), T{});
+    }
+}
+
+template <typename ListType>
+void readValidValues(TStringValue<std::string, ListType> & value, std::optional<std::string> const & list) {
+    if (list && !list->empty()) {
+        value.validValues = splitList(*list);
+    }
+}
+
+//!\brief the tag `convertToCTD` turns into the given type of a file parameter
+inline auto fileTag(std::string_view type, bool isList) -> std::optional<Tag> {
+    if (type == "input-file") {
+        return Tag::input_file;
+    }
+    if (type == "output-file") {
+        return Tag::output_file;
+    }
+    if (type == "output-prefix" && !isList) {
+        return Tag::output_prefix;
+    }
+    return std::nullopt;
+}
+
+/*!\brief the value of an ITEM or the empty list of an ITEMLIST
+ *
+ * File types add their tag to `tags`. The values of lists are not checked against their
+ * restrictions, neither are values of file parameters against their supported formats.
+ */
+inline auto readValue(XMLScanner const & scanner, std::string_view path, bool isList, Tags & tags) -> Node::Value {
+    auto type = scanner.attribute("type").value_or("string");
+    if (auto tag = fileTag(type, isList)) {
+        tags.insert(*tag);
+    }
+
+    auto withLimits = [&](auto value) -> Node::Value {
+        readLimits(value, path, scanner.attribute("restrictions"));
+        return value;
+    };
+    auto withValidValues = [&](auto value) -> Node::Value {
+        auto isFile = type != "string";
+        readValidValues(value, scanner.attribute(isFile ? "supported_formats" : "restrictions"));
+        return value;
+    };
+
+    if (isList) {
+        if (type == "int") {
+            return withLimits(IntValueList{});
+        }
+        if (type == "double") {
+            return withLimits(DoubleValueList{});
+        }
+        if (type == "string" || fileTag(type, isList)) {
+            return withValidValues(StringValueList{});
+        }
+    } else {
+        auto value = scanner.attribute("value").value_or("");
+        if (type == "bool") {
+            return parseBool(path, value);
+        }
+        if (type == "int") {
+            return withLimits(IntValue{readNumber(path, value, int{})});
+        }
+        if (type == "double") {
+            return withLimits(DoubleValue{readNumber(path, value, double{})});
+        }
+        if (type == "string" || fileTag(type, isList)) {
+            return withValidValues(StringValue{value});
+        }
+    }
+    throw std::runtime_error{"unknown type '" + type + "' of " + std::string{path} + " in line "
+                             + std::to_string(scanner.line())};
+}
+
+//!\brief appends the value of a LISTITEM
+inline void appendListItem(Node & list, std::string_view path, std::string_view str) {
+    std::visit(
+        [&](auto & value) {
+            using V = std::decay_t<decltype(value)>;
+            if constexpr (std::is_same_v<V, IntValueList>) {
+                value.value.push_back(readNumber(path, str, int{}));
+            } else if constexpr (std::is_same_v<V, DoubleValueList>) {
+                value.value.push_back(readNumber(path, str, double{}));
+            } else if constexpr (std::is_same_v<V, StringValueList>) {
+                value.value.emplace_back(str);
+            }
+        },
+        list.value);
+}
+
+} // namespace detail
+
+auto importCTDFromString(std::string_view document) -> ToolInfo {
+    auto doc     = ToolInfo{};
+    auto scanner = detail::XMLScanner{document};
+
+    auto isCTD        = false; // a tool or PARAMETERS element was seen
+    auto inParameters = false;
+    auto children     = std::vector<Node::Children *>{}; // children of the enclosing NODEs
+    auto list         = static_cast<Node *>(nullptr);    // node of the open ITEMLIST
+    auto nodePath     = std::string{};                   // names of the enclosing NODEs, separated by ':'
+    auto nodeLengths  = std::vector<std::size_t>{};      // length of nodePath before each NODE
+    auto itemPath     = std::string{};
+
+    auto required = [&](std::string_view name) {
+        auto value = scanner.attribute(name);
+        if (!value) {
+            throw std::runtime_error{"missing " + std::string{name} + " of " + std::string{scanner.name()}
+                                     + " in line " + std::to_string(scanner.line())};
+        }
+        return *value;
+    };
+
+    // name, description and tags of a NODE, ITEM or ITEMLIST
+    auto readNode = [&]() {
+        auto node        = Node{};
+        node.name        = required("name");
+        node.description = scanner.attribute("description").value_or("");
+        if (auto tags = scanner.attribute("tags"); tags && !tags->empty()) {
+            for (auto const & tag : detail::splitList(*tags)) {
+                node.tags.insert(tag);
+            }
+        }
+        for (auto tag : {Tag::required, Tag::advanced}) {
+            if (scanner.attribute(Tags::name(tag)) == "true") {
+                node.tags.insert(tag);
+            }
+        }
+        itemPath = nodePath;
+        if (!itemPath.empty()) {
+            itemPath += ':';
+        }
+        itemPath += node.name;
+        return node;
+    };
+
+    for (auto token = scanner.next(); token != detail::XMLScanner::Token::End; token = scanner.next()) {
+        auto tag = scanner.name();
+        if (token == detail::XMLScanner::Token::EndTag) {
+            if (tag == "PARAMETERS") {
+                inParameters = false;
+            } else if (tag == "NODE" && inParameters) {
+                if (nodeLengths.empty()) {
+                    throw std::runtime_error{"unmatched </NODE> in line " + std::to_string(scanner.line())};
+                }
+                children.pop_back();
+                nodePath.resize(nodeLengths.back());
+                nodeLengths.pop_back();
+            } else if (tag == "ITEMLIST") {
+                list = nullptr;
+            }
+            continue;
+        }
+
+        if (!inParameters) {
+            if (tag == "tool") {
+                isCTD                 = true;
+                doc.metaInfo.version  = scanner.attribute("version").value_or("");
+                doc.metaInfo.name     = scanner.attribute("name").value_or("");
+                doc.metaInfo.docurl   = scanner.attribute("docurl").value_or("");
+                doc.metaInfo.category = scanner.attribute("category").value_or("");
+            } else if (tag == "description") {
+                doc.metaInfo.description = scanner.text();
+            } else if (tag == "executableName") {
+                doc.metaInfo.executableName = scanner.text();
+            } else if (tag == "citation") {
+                doc.metaInfo.citations.push_back({scanner.attribute("doi").value_or(""),
+                                                  scanner.attribute("url").value_or("")});
+            } else if (tag == "clielement") {
+                doc.cliMapping.push_back({required("optionIdentifier"), ""});
+            } else if (tag == "mapping") {
+                if (doc.cliMapping.empty()) {
+                    throw std::runtime_error{"mapping outside of a clielement in line "
+                                             + std::to_string(scanner.line())};
+                }
+                doc.cliMapping.back().referenceName = required("referenceName");
+            } else if (tag == "PARAMETERS") {
+                isCTD        = true;
+                inParameters = true;
+                children     = {&doc.params};
+                nodePath.clear();
+                nodeLengths.clear();
+            }
+            continue;
+        }
+
+        if (tag == "NODE") {
+            auto node = readNode();
+            children.back()->push_back(std::move(node));
+            // the parent is not changed until this node is closed, so the pointer stays valid
+            children.push_back(&std::get<Node::Children>(children.back()->back().value));
+            nodeLengths.push_back(nodePath.size());
+            nodePath = itemPath;
+        } else if (tag == "ITEM" || tag == "ITEMLIST") {
+            auto isList = tag == "ITEMLIST";
+            auto node   = readNode();
+            node.value  = detail::readValue(scanner, itemPath, isList, node.tags);
+            children.back()->push_back(std::move(node));
+            if (isList) {
+                list = &children.back()->back();
+            }
+        } else if (tag == "LISTITEM") {
+            if (!list) {
+                throw std::runtime_error{"LISTITEM outside of an ITEMLIST in line " + std::to_string(scanner.line())};
+            }
+            detail::appendListItem(*list, itemPath, required("value"));
+        }
+    }
+
+    if (!isCTD) {
+        throw std::runtime_error{"not a CTD document, neither a tool nor a PARAMETERS element was found"};
+    }
+    return doc;
+}
+
+auto importCTD(std::filesystem::path const & path) -> ToolInfo {
+    auto file = MappedFile{path};
+    return importCTDFromString(file.data());
+}
+
+} // namespace tdl
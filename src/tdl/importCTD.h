@@ -0,0 +1,29 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <filesystem>
+#include <string_view>
+
+#include "ToolInfo.h"
+
+namespace tdl {
+
+/*!\brief converts a CTD document into a ToolInfo
+ *
+ * This is the inverse of `convertToCTD`, `importCTDFromString(convertToCTD(doc))` gives a ToolInfo
+ * equal to `doc`, except for empty lists of valid values, which are not written.
+ * CTDs written by other tools, e.g. OpenMS, are read as well: the `type` of an `ITEM` or `ITEMLIST`
+ * selects the value type, `restrictions` become limits or valid values, `supported_formats` become
+ * valid values of file parameters and `required`, `advanced` and `tags` become tags.
+ * The `manual` of the tool is ignored.
+ * Throws `std::runtime_error` on malformed documents, unknown types and invalid values.
+ */
+auto importCTDFromString(std::string_view document) -> ToolInfo;
+
+//!\brief same as `importCTDFromString`, but reads the document from a file
+auto importCTD(std::filesystem::path const & path) -> ToolInfo;
+
+} // namespace tdl
@@ -0,0 +1,365 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "importCWL.h"
+
+#include <iterator>
+#include <map>
+#include <stdexcept>
+
+#include "cwl_v1_2.h"
+
+namespace tdl {
+
+namespace cwl = w3id_org::cwl::cwl;
+
+namespace detail {
+
+//!\brief the parts of a (possibly nested) cwl type, that can be expressed by a tdl::Node
+struct CWLTypeInfo {
+    bool                                  optional{false}; //!\brief 'null' is one of the alternatives
+    bool                                  array{false};    //!\brief the type is wrapped in an array schema
+    std::string                           name{};          //!\brief the scalar type name, e.g. "long" or "File"
+    cwl::CommandInputRecordSchema const * record{};        //!\brief set if the type is a record
+    cwl::CommandInputEnumSchema const *   enumSchema{};    //!\brief set if the type is an enum
+};
+
+//!\brief handles type names given as strings, including the short forms "type?" and "type[]"
+inline void collectTypeName(std::string name, CWLTypeInfo & info) {
+    auto endsWith = [&](std::string const & suffix) {
+        return name.size() >= suffix.size() && name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0;
+    };
+
+    if (endsWith("?")) {
+        info.optional = true;
+        name.pop_back();
+    }
+    if (endsWith("[]")) {
+        info.array = true;
+        name.resize(name.size() - 2);
+    }
+
+    if (name == "null") {
+        info.optional = true;
+    } else {
+        info.name = name;
+    }
+}
+
+//!\brief traverses the alternatives of a cwl type and collects them into a CWLTypeInfo
+template <typename Type>
+void collectType(Type const & type, CWLTypeInfo & info) {
+    std::visit(
+        [&](auto const & t) {
+            using T = std::decay_t<decltype(t)>;
+            if constexpr (std::is_same_v<T, cwl::CWLType>) {
+                collectTypeName(std::string{to_string(t)}, info);
+            } else if constexpr (std::is_same_v<T, std::string>) {
+                collectTypeName(t, info);
+            } else if constexpr (is_vector_v<T>) {
+                for (auto const & alternative : t) {
+                    collectType(alternative, info);
+                }
+            } else if constexpr (std::is_same_v<T, cwl::CommandInputArraySchema>
+                                 || std::is_same_v<T, cwl::CommandOutputArraySchema>) {
+                info.array = true;
+                collectType(*t.items, info);
+            } else if constexpr (std::is_same_v<T, cwl::CommandInputRecordSchema>) {
+                info.record = &t;
+            } else if constexpr (std::is_same_v<T, cwl::CommandInputEnumSchema>) {
+                info.enumSchema = &t;
+            }
+        },
+        type);
+}
+
+//!\brief joins a cwl documentation entry, which can be a single string or a list of strings
+inline auto documentation(std::variant<std::monostate, std::string, std::vector<std::string>> const & doc)
+    -> std::string {
+    if (auto str = std::get_if<std::string>(&doc)) {
+        return *str;
+    }
+    if (auto list = std::get_if<std::vector<std::string>>(&doc)) {
+        auto result = std::string{};
+        for (auto const & line : *list) {
+            if (!result.empty()) {
+                result.push_back('\n');
+            }
+            result.append(line);
+        }
+        return result;
+    }
+    return {};
+}
+
+//!\brief strips document prefixes of identifiers, e.g. "#main/input" becomes "input"
+inline auto shortName(std::string const & id) -> std::string {
+    auto pos = id.find_last_of("#/");
+    return pos == std::string::npos ? id : id.substr(pos + 1);
+}
+
+//!\brief extracts the referenced input name of an output glob, e.g. "$(inputs.out)*"
+inline auto globReference(std::string const & glob) -> std::optional<std::tuple<std::string, bool>> {
+    static auto const prefix = std::string{"$(inputs."};
+
+    if (glob.compare(0, prefix.size(), prefix) != 0) {
+        return std::nullopt;
+    }
+    auto end = glob.find(')', prefix.size());
+    if (end == std::string::npos) {
+        return std::nullopt;
+    }
+    auto suffix = glob.substr(end + 1);
+    if (!suffix.empty() && suffix != "*") {
+        return std::nullopt;
+    }
+    return std::tuple{glob.substr(prefix.size(), end - prefix.size()), /*.prefixed = */ suffix == "*"};
+}
+
+//!\brief an output of the cwl tool that refers to one of its inputs
+struct OutputReference {
+    CWLTypeInfo type{};
+    bool        prefixed{};
+};
+
+using OutputReferences = std::map<std::string, OutputReference>;
+
+inline auto collectOutputReferences(std::vector<cwl::CommandOutputParameter> const & outputs) -> OutputReferences {
+    auto references = OutputReferences{};
+    for (auto const & output : outputs) {
+        auto binding = std::get_if<cwl::CommandOutputBinding>(&*output.outputBinding);
+        if (!binding) {
+            continue;
+        }
+        auto glob = std::string{};
+        if (auto str = std::get_if<std::string>(&*binding->glob)) {
+            glob = *str;
+        } else if (auto expr = std::get_if<w3id_org::cwl::cwl_expression_string>(&*binding->glob)) {
+            glob = expr->s;
+        }
+        if (auto ref = globReference(glob)) {
+            auto & [name, prefixed] = *ref;
+            auto & reference        = references[name];
+            reference.prefixed      = prefixed;
+            collectType(*output.type, reference.type);
+        }
+    }
+    return references;
+}
+
+//!\brief converts the default value of a CommandInputParameter into a yaml node
+inline auto defaultValue(cwl::CommandInputParameter const & input) -> std::optional<YAML::Node> {
+    if (auto value = std::get_if<std::any>(&*input.default_)) {
+        return w3id_org::cwl::toYaml(*value, {});
+    }
+    if (std::holds_alternative<std::monostate>(*input.default_)) {
+        return std::nullopt;
+    }
+    return YAML::Node{}; // a File or Directory object, which is not expressable as a value
+}
+
+//!\brief converts a scalar cwl input into a value and the tags it implies
+template <typename InputType>
+auto importScalar(InputType const & input, CWLTypeInfo const & type, Node & node) -> bool {
+    auto const & name = type.name;
+
+    if (name == "boolean") {
+        node.value = BoolValue{};
+    } else if (name == "int" || name == "long") {
+        node.value = IntValue{};
+    } else if (name == "float" || name == "double") {
+        node.value = DoubleValue{};
+    } else if (name == "string" || name == "File" || name == "Directory" || type.enumSchema) {
+        auto value = StringValue{};
+        if (type.enumSchema) {
+            value.validValues = std::vector<std::string>{};
+            for (auto const & symbol : *type.enumSchema->symbols) {
+                value.validValues->push_back(shortName(symbol));
+            }
+        }
+        node.value = value;
+        if (name == "File") {
+            node.tags.insert(Tag::file);
+        } else if (name == "Directory") {
+            node.tags.insert(Tag::directory);
+        }
+    } else {
+        return false;
+    }
+
+    // only top level parameters carry default values
+    if constexpr (std::is_same_v<InputType, cwl::CommandInputParameter>) {
+        auto required = node.tags.contains(Tag::required);
+        auto value    = defaultValue(input);
+        if (!value) {
+            if (!required) {
+                node.tags.insert(Tag::no_default);
+            }
+            return true;
+        }
+        if (required) {
+            node.tags.insert(Tag::default_as_hint);
+        }
+        if (!value->IsScalar()) {
+            return true;
+        }
+        std::visit(
+            [&](auto & v) {
+                using T = std::decay_t<decltype(v)>;
+                if constexpr (std::is_same_v<T, BoolValue>) {
+                    v = value->template as<bool>();
+                } else if constexpr (std::is_same_v<T, IntValue>) {
+                    v.value = value->template as<int>();
+                } else if constexpr (std::is_same_v<T, DoubleValue>) {
+                    v.value = value->template as<double>();
+                } else if constexpr (std::is_same_v<T, StringValue>) {
+                    if (!node.tags.contains(Tag::file) && !node.tags.contains(Tag::directory)) {
+                        v.value = value->template as<std::string>();
+                    }
+                }
+            },
+            node.value);
+    }
+    return true;
+}
+
+//!\brief converts a list typed cwl input into a list value and the tags it implies
+inline auto importList(CWLTypeInfo const & type, Node & node) -> bool {
+    auto const & name = type.name;
+
+    if (name == "int" || name == "long") {
+        node.value = IntValueList{};
+    } else if (name == "float" || name == "double") {
+        node.value = DoubleValueList{};
+    } else if (name == "string" || name == "File" || name == "Directory") {
+        node.value = StringValueList{};
+        if (name == "File") {
+            node.tags.insert(Tag::file);
+        } else if (name == "Directory") {
+            node.tags.insert(Tag::directory);
+        }
+    } else {
+        return false;
+    }
+    return true;
+}
+
+//!\brief converts an input that is referenced by an output glob into an output node
+inline void importOutput(OutputReference const & output, Node & node) {
+    node.tags.insert(Tag::output);
+    if (output.prefixed) {
+        node.tags.insert(Tag::prefixed);
+        if (output.type.array) {
+            node.value = StringValueList{};
+        } else {
+            node.value = StringValue{};
+        }
+        return;
+    }
+    node.value = StringValue{};
+    if (output.type.name == "Directory") {
+        node.tags.insert(Tag::directory);
+    } else {
+        node.tags.insert(Tag::file);
+    }
+}
+
+/*!\brief converts a single CommandInputParameter or CommandInputRecordField into a Node
+ *
+ * Returns std::nullopt, if the type of the input can not be expressed by a Node.
+ */
+template <typename InputType>
+auto importInput(InputType const &       input,
+                 OutputReferences const & outputs,
+                 std::vector<CLIMapping> & cliMapping) -> std::optional<Node> {
+    auto node = Node{};
+    if constexpr (std::is_same_v<InputType, cwl::CommandInputRecordField>) {
+        node.name = shortName(*input.name);
+    } else {
+        if (auto id = std::get_if<std::string>(&*input.id)) {
+            node.name = shortName(*id);
+        }
+    }
+    node.description = documentation(*input.doc);
+
+    auto type = CWLTypeInfo{};
+    collectType(*input.type, type);
+    if (!type.optional) {
+        node.tags.insert(Tag::required);
+    }
+
+    if (auto output = outputs.find(node.name); output != outputs.end()) {
+        importOutput(output->second, node);
+    } else if (type.record) {
+        auto children = Node::Children{};
+        if (auto fields = std::get_if<std::vector<cwl::CommandInputRecordField>>(&*type.record->fields)) {
+            for (auto const & field : *fields) {
+                if (auto child = importInput(field, {}, cliMapping)) {
+                    children.push_back(std::move(*child));
+                }
+            }
+        }
+        node.value = std::move(children);
+    } else if (type.array) {
+        if (!importList(type, node)) {
+            return std::nullopt;
+        }
+    } else if (!importScalar(input, type, node)) {
+        return std::nullopt;
+    }
+
+    if (auto binding = std::get_if<cwl::CommandLineBinding>(&*input.inputBinding)) {
+        if (auto prefix = std::get_if<std::string>(&*binding->prefix)) {
+            cliMapping.push_back(CLIMapping{*prefix, node.name});
+        }
+    }
+    return node;
+}
+
+} // namespace detail
+
+auto importCWL(cwl::CommandLineTool const & tool) -> ToolInfo {
+    auto doc = ToolInfo{};
+
+    if (auto label = std::get_if<std::string>(&*tool.label)) {
+        doc.metaInfo.name = *label;
+    }
+    doc.metaInfo.description = detail::documentation(*tool.doc);
+
+    auto baseCommand = std::vector<std::string>{};
+    if (auto command = std::get_if<std::string>(&*tool.baseCommand)) {
+        baseCommand.push_back(*command);
+    } else if (auto commands = std::get_if<std::vector<std::string>>(&*tool.baseCommand)) {
+        baseCommand = *commands;
+    }
+    if (!baseCommand.empty()) {
+        doc.metaInfo.executableName = baseCommand.front();
+    }
+
+    auto outputs = detail::collectOutputReferences(*tool.outputs);
+    for (auto const & input : *tool.inputs) {
+        if (auto node = detail::importInput(input, outputs, doc.cliMapping)) {
+            doc.params.push_back(std::move(*node));
+        }
+    }
+
+    // Additional base commands (sub commands) are nodes that contain all parameters.
+    // CWL does not record which parameters belong to which sub command, so all are placed into the innermost one.
+    for (auto iter = baseCommand.rbegin(); baseCommand.size() > 1 && iter != std::prev(baseCommand.rend()); ++iter) {
+        auto subCommand = Node{*iter, "", {"basecommand"}, std::move(doc.params)};
+        doc.params      = Node::Children{std::move(subCommand)};
+    }
+    return doc;
+}
+
+auto importCWL(std::filesystem::path const & path) -> ToolInfo {
+    auto document = w3id_org::cwl::load_document(path);
+    auto tool     = std::get_if<cwl::CommandLineTool>(&document);
+    if (!tool) {
+        throw std::runtime_error{"CWL document " + path.string() + " is not a CommandLineTool"};
+    }
+    return importCWL(*tool);
+}
+
+} // namespace tdl
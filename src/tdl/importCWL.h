@@ -0,0 +1,31 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <filesystem>
+
+#include "ToolInfo.h"
+
+namespace w3id_org::cwl::cwl {
+struct CommandLineTool;
+}
+
+namespace tdl {
+
+/*!\brief converts a CWL CommandLineTool into a ToolInfo
+ *
+ * This is the inverse of `convertToCWL`. Tools generated by TDL are
+ * imported such that `convertToCWL(importCWL(tool))` reproduces the same CWL document.
+ * Constructs that TDL can not express (e.g. outputs without a matching input) are skipped.
+ */
+auto importCWL(w3id_org::cwl::cwl::CommandLineTool const & tool) -> ToolInfo;
+
+/*!\brief loads a CWL document and converts it into a ToolInfo
+ *
+ * Throws if the document can not be loaded or is not a CommandLineTool.
+ */
+auto importCWL(std::filesystem::path const & path) -> ToolInfo;
+
+} // namespace tdl
@@ -0,0 +1,82 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace tdl {
+
+namespace detail {
+
+//!\brief the number of workers `parallelFor` uses for `count` tasks, `threads == 0` uses all available cores
+inline auto workerCount(std::size_t threads, std::size_t count) -> std::size_t {
+    if (threads == 0) {
+        threads = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    }
+    return std::min(threads, count);
+}
+
+/*!\brief calls `fn(i, worker)` for every `i` in [0, count), on `workerCount(threads, count)` workers
+ *
+ * Each worker takes the next unprocessed index, so a slow task does not stall a whole chunk. `worker`
+ * is the number of the calling worker, the current thread is worker 0.
+ * If `fn` throws, no further indices are started and the first exception is rethrown once all workers
+ * finished. If a thread can not be started, the running workers are stopped and joined before the
+ * exception is passed on.
+ */
+template <typename Fn>
+void parallelFor(std::size_t count, std::size_t threads, Fn && fn) {
+    auto workers    = workerCount(threads, count);
+    auto next       = std::atomic<std::size_t>{0};
+    auto error      = std::exception_ptr{};
+    auto errorMutex = std::mutex{};
+
+    auto worker = [&](std::size_t id) {
+        for (auto i = next++; i < count; i = next++) {
+            try {
+                fn(i, id);
+            } catch (...) {
+                auto lock = std::lock_guard{errorMutex};
+                if (!error) {
+                    error = std::current_exception();
+                }
+                next = count;
+            }
+        }
+    };
+
+    auto pool = std::vector<std::thread>{};
+    try {
+        pool.reserve(workers);
+        for (std::size_t id = 1; id < workers; ++id) {
+            pool.emplace_back(worker, id);
+        }
+    } catch (...) {
+        next = count;
+        for (auto & t : pool) {
+            t.join();
+        }
+        throw;
+    }
+    if (workers > 0) {
+        worker(0);
+    }
+    for (auto & t : pool) {
+        t.join();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+}
+
+} // namespace detail
+
+} // namespace tdl
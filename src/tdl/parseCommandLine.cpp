@@ -0,0 +1,156 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "parseCommandLine.h"
+
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "parseValue.h"
+
+namespace tdl {
+
+namespace detail {
+
+//!\brief collects the scopes of a tree, and the nodes of each scope by name and by path
+struct CommandTableBuilder {
+    std::vector<CommandScope> &                                      scopes;
+    std::vector<std::unordered_map<std::string_view, Node *>>        byName{}; //!< Nodes of each scope by name
+    std::unordered_map<std::string, std::pair<Node *, std::size_t>> byPath{}; //!< Nodes and their scope by path
+
+    void add(Node::Children & children, std::size_t scope, std::string const & prefix) {
+        for (auto & child : children) {
+            auto path = prefix.empty() ? child.name : prefix + ':' + child.name;
+
+            auto grandChildren = std::get_if<Node::Children>(&child.value);
+            if (!grandChildren) {
+                byName[scope].emplace(child.name, &child);
+            } else if (child.tags.contains(Tag::basecommand)) {
+                auto subScope = scopes.size();
+                scopes.emplace_back().parent = scope;
+                byName.emplace_back();
+                scopes[scope].subCommands.emplace(child.name, subScope);
+                add(*grandChildren, subScope, path);
+            } else {
+                add(*grandChildren, scope, path);
+            }
+            byPath.emplace(std::move(path), std::pair{&child, scope});
+        }
+    }
+};
+
+} // namespace detail
+
+CommandLineParser::CommandLineParser(ToolInfo & doc) {
+    scopes_.emplace_back();
+    auto builder = detail::CommandTableBuilder{scopes_, {{}}, {}};
+    builder.add(doc.params, 0, "");
+
+    for (auto const & [optionIdentifier, referenceName] : doc.cliMapping) {
+        if (auto iter = builder.byPath.find(referenceName); iter != builder.byPath.end()) {
+            scopes_[iter->second.second].options.emplace(optionIdentifier, iter->second.first);
+            continue;
+        }
+        // a plain name can refer to a node in several sub commands
+        for (std::size_t scope = 0; scope < scopes_.size(); ++scope) {
+            auto const & byName = builder.byName[scope];
+            if (auto iter = byName.find(referenceName); iter != byName.end()) {
+                scopes_[scope].options.emplace(optionIdentifier, iter->second);
+            }
+        }
+    }
+
+    for (auto & scope : scopes_) {
+        for (auto const & [option, node] : scope.options) {
+            if (node->tags.contains(Tag::required)) {
+                scope.required.emplace_back(option, node);
+            }
+        }
+    }
+}
+
+auto CommandLineParser::findOption(std::size_t scope, std::string_view optionIdentifier) -> Node * {
+    for (; scope != detail::CommandScope::npos; scope = scopes_[scope].parent) {
+        auto const & options = scopes_[scope].options;
+        if (auto iter = options.find(optionIdentifier); iter != options.end()) {
+            return iter->second;
+        }
+    }
+    return nullptr;
+}
+
+auto CommandLineParser::parse(int argc, char const * const * argv) -> ParsedCommandLine {
+    auto result = ParsedCommandLine{};
+
+    auto scope          = std::size_t{0};
+    auto selected       = std::vector<std::size_t>{0}; // scopes of the given sub commands
+    auto seen           = std::unordered_set<Node const *>{};
+    auto onlyPositional = false;
+
+    for (int i = 1; i < argc; ++i) {
+        auto arg = std::string_view{argv[i]};
+
+        if (!onlyPositional && arg == "--") {
+            onlyPositional = true;
+            continue;
+        }
+
+        if (!onlyPositional && arg.size() > 1 && arg[0] == '-') {
+            auto option      = arg;
+            auto inlineValue = std::optional<std::string_view>{};
+            if (auto pos = arg.find('='); pos != std::string_view::npos) {
+                option      = arg.substr(0, pos);
+                inlineValue = arg.substr(pos + 1);
+            }
+
+            auto node = findOption(scope, option);
+            if (!node) {
+                throw std::runtime_error{"unknown option " + std::string{option}};
+            }
+            auto firstOccurrence = seen.insert(node).second;
+
+            if (std::holds_alternative<BoolValue>(node->value) && !inlineValue) {
+                node->value = true;
+                continue;
+            }
+            if (!inlineValue) {
+                if (i + 1 == argc) {
+                    throw std::runtime_error{"option " + std::string{option} + " requires a value"};
+                }
+                inlineValue = argv[++i];
+            }
+            detail::assignValue(*node, option, *inlineValue, firstOccurrence);
+            continue;
+        }
+
+        // sub commands have to precede all positional arguments
+        auto const & subCommands = scopes_[scope].subCommands;
+        if (auto iter = subCommands.find(arg);
+            !onlyPositional && result.positional.empty() && iter != subCommands.end()) {
+            scope = iter->second;
+            selected.push_back(scope);
+            result.subCommands.emplace_back(arg);
+            continue;
+        }
+        result.positional.emplace_back(arg);
+    }
+
+    for (auto s : selected) {
+        for (auto const & [option, node] : scopes_[s].required) {
+            if (seen.count(node) == 0) {
+                throw std::runtime_error{"missing required option " + std::string{option}};
+            }
+        }
+    }
+    return result;
+}
+
+auto parseCommandLine(ToolInfo & doc, int argc, char const * const * argv) -> ParsedCommandLine {
+    return CommandLineParser{doc}.parse(argc, argv);
+}
+
+} // namespace tdl
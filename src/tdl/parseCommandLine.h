@@ -0,0 +1,74 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "ToolInfo.h"
+
+namespace tdl {
+
+//!\brief Result of `parseCommandLine`, the parsed values are written into the ToolInfo
+struct ParsedCommandLine {
+    std::vector<std::string> subCommands{}; //!< Names of the selected `basecommand` nodes, outermost first
+    std::vector<std::string> positional{};  //!< Arguments that are neither options nor sub commands
+};
+
+namespace detail {
+//!\brief the options and sub commands of the top level or of a `basecommand` node
+struct CommandScope {
+    static constexpr std::size_t npos = static_cast<std::size_t>(-1);
+
+    std::size_t                                       parent{npos};
+    std::unordered_map<std::string_view, Node *>      options{};     //!< Nodes by option identifier
+    std::unordered_map<std::string_view, std::size_t> subCommands{}; //!< Scope index by sub command name
+    std::vector<std::pair<std::string_view, Node *>>  required{};    //!< Options tagged `required`
+};
+} // namespace detail
+
+/*!\brief parses the arguments of a program and writes them into the values of a ToolInfo
+ *
+ * Options are the `optionIdentifier`s of `doc.cliMapping`. Their `referenceName` is either the path
+ * of a node (names separated by ':') or the name of a node.
+ * Children of a node tagged `basecommand` are only accepted after the name of that node was given
+ * as a sub command. Options of enclosing commands stay valid.
+ *
+ *  - values are given as `--option value` or `--option=value`
+ *  - bool values are flags, `--option=false` is accepted as well
+ *  - every occurrence of a list option appends one value, the default values are replaced
+ *  - `--` ends the options, all following arguments are positional
+ *
+ * Limits and valid values are checked while parsing. Options tagged `required` in the selected
+ * commands must be given.
+ *
+ * The hash tables of the options are built on construction, so the time of `parse` only depends
+ * on the number of arguments. Like `ParamIndex`, the parser refers to the nodes and the cli mapping
+ * of the ToolInfo and stays valid as long as they are not restructured.
+ */
+class CommandLineParser {
+public:
+    explicit CommandLineParser(ToolInfo & doc);
+
+    /*!\brief parses the arguments, `argv[0]` is skipped
+     *
+     * Throws `std::runtime_error` on unknown options, malformed or invalid values and missing required options.
+     * The values are written into the nodes the parser refers to, so `parse` is not const.
+     */
+    auto parse(int argc, char const * const * argv) -> ParsedCommandLine;
+
+private:
+    auto findOption(std::size_t scope, std::string_view optionIdentifier) -> Node *;
+
+    std::vector<detail::CommandScope> scopes_{};
+};
+
+//!\brief parses the arguments of a program, see `CommandLineParser`
+auto parseCommandLine(ToolInfo & doc, int argc, char const * const * argv) -> ParsedCommandLine;
+
+} // namespace tdl
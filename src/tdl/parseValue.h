@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <algorithm>
+#include <charconv>
+#include <cmath>
+#include <limits>
+#include <locale>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "ToolInfo.h"
+
+namespace tdl {
+
+// Parsing of values given as strings, shared by `parseCommandLine` and `applyValues`.
+// `name` is only used for error messages, e.g. an option identifier or the path of a node.
+namespace detail {
+
+[[noreturn]] inline void throwInvalidValue(std::string_view name, std::string_view value, std::string_view reason) {
+    throw std::runtime_error{"invalid value '" + std::string{value} + "' for " + std::string{name} + ": "
+                             + std::string{reason}};
+}
+
+inline auto parseBool(std::string_view name, std::string_view str) -> bool {
+    if (str == "true" || str == "1") {
+        return true;
+    }
+    if (str == "false" || str == "0") {
+        return false;
+    }
+    throwInvalidValue(name, str, "expected true or false");
+}
+
+inline auto parseNumber(std::string_view name, std::string_view str, int) -> int {
+    auto value     = int{};
+    auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), value);
+    if (ec == std::errc::result_out_of_range) {
+        throwInvalidValue(name, str, "out of range");
+    }
+    if (ec != std::errc{} || ptr != str.data() + str.size()) {
+        throwInvalidValue(name, str, "expected an integer");
+    }
+    return value;
+}
+
+// floating point from_chars is not available in all supported standard libraries. A stream with the classic
+// locale does not depend on the global locale, and unlike strtod it accepts neither "nan" nor "inf".
+// Overflow sets the failbit and yields the largest value, subnormal values like 1e-310 are accepted.
+inline auto parseNumber(std::string_view name, std::string_view str, double) -> double {
+    auto stream = std::istringstream{std::string{str}};
+    stream.imbue(std::locale::classic());
+    auto value = double{};
+    stream >> std::noskipws >> value;
+    if (stream.fail() && std::abs(value) == std::numeric_limits<double>::max()) {
+        throwInvalidValue(name, str, "out of range");
+    }
+    if (stream.fail() || stream.peek() != std::istringstream::traits_type::eof() || std::isnan(value)) {
+        throwInvalidValue(name, str, "expected a number");
+    }
+    return value;
+}
+
+template <typename T, typename ListType>
+auto parseLimited(std::string_view name, std::string_view str, TValue<T, ListType> const & limits) -> T {
+    auto value = parseNumber(name, str, T{});
+    if (limits.minLimit && *limits.minLimit > value) {
+        throwInvalidValue(name, str, "below the minimum " + std::to_string(*limits.minLimit));
+    }
+    if (limits.maxLimit && *limits.maxLimit < value) {
+        throwInvalidValue(name, str, "above the maximum " + std::to_string(*limits.maxLimit));
+    }
+    return value;
+}
+
+//!\brief the valid values of files are their supported formats, see `isValidString`
+template <typename ListType>
+auto parseString(std::string_view                            name,
+                 std::string_view                            str,
+                 TStringValue<std::string, ListType> const & values,
+                 Tags const &                                tags) -> std::string {
+    if (values.validValues && !isValidString(str, *values.validValues, tags)) {
+        throwInvalidValue(name, str, "not one of the valid values");
+    }
+    return std::string{str};
+}
+
+//!\brief writes a value into the node, lists get the value appended, `clearList` replaces their current values
+inline void assignValue(Node & node, std::string_view name, std::string_view str, bool clearList) {
+    std::visit(
+        [&](auto & value) {
+            using V = std::decay_t<decltype(value)>;
+            if constexpr (std::is_same_v<V, BoolValue>) {
+                value = parseBool(name, str);
+            } else if constexpr (std::is_same_v<V, IntValue> || std::is_same_v<V, DoubleValue>) {
+                value.value = parseLimited(name, str, value);
+            } else if constexpr (std::is_same_v<V, StringValue>) {
+                value.value = parseString(name, str, value, node.tags);
+            } else if constexpr (std::is_same_v<V, Node::Children>) {
+                throw std::runtime_error{std::string{name} + " does not refer to a value"};
+            } else {
+                if (clearList) {
+                    value.value.clear();
+                }
+                if constexpr (std::is_same_v<V, StringValueList>) {
+                    value.value.push_back(parseString(name, str, value, node.tags));
+                } else {
+                    value.value.push_back(parseLimited(name, str, value));
+                }
+            }
+        },
+        node.value);
+}
+
+} // namespace detail
+
+} // namespace tdl
@@ -4,6 +4,26 @@
 
 #pragma once
 
+#include "applyValues.h"
+#include "CachedExporter.h"
 #include "convertToCTD.h"
 #include "convertToCWL.h"
+#include "DescriptorFormat.h"
+#include "diff.h"
+#include "embedDescriptors.h"
+#include "exportAll.h"
+#include "ExportSink.h"
+#include "ExportStats.h"
+#include "fingerprint.h"
+#include "FlatToolInfo.h"
+#include "importCTD.h"
+#include "importCWL.h"
+#include "MappedFile.h"
+#include "ParamIndex.h"
+#include "parseCommandLine.h"
+#include "Snapshot.h"
 #include "ToolInfo.h"
+#include "Tracer.h"
+#include "Validator.h"
+#include "version.h"
+#include "writeFile.h"
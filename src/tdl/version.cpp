@@ -0,0 +1,17 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "version.h"
+
+#ifndef TDL_VERSION_STRING
+#    error "TDL_VERSION_STRING has to be defined by the build system"
+#endif
+
+namespace tdl {
+
+auto version() -> std::string_view {
+    return TDL_VERSION_STRING;
+}
+
+} // namespace tdl
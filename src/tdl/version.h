@@ -0,0 +1,14 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <string_view>
+
+namespace tdl {
+
+//!\brief the version of the TDL library, as set in cmake/version.cmake, e.g. "1.1.1"
+auto version() -> std::string_view;
+
+} // namespace tdl
@@ -0,0 +1,77 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "writeFile.h"
+
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+
+#include "MappedFile.h"
+#include "convertToCTD.h"
+#include "convertToCWL.h"
+
+namespace tdl {
+
+namespace detail {
+
+//!\brief a hidden file name next to `path`, unique across threads and, most likely, processes
+inline auto temporaryPath(std::filesystem::path const & path) -> std::filesystem::path {
+    static auto       counter = std::atomic<uint64_t>{};
+    static auto const seed    = std::random_device{}();
+
+    auto name = "." + path.filename().string() + ".tmp" + std::to_string(seed) + "-" + std::to_string(counter++);
+    return path.parent_path() / name;
+}
+
+} // namespace detail
+
+void writeFileAtomically(std::filesystem::path const & path, std::string_view content) {
+    auto tmp    = detail::temporaryPath(path);
+    auto remove = [&]() {
+        auto ec = std::error_code{};
+        std::filesystem::remove(tmp, ec);
+    };
+
+    auto ofs = std::ofstream{tmp, std::ios::binary};
+    ofs.write(content.data(), static_cast<std::streamsize>(content.size()));
+    ofs.close();
+    if (!ofs) {
+        remove();
+        throw std::runtime_error{"can not write " + path.string()};
+    }
+
+    auto ec = std::error_code{};
+    std::filesystem::rename(tmp, path, ec);
+    if (ec) {
+        remove();
+        throw std::runtime_error{"can not replace " + path.string() + ": " + ec.message()};
+    }
+}
+
+auto writeFileIfChanged(std::filesystem::path const & path, std::string_view content) -> bool {
+    auto ec   = std::error_code{};
+    auto size = std::filesystem::file_size(path, ec);
+    if (!ec && size == content.size()) {
+        try {
+            if (MappedFile{path}.data() == content) {
+                return false;
+            }
+        } catch (std::runtime_error const &) {
+            // can not be read, e.g. removed in the meantime, it is written again
+        }
+    }
+    writeFileAtomically(path, content);
+    return true;
+}
+
+auto writeIfChanged(std::filesystem::path const & path, ToolInfo const & doc, DescriptorFormat format) -> bool {
+    return writeFileIfChanged(path, format == DescriptorFormat::CTD ? convertToCTD(doc) : convertToCWL(doc));
+}
+
+} // namespace tdl
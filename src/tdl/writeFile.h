@@ -0,0 +1,34 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+#pragma once
+
+#include <filesystem>
+#include <string_view>
+
+#include "DescriptorFormat.h"
+#include "ToolInfo.h"
+
+namespace tdl {
+
+/*!\brief replaces the file at `path` by `content` in one step
+ *
+ * The content is written to a temporary file in the same directory, which is then renamed to `path`.
+ * Readers see either the old or the new file, never a partially written one.
+ * Throws `std::runtime_error` if writing or renaming fails, the temporary file is removed in that case.
+ */
+void writeFileAtomically(std::filesystem::path const & path, std::string_view content);
+
+/*!\brief replaces the file at `path` by `content`, unless it holds exactly that already
+ *
+ * An unchanged file keeps its modification time, so build systems do not rebuild what depends on it.
+ * The sizes are compared first, only files of the same size are read (through a memory mapping).
+ * Returns true if the file was written.
+ */
+auto writeFileIfChanged(std::filesystem::path const & path, std::string_view content) -> bool;
+
+//!\brief generates the descriptor of `doc` and writes it with `writeFileIfChanged`
+auto writeIfChanged(std::filesystem::path const & path, ToolInfo const & doc, DescriptorFormat format) -> bool;
+
+} // namespace tdl
@@ -0,0 +1,71 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <benchmark/benchmark.h>
+
+#include <tdl/tdl.h>
+
+namespace {
+
+//!\brief a tool with `paramCount` int and string parameters in groups of ten
+auto generateToolInfo(std::size_t paramCount) {
+    auto doc = tdl::ToolInfo{};
+    for (std::size_t i = 0; i < paramCount; i += 10) {
+        auto children = tdl::Node::Children{};
+        for (std::size_t j = i; j < i + 10 && j < paramCount; ++j) {
+            auto node = tdl::Node{};
+            node.name = "param" + std::to_string(j);
+            if (j % 2 == 0) {
+                node.value = tdl::IntValue{static_cast<int>(j % 1000), 0, 1000};
+            } else {
+                node.value = tdl::StringValue{"value " + std::to_string(j)};
+            }
+            children.push_back(std::move(node));
+        }
+        auto group  = tdl::Node{};
+        group.name  = "group" + std::to_string(i / 10);
+        group.value = std::move(children);
+        doc.params.push_back(std::move(group));
+    }
+    return doc;
+}
+
+//!\brief a CWL job with a value for every parameter
+auto generateJob(std::size_t paramCount) {
+    auto job = std::string{};
+    for (std::size_t i = 0; i < paramCount; ++i) {
+        if (i % 10 == 0) {
+            job += "group" + std::to_string(i / 10) + ":\n";
+        }
+        job += "  param" + std::to_string(i) + ": " + (i % 2 == 0 ? std::to_string(i % 1000) : "x") + "\n";
+    }
+    return job;
+}
+
+void apply_ctd(benchmark::State & state) {
+    auto doc = generateToolInfo(state.range(0));
+    auto ctd = tdl::convertToCTD(doc);
+
+    for (auto _ : state) {
+        tdl::applyValuesFromString(doc, ctd);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * ctd.size()));
+}
+
+void apply_cwl_job(benchmark::State & state) {
+    auto doc = generateToolInfo(state.range(0));
+    auto job = generateJob(state.range(0));
+
+    for (auto _ : state) {
+        tdl::applyValuesFromString(doc, job);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * job.size()));
+}
+
+} // namespace
+
+BENCHMARK(apply_ctd)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(apply_cwl_job)->Arg(100)->Arg(1000)->Arg(10000);
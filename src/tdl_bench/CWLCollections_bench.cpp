@@ -0,0 +1,66 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <benchmark/benchmark.h>
+
+#include <tdl/cwl_v1_2.h>
+
+namespace {
+
+namespace cwl = w3id_org::cwl;
+
+//!\brief a CommandLineTool with many inputs and outputs, which are stored in map form
+auto generateTool(std::size_t inputCount) {
+    auto tool = cwl::cwl::CommandLineTool{};
+    tool.cwlVersion = cwl::cwl::CWLVersion::v1_2;
+    tool.baseCommand = std::string{"tool"};
+
+    for (std::size_t i = 0; i < inputCount; ++i) {
+        auto name = "input" + std::to_string(i);
+
+        auto binding   = cwl::cwl::CommandLineBinding{};
+        binding.prefix = "--" + name;
+
+        auto input         = cwl::cwl::CommandInputParameter{};
+        input.id           = name;
+        input.doc          = "documentation of " + name;
+        input.type         = i % 2 ? cwl::cwl::CWLType::File : cwl::cwl::CWLType::long_;
+        input.inputBinding = binding;
+        tool.inputs->push_back(std::move(input));
+
+        if (i % 10 == 0) {
+            auto output = cwl::cwl::CommandOutputParameter{};
+            output.id   = "output" + std::to_string(i);
+            output.type = cwl::cwl::CWLType::File;
+            tool.outputs->push_back(std::move(output));
+        }
+    }
+    return cwl::DocumentRootType{std::move(tool)};
+}
+
+void cwl_store(benchmark::State & state) {
+    auto document = generateTool(state.range(0));
+    for (auto _ : state) {
+        auto yaml = cwl::toYaml(document, {});
+        benchmark::DoNotOptimize(yaml);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void cwl_load(benchmark::State & state) {
+    auto yaml = cwl::store_document_as_string(generateTool(state.range(0)));
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto node = YAML::Load(yaml);
+        state.ResumeTiming();
+        auto document = cwl::load_document_from_yaml(node);
+        benchmark::DoNotOptimize(document);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+} // namespace
+
+BENCHMARK(cwl_store)->Arg(100)->Arg(500);
+BENCHMARK(cwl_load)->Arg(100)->Arg(500);
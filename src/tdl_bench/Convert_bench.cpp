@@ -0,0 +1,212 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <filesystem>
+
+#include <yaml-cpp/yaml.h>
+
+#include <tdl/tdl.h>
+
+#include "SyntheticToolInfo.h"
+
+namespace {
+
+//!\brief the shapes selected by the benchmark argument
+auto shape(benchmark::State & state) -> synthetic::Config {
+    static auto const shapes = std::vector<std::pair<char const *, synthetic::Config>>{
+        {"flat, 100 params", {100, 0}},
+        {"nested, 1110 nodes", {10, 2}},
+        {"wide, 8420 nodes", {20, 2}},
+        {"deep, 9330 nodes", {6, 4}},
+        {"long lists and descriptions", {10, 2, 64, 400, 20}},
+    };
+    auto const & [label, config] = shapes.at(state.range(0));
+    state.SetLabel(label);
+    return config;
+}
+
+auto tagMix(benchmark::State & state) -> synthetic::Config {
+    static auto const mixes = std::vector<std::pair<char const *, synthetic::TagMix>>{
+        {"no tags", synthetic::TagMix::None},
+        {"typical tags", synthetic::TagMix::Typical},
+        {"all tags", synthetic::TagMix::All},
+    };
+    auto const & [label, mix] = mixes.at(state.range(0));
+    state.SetLabel(label);
+    auto config   = synthetic::Config{};
+    config.tagMix = mix;
+    return config;
+}
+
+//!\brief runs `convert` on the generated tree, reports nodes/s and output bytes/s
+template <typename Convert>
+void runConvert(benchmark::State & state, synthetic::Config const & config, Convert convert) {
+    auto doc   = synthetic::generate(config);
+    auto nodes = tdl::detail::countNodes(doc.params);
+    auto bytes = std::size_t{};
+    for (auto _ : state) {
+        auto output = convert(doc);
+        bytes       = output.size();
+        benchmark::DoNotOptimize(output);
+    }
+    state.SetItemsProcessed(state.iterations() * nodes);
+    state.SetBytesProcessed(state.iterations() * bytes);
+}
+
+void convert_ctd(benchmark::State & state) {
+    runConvert(state, shape(state), [](auto const & doc) { return tdl::convertToCTD(doc); });
+}
+
+void convert_cwl(benchmark::State & state) {
+    runConvert(state, shape(state), [](auto const & doc) { return tdl::convertToCWL(doc); });
+}
+
+void convert_ctd_tags(benchmark::State & state) {
+    runConvert(state, tagMix(state), [](auto const & doc) { return tdl::convertToCTD(doc); });
+}
+
+void convert_cwl_tags(benchmark::State & state) {
+    runConvert(state, tagMix(state), [](auto const & doc) { return tdl::convertToCWL(doc); });
+}
+
+//!\brief only the string generation of convertToCTD, the XMLNode tree is built once
+void ctd_generateString(benchmark::State & state) {
+    auto doc   = synthetic::generate(shape(state));
+    auto order = std::vector<std::string>{"name", "value", "type", "description", "required", "advanced", "restrictions"};
+
+    auto root = tdl::detail::XMLNode{"PARAMETERS"};
+    for (auto const & child : doc.params) {
+        root.children.push_back(tdl::detail::convertToCTD(child));
+    }
+
+    auto bytes = std::size_t{};
+    for (auto _ : state) {
+        auto output = root.generateString(order);
+        bytes       = output.size();
+        benchmark::DoNotOptimize(output);
+    }
+    state.SetItemsProcessed(state.iterations() * tdl::detail::countNodes(doc.params));
+    state.SetBytesProcessed(state.iterations() * bytes);
+}
+
+/*!\brief simplifyType on the type shapes convertToCWL produces
+ *
+ * simplifyType assigns to the node it was given, which changes all YAML::Nodes sharing it,
+ * so each batch works on fresh clones. Cloning is not timed.
+ */
+void cwl_simplifyType(benchmark::State & state) {
+    auto const types = std::vector<YAML::Node>{
+        YAML::Load("string"),
+        YAML::Load("[\"null\", long]"),
+        YAML::Load("{type: array, items: File}"),
+        YAML::Load("[\"null\", {type: array, items: string}]"),
+        YAML::Load("[\"null\", {type: record, fields: []}]"),
+    };
+    constexpr auto batchSize = std::size_t{1000};
+
+    // assigning to an existing YAML::Node would change the node it refers to, so the batch is refilled
+    auto batch = std::vector<YAML::Node>{};
+    batch.reserve(batchSize);
+    for (auto _ : state) {
+        state.PauseTiming();
+        batch.clear();
+        for (std::size_t i = 0; i < batchSize; ++i) {
+            batch.push_back(YAML::Clone(types[i % types.size()]));
+        }
+        state.ResumeTiming();
+        for (auto & type : batch) {
+            benchmark::DoNotOptimize(tdl::detail::simplifyType(type));
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * batchSize);
+}
+
+/*!\brief CTD and CWL of 16 tools with exportAll, the argument is the number of threads
+ *
+ * Measured in wall clock time, the nodes/s scale with the threads as long as the exports do not contend.
+ */
+void export_all(benchmark::State & state) {
+    auto docs  = std::vector<tdl::ToolInfo>{};
+    auto nodes = std::size_t{};
+    for (std::uint64_t seed = 1; seed <= 16; ++seed) {
+        auto config = synthetic::Config{};
+        config.seed = seed;
+        docs.push_back(synthetic::generate(config));
+        nodes += tdl::detail::countNodes(docs.back().params);
+    }
+    auto options    = tdl::ExportAllOptions{};
+    options.threads = static_cast<std::size_t>(state.range(0));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            tdl::exportAll(docs, {tdl::DescriptorFormat::CTD, tdl::DescriptorFormat::CWL}, options));
+    }
+    state.SetItemsProcessed(state.iterations() * nodes);
+}
+
+//!\brief a warm CachedExporter, compare with convert_cwl of the same shape
+void cached_cwl(benchmark::State & state) {
+    auto dir   = std::filesystem::temp_directory_path() / "tdl_cached_cwl_bench";
+    auto cache = tdl::CachedExporter{dir};
+    auto doc   = synthetic::generate(shape(state));
+    auto bytes = cache.get(doc, tdl::DescriptorFormat::CWL).data().size();
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(cache.get(doc, tdl::DescriptorFormat::CWL));
+    }
+    state.SetItemsProcessed(state.iterations() * tdl::detail::countNodes(doc.params));
+    state.SetBytesProcessed(state.iterations() * bytes);
+    std::filesystem::remove_all(dir);
+}
+
+/*!\brief streamCTD or streamCWL into a sink that drops the chunks, compare with convert_ctd and convert_cwl
+ *
+ * The counter `first_chunk_us` is the average time until the sink receives its first chunk.
+ */
+template <typename Stream>
+void runStream(benchmark::State & state, Stream stream) {
+    auto doc        = synthetic::generate(shape(state));
+    auto bytes      = std::size_t{};
+    auto firstChunk = std::chrono::steady_clock::duration{};
+    for (auto _ : state) {
+        auto start = std::chrono::steady_clock::now();
+        auto first = true;
+        bytes      = 0;
+        stream(doc, [&](std::string_view chunk) {
+            if (first) {
+                firstChunk += std::chrono::steady_clock::now() - start;
+                first = false;
+            }
+            bytes += chunk.size();
+            benchmark::DoNotOptimize(chunk.data());
+        });
+    }
+    state.SetItemsProcessed(state.iterations() * tdl::detail::countNodes(doc.params));
+    state.SetBytesProcessed(state.iterations() * bytes);
+    state.counters["first_chunk_us"] = benchmark::Counter(
+        std::chrono::duration<double, std::micro>{firstChunk}.count() / static_cast<double>(state.iterations()));
+}
+
+void stream_ctd(benchmark::State & state) {
+    runStream(state, [](auto const & doc, auto const & sink) { tdl::streamCTD(doc, sink); });
+}
+
+void stream_cwl(benchmark::State & state) {
+    runStream(state, [](auto const & doc, auto const & sink) { tdl::streamCWL(doc, sink); });
+}
+
+} // namespace
+
+BENCHMARK(convert_ctd)->DenseRange(0, 4);
+BENCHMARK(convert_cwl)->DenseRange(0, 4);
+BENCHMARK(convert_ctd_tags)->DenseRange(0, 2);
+BENCHMARK(convert_cwl_tags)->DenseRange(0, 2);
+BENCHMARK(ctd_generateString)->DenseRange(0, 4);
+BENCHMARK(cwl_simplifyType);
+BENCHMARK(cached_cwl)->DenseRange(0, 4);
+BENCHMARK(stream_ctd)->DenseRange(0, 4);
+BENCHMARK(stream_cwl)->DenseRange(0, 4);
+BENCHMARK(export_all)->Arg(1)->Arg(2)->Arg(4)->UseRealTime();
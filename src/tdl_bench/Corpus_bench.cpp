@@ -0,0 +1,147 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <memory>
+
+#include <tdl/cwl_v1_2.h>
+#include <tdl/tdl.h>
+
+namespace {
+
+//!\brief a CTD or CWL descriptor of the corpus, read into memory once
+struct CorpusFile {
+    std::filesystem::path path;
+    std::string           content;
+    bool                  isCTD;
+
+    auto import() const -> tdl::ToolInfo {
+        if (isCTD) {
+            return tdl::importCTDFromString(content);
+        }
+        auto document = w3id_org::cwl::load_document_from_string(content);
+        return tdl::importCWL(std::get<w3id_org::cwl::cwl::CommandLineTool>(document));
+    }
+
+    //!\brief exports into the format of the file
+    auto convert(tdl::ToolInfo const & doc) const -> std::string {
+        return isCTD ? tdl::convertToCTD(doc) : tdl::convertToCWL(doc);
+    }
+
+    /*!\brief imports, exports and imports again
+     *
+     * Both imports have to give the same ToolInfo and exporting that has to give the same document.
+     * Returns what went wrong, if anything did.
+     */
+    auto checkRoundTrip() const -> std::string {
+        try {
+            auto first    = import();
+            auto exported = convert(first);
+            auto again    = CorpusFile{path, exported, isCTD};
+            auto second   = again.import();
+            if (!tdl::diff(first, second).empty()) {
+                return path.filename().string() + ": the reimported tool differs";
+            }
+            if (convert(second) != exported) {
+                return path.filename().string() + ": the reexported document differs";
+            }
+        } catch (std::exception const & e) {
+            return path.filename().string() + ": " + e.what();
+        }
+        return {};
+    }
+};
+
+/*!\brief the *.ctd and *.cwl files of the corpus, sorted by name
+ *
+ * The directory is taken from the environment variable TDL_CORPUS, if it is set, otherwise the
+ * samples checked in at src/test_tdl/corpus are used.
+ */
+auto loadCorpus() -> std::vector<std::shared_ptr<CorpusFile const>> {
+    auto dir = std::filesystem::path{TDL_CORPUS_DIR};
+    if (auto env = std::getenv("TDL_CORPUS")) {
+        dir = env;
+    }
+
+    auto files = std::vector<std::shared_ptr<CorpusFile const>>{};
+    for (auto const & entry : std::filesystem::directory_iterator{dir}) {
+        auto extension = entry.path().extension();
+        if (extension == ".ctd" || extension == ".cwl") {
+            files.push_back(std::make_shared<CorpusFile const>(
+                CorpusFile{entry.path(), w3id_org::cwl::read_document(entry.path()), extension == ".ctd"}));
+        }
+    }
+    std::sort(files.begin(), files.end(), [](auto const & lhs, auto const & rhs) { return lhs->path < rhs->path; });
+    return files;
+}
+
+using Corpus = std::vector<std::shared_ptr<CorpusFile const>>;
+
+/*!\brief runs `f` on all files, reports the source bytes/s and the nodes/s
+ *
+ * Nothing is measured if a file does not survive the round trip.
+ */
+template <typename F>
+void replay(benchmark::State & state, Corpus const & files, F f) {
+    auto bytes = std::size_t{};
+    auto nodes = std::size_t{};
+    for (auto const & file : files) {
+        if (auto error = file->checkRoundTrip(); !error.empty()) {
+            state.SkipWithError(error.c_str());
+            return;
+        }
+        bytes += file->content.size();
+        nodes += tdl::detail::countNodes(file->import().params);
+    }
+    for (auto _ : state) {
+        for (auto const & file : files) {
+            f(*file);
+        }
+    }
+    state.SetBytesProcessed(state.iterations() * bytes);
+    state.SetItemsProcessed(state.iterations() * nodes);
+}
+
+void corpusImport(benchmark::State & state, Corpus const & files) {
+    replay(state, files, [](CorpusFile const & file) { benchmark::DoNotOptimize(file.import()); });
+}
+
+//!\brief only the export, the tools are imported once
+void corpusExport(benchmark::State & state, Corpus const & files) {
+    auto docs = std::vector<tdl::ToolInfo>{};
+    for (auto const & file : files) {
+        docs.push_back(file->import());
+    }
+    auto index = std::size_t{};
+    replay(state, files, [&](CorpusFile const & file) {
+        benchmark::DoNotOptimize(file.convert(docs[index]));
+        index = (index + 1) % docs.size();
+    });
+}
+
+void corpusReplay(benchmark::State & state, Corpus const & files) {
+    replay(state, files, [](CorpusFile const & file) { benchmark::DoNotOptimize(file.convert(file.import())); });
+}
+
+//!\brief one benchmark per file and phase, and the replay of the whole corpus
+auto registerCorpus() -> bool {
+    auto files = loadCorpus();
+    for (auto const & file : files) {
+        auto name = file->path.filename().string();
+        benchmark::RegisterBenchmark(("corpus_import/" + name).c_str(), corpusImport, Corpus{file});
+        benchmark::RegisterBenchmark(("corpus_export/" + name).c_str(), corpusExport, Corpus{file});
+    }
+    if (!files.empty()) {
+        benchmark::RegisterBenchmark("corpus_replay/all", corpusReplay, files);
+    }
+    return true;
+}
+
+auto const corpusRegistered = registerCorpus();
+
+} // namespace
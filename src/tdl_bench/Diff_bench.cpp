@@ -0,0 +1,60 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <benchmark/benchmark.h>
+
+#include <tdl/tdl.h>
+
+namespace {
+
+//!\brief a tool with `paramCount` int parameters in groups of ten
+auto generateToolInfo(std::size_t paramCount) {
+    auto doc = tdl::ToolInfo{};
+    for (std::size_t i = 0; i < paramCount; i += 10) {
+        auto children = tdl::Node::Children{};
+        for (std::size_t j = i; j < i + 10 && j < paramCount; ++j) {
+            auto node  = tdl::Node{};
+            node.name  = "param" + std::to_string(j);
+            node.value = tdl::IntValue{0, 0, 1000};
+            doc.cliMapping.push_back({"--" + node.name, node.name});
+            children.push_back(std::move(node));
+        }
+        auto group  = tdl::Node{};
+        group.name  = "group" + std::to_string(i / 10);
+        group.value = std::move(children);
+        doc.params.push_back(std::move(group));
+    }
+    return doc;
+}
+
+//!\brief the tool gained one option
+void diff_one_added(benchmark::State & state) {
+    auto a = generateToolInfo(state.range(0));
+    auto b = a;
+    std::get<tdl::Node::Children>(b.params[0].value).push_back(tdl::Node{"new", "", {}, tdl::IntValue{}});
+    b.cliMapping.push_back({"--new", "new"});
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tdl::diff(a, b));
+    }
+}
+
+void apply_one_added(benchmark::State & state) {
+    auto a     = generateToolInfo(state.range(0));
+    auto b     = a;
+    std::get<tdl::Node::Children>(b.params[0].value).push_back(tdl::Node{"new", "", {}, tdl::IntValue{}});
+    auto patch = tdl::diff(a, b);
+    auto undo  = tdl::diff(b, a);
+
+    for (auto _ : state) {
+        tdl::apply(a, patch);
+        tdl::apply(a, undo);
+        benchmark::ClobberMemory();
+    }
+}
+
+} // namespace
+
+BENCHMARK(diff_one_added)->Arg(1000)->Arg(10000)->Arg(100000);
+BENCHMARK(apply_one_added)->Arg(1000)->Arg(10000)->Arg(100000);
@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <benchmark/benchmark.h>
+
+#include <tdl/tdl.h>
+
+namespace {
+
+//!\brief a tool with `paramCount` parameters with limits and valid values
+auto generateToolInfo(std::size_t paramCount) {
+    auto doc = tdl::ToolInfo{};
+    for (std::size_t i = 0; i < paramCount; ++i) {
+        auto node        = tdl::Node{};
+        node.name        = "param" + std::to_string(i);
+        node.description = "description of parameter " + std::to_string(i);
+        node.tags        = {"advanced"};
+        if (i % 2 == 0) {
+            node.value = tdl::IntValue{0, 0, 1000};
+        } else {
+            node.value = tdl::StringValue{"a", {{"a", "b", "c"}}};
+        }
+        doc.cliMapping.push_back({"--" + node.name, node.name});
+        doc.params.push_back(std::move(node));
+    }
+    return doc;
+}
+
+void fingerprint(benchmark::State & state) {
+    auto doc = generateToolInfo(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tdl::fingerprint(doc));
+    }
+}
+
+//!\brief the work a matching fingerprint saves
+void convert_to_ctd(benchmark::State & state) {
+    auto doc = generateToolInfo(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tdl::convertToCTD(doc));
+    }
+}
+
+} // namespace
+
+BENCHMARK(fingerprint)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(convert_to_ctd)->Arg(100)->Arg(1000)->Arg(10000);
@@ -0,0 +1,97 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <benchmark/benchmark.h>
+
+#include <tdl/tdl.h>
+
+namespace {
+
+//!\brief a tree with `groupCount` groups of 100 parameters each
+auto generateToolInfo(std::size_t groupCount) {
+    auto doc = tdl::ToolInfo{};
+    for (std::size_t g = 0; g < groupCount; ++g) {
+        auto children = tdl::Node::Children{};
+        for (std::size_t i = 0; i < 100; ++i) {
+            auto node        = tdl::Node{};
+            node.name        = "param" + std::to_string(i);
+            node.description = "description of parameter " + std::to_string(i);
+            if (i % 3 == 0) {
+                node.tags.insert(tdl::Tag::required);
+                node.value = tdl::IntValue{static_cast<int>(i)};
+            } else {
+                node.value = tdl::StringValue{"value"};
+            }
+            children.push_back(std::move(node));
+        }
+        auto group  = tdl::Node{};
+        group.name  = "group" + std::to_string(g);
+        group.value = std::move(children);
+        doc.params.push_back(std::move(group));
+    }
+    return doc;
+}
+
+auto countRequired(tdl::Node::Children const & children) -> std::size_t {
+    auto count = std::size_t{};
+    for (auto const & child : children) {
+        count += child.tags.contains(tdl::Tag::required);
+        if (auto grandChildren = std::get_if<tdl::Node::Children>(&child.value)) {
+            count += countRequired(*grandChildren);
+        }
+    }
+    return count;
+}
+
+void tree_traverse(benchmark::State & state) {
+    auto doc = generateToolInfo(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(countRequired(doc.params));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 100);
+}
+
+void flat_traverse(benchmark::State & state) {
+    auto flat = tdl::flatten(generateToolInfo(state.range(0)));
+    for (auto _ : state) {
+        auto count = std::size_t{};
+        for (auto const & tags : flat.tags) {
+            count += tags.contains(tdl::Tag::required);
+        }
+        benchmark::DoNotOptimize(count);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 100);
+}
+
+void flat_flatten(benchmark::State & state) {
+    auto doc = generateToolInfo(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tdl::flatten(doc));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 100);
+}
+
+void tree_convertToCTD(benchmark::State & state) {
+    auto doc = generateToolInfo(state.range(0));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tdl::convertToCTD(doc));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 100);
+}
+
+void flat_convertToCTD(benchmark::State & state) {
+    auto flat = tdl::flatten(generateToolInfo(state.range(0)));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tdl::convertToCTD(flat));
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0) * 100);
+}
+
+} // namespace
+
+BENCHMARK(tree_traverse)->Arg(10)->Arg(1000);
+BENCHMARK(flat_traverse)->Arg(10)->Arg(1000);
+BENCHMARK(flat_flatten)->Arg(10)->Arg(1000);
+BENCHMARK(tree_convertToCTD)->Arg(10)->Arg(100);
+BENCHMARK(flat_convertToCTD)->Arg(10)->Arg(100);
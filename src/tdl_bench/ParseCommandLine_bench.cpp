@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <benchmark/benchmark.h>
+
+#include <tdl/tdl.h>
+
+namespace {
+
+//!\brief a tool with `optionCount` int options, `--option0` ... `--optionN`
+auto generateToolInfo(std::size_t optionCount) {
+    auto doc = tdl::ToolInfo{};
+    for (std::size_t i = 0; i < optionCount; ++i) {
+        auto node  = tdl::Node{};
+        node.name  = "option" + std::to_string(i);
+        node.value = tdl::IntValue{0, 0, 1000};
+        doc.cliMapping.push_back({"--" + node.name, node.name});
+        doc.params.push_back(std::move(node));
+    }
+    return doc;
+}
+
+//!\brief 10 options spread over all available options
+auto generateArguments(std::size_t optionCount) {
+    auto args = std::vector<std::string>{};
+    for (std::size_t i = 0; i < 10; ++i) {
+        args.push_back("--option" + std::to_string(i * optionCount / 10));
+        args.push_back(std::to_string(i));
+    }
+    return args;
+}
+
+auto toArgv(std::vector<std::string> const & args) {
+    auto argv = std::vector<char const *>{"tool"};
+    for (auto const & arg : args) {
+        argv.push_back(arg.c_str());
+    }
+    return argv;
+}
+
+//!\brief parsing with a prebuilt parser, independent of the number of available options
+void command_line_parser(benchmark::State & state) {
+    auto doc    = generateToolInfo(state.range(0));
+    auto args   = generateArguments(state.range(0));
+    auto argv   = toArgv(args);
+    auto parser = tdl::CommandLineParser{doc};
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(parser.parse(static_cast<int>(argv.size()), argv.data()));
+    }
+}
+
+//!\brief building the tables and parsing
+void parse_command_line(benchmark::State & state) {
+    auto doc  = generateToolInfo(state.range(0));
+    auto args = generateArguments(state.range(0));
+    auto argv = toArgv(args);
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(tdl::parseCommandLine(doc, static_cast<int>(argv.size()), argv.data()));
+    }
+}
+
+} // namespace
+
+BENCHMARK(command_line_parser)->Arg(10)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(parse_command_line)->Arg(10)->Arg(100)->Arg(1000)->Arg(10000);
@@ -0,0 +1,79 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <benchmark/benchmark.h>
+
+#include <tdl/tdl.h>
+
+namespace {
+
+constexpr std::size_t elementCount = 1'000'000;
+
+//!\brief a tool with one list of a million valid elements
+auto generateToolInfo(tdl::Node::Value value) {
+    auto doc   = tdl::ToolInfo{};
+    auto node  = tdl::Node{};
+    node.name  = "list";
+    node.value = std::move(value);
+    doc.params.push_back(std::move(node));
+    return doc;
+}
+
+auto intList() {
+    auto value     = tdl::IntValueList{};
+    value.minLimit = 0;
+    value.maxLimit = 1000;
+    for (std::size_t i = 0; i < elementCount; ++i) {
+        value.value.push_back(static_cast<int>(i % 1000));
+    }
+    return value;
+}
+
+auto doubleList() {
+    auto value     = tdl::DoubleValueList{};
+    value.minLimit = 0.0;
+    value.maxLimit = 1.0;
+    for (std::size_t i = 0; i < elementCount; ++i) {
+        value.value.push_back(static_cast<double>(i % 1000) / 1000.0);
+    }
+    return value;
+}
+
+auto stringList() {
+    auto value        = tdl::StringValueList{};
+    value.validValues = std::vector<std::string>{};
+    for (std::size_t i = 0; i < 100; ++i) {
+        value.validValues->push_back("format" + std::to_string(i));
+    }
+    for (std::size_t i = 0; i < elementCount; ++i) {
+        value.value.push_back((*value.validValues)[i % 100]);
+    }
+    return value;
+}
+
+template <typename Value>
+void state(benchmark::State & state, Value value) {
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(value.state());
+    }
+    state.SetItemsProcessed(state.iterations() * elementCount);
+}
+
+void validator(benchmark::State & state, tdl::Node::Value value) {
+    auto doc       = generateToolInfo(std::move(value));
+    auto validator = tdl::Validator{doc};
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(validator.validate());
+    }
+    state.SetItemsProcessed(state.iterations() * elementCount);
+}
+
+} // namespace
+
+BENCHMARK_CAPTURE(state, ints, intList());
+BENCHMARK_CAPTURE(validator, ints, intList());
+BENCHMARK_CAPTURE(state, doubles, doubleList());
+BENCHMARK_CAPTURE(validator, doubles, doubleList());
+BENCHMARK_CAPTURE(state, strings, stringList());
+BENCHMARK_CAPTURE(validator, strings, stringList());
@@ -0,0 +1,338 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: BSD-3-Clause
+
+/* tdl-convert: converts CTD and CWL descriptors into CWL, CTD or binary snapshots
+ *
+ * Each input is a descriptor or a directory, which is searched recursively for *.ctd and *.cwl files.
+ * The files are converted by a pool of worker threads. A worker maps one input at a time and keeps
+ * only its output in memory, so the memory usage is bounded by the number of threads and not by the
+ * number of files. Outputs are replaced atomically, and only if their content changed.
+ *
+ * A manifest stores a hash of every converted input (together with the target format and the TDL
+ * version). Inputs whose hash did not change since the last run are skipped, as long as their output
+ * still exists.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <exception>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <set>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <tdl/cwl_v1_2.h>
+#include <tdl/parallelFor.h>
+#include <tdl/tdl.h>
+
+namespace {
+
+enum class Target {
+    CTD,
+    CWL,
+    Snapshot
+};
+
+//!\brief an input and the file it is converted into
+struct Job {
+    std::filesystem::path input;
+    std::filesystem::path output;
+};
+
+enum class Status {
+    Converted,
+    Unchanged,
+    Failed
+};
+
+struct Result {
+    Status                                    status{Status::Failed};
+    std::chrono::duration<double, std::milli> time{};
+    std::string                               hash{};
+    std::string                               error{};
+};
+
+//!\brief output path (absolute) -> hash of the input it was converted from
+using Manifest = std::map<std::string, std::string>;
+
+//!\brief tdl-convert describes its own command line
+auto toolInfo() -> tdl::ToolInfo {
+    auto node = [](std::string name, std::string description, tdl::Node::Value value) {
+        return tdl::Node{std::move(name), std::move(description), {}, std::move(value)};
+    };
+    auto doc                    = tdl::ToolInfo{};
+    doc.metaInfo.name           = "tdl-convert";
+    doc.metaInfo.version        = std::string{tdl::version()};
+    doc.metaInfo.executableName = "tdl-convert";
+    doc.metaInfo.description    = "Converts CTD and CWL descriptors into CWL, CTD or binary snapshots.";
+    doc.params                  = {
+        node("to", "Format of the outputs.", tdl::StringValue{"cwl", {{"ctd", "cwl", "snapshot"}}}),
+        node("output",
+             "Directory of the outputs, the layout below each given directory is kept. "
+             "By default the outputs are written next to their inputs.",
+             tdl::StringValue{}),
+        node("manifest",
+             "File storing the hashes of converted inputs. Defaults to .tdl-convert in the output directory, "
+             "or in the current directory.",
+             tdl::StringValue{}),
+        node("threads", "Number of worker threads, 0 uses all cores.", tdl::IntValue{0, 0, std::nullopt}),
+        node("force", "Convert all inputs, even if they did not change.", tdl::BoolValue{false}),
+        node("stats", "Print the time spent on each file.", tdl::BoolValue{false}),
+        node("help", "Print this help.", tdl::BoolValue{false}),
+    };
+    for (auto const & param : doc.params) {
+        auto option = (param.name == "output" ? "-o" : param.name == "threads" ? "-j" : "--" + param.name);
+        doc.cliMapping.push_back({option, param.name});
+    }
+    return doc;
+}
+
+void printHelp(tdl::ToolInfo const & doc) {
+    std::cout << doc.metaInfo.description << "\n\nusage: " << doc.metaInfo.executableName
+              << " [options] <file or directory>...\n\noptions:\n";
+    auto index = tdl::ParamIndex{doc};
+    for (auto const & mapping : doc.cliMapping) {
+        std::cout << "  " << std::left << std::setw(12) << mapping.optionIdentifier
+                  << index.find(mapping.referenceName)->description << '\n';
+    }
+}
+
+auto extension(Target target) -> std::string {
+    switch (target) {
+    case Target::CTD: return ".ctd";
+    case Target::CWL: return ".cwl";
+    case Target::Snapshot: break;
+    }
+    return ".tdl";
+}
+
+auto isDescriptor(std::filesystem::path const & path) -> bool {
+    auto ext = path.extension();
+    return ext == ".ctd" || ext == ".cwl";
+}
+
+/*!\brief the jobs for all inputs, in the order of the inputs, files of a directory sorted by path
+ *
+ * CTD and CWL outputs replace the extension of their input. Snapshots keep it (stellar.ctd becomes
+ * stellar.ctd.tdl), so a CTD and a CWL file of the same tool do not collide.
+ * Inside of directories, files that already have the target format are ignored, they are most likely
+ * outputs of an earlier run. Throws if a given file is not a descriptor or two inputs have the same output.
+ */
+auto collectJobs(std::vector<std::string> const & inputs, std::filesystem::path const & outputDir, Target target)
+    -> std::vector<Job> {
+    auto jobs = std::vector<Job>{};
+    auto add  = [&](std::filesystem::path input, std::filesystem::path output) {
+        if (target == Target::Snapshot) {
+            output += extension(target);
+        } else {
+            output.replace_extension(extension(target));
+        }
+        if (output == input) {
+            throw std::runtime_error{input.string() + " already has the target format"};
+        }
+        jobs.push_back({std::move(input), std::move(output)});
+    };
+
+    for (auto const & arg : inputs) {
+        auto input = std::filesystem::path{arg};
+        if (!std::filesystem::is_directory(input)) {
+            if (!isDescriptor(input)) {
+                throw std::runtime_error{"unknown format of " + input.string() + ", expected *.ctd or *.cwl"};
+            }
+            add(input, outputDir.empty() ? input : outputDir / input.filename());
+            continue;
+        }
+        auto files = std::vector<std::filesystem::path>{};
+        for (auto const & entry : std::filesystem::recursive_directory_iterator{input}) {
+            if (entry.is_regular_file() && isDescriptor(entry.path()) && entry.path().extension() != extension(target)) {
+                files.push_back(entry.path());
+            }
+        }
+        std::sort(files.begin(), files.end());
+        for (auto const & file : files) {
+            add(file, outputDir.empty() ? file : outputDir / file.lexically_relative(input));
+        }
+    }
+
+    auto outputs = std::set<std::filesystem::path>{};
+    for (auto const & job : jobs) {
+        if (!outputs.insert(std::filesystem::absolute(job.output).lexically_normal()).second) {
+            throw std::runtime_error{"more than one input is converted into " + job.output.string()};
+        }
+    }
+    return jobs;
+}
+
+auto manifestKey(std::filesystem::path const & output) -> std::string {
+    return std::filesystem::absolute(output).lexically_normal().generic_string();
+}
+
+//!\brief lines of the form "<hash> <output path>", a missing manifest is empty
+auto readManifest(std::filesystem::path const & path) -> Manifest {
+    auto manifest = Manifest{};
+    if (!std::filesystem::exists(path)) {
+        return manifest;
+    }
+    auto file  = tdl::MappedFile{path};
+    auto lines = std::istringstream{std::string{file.data()}};
+    for (auto line = std::string{}; std::getline(lines, line);) {
+        if (auto space = line.find(' '); space != std::string::npos) {
+            manifest[line.substr(space + 1)] = line.substr(0, space);
+        }
+    }
+    return manifest;
+}
+
+void writeManifest(std::filesystem::path const & path, Manifest const & manifest) {
+    auto content = std::string{};
+    for (auto const & [output, hash] : manifest) {
+        content += hash + ' ' + output + '\n';
+    }
+    tdl::writeFileAtomically(path, content);
+}
+
+//!\brief a hash of the input together with everything else the output depends on
+auto inputHash(std::string_view input, Target target) -> std::string {
+    auto hash = tdl::detail::Fnv1a128{};
+    hash.update(tdl::version());
+    hash.update(static_cast<unsigned char>(0));
+    hash.update(extension(target));
+    hash.update(static_cast<unsigned char>(0));
+    hash.update(input);
+    return hash.value().toString();
+}
+
+auto import(Job const & job, std::string_view content) -> tdl::ToolInfo {
+    if (job.input.extension() == ".ctd") {
+        return tdl::importCTDFromString(content);
+    }
+    auto document = w3id_org::cwl::load_document_from_string(std::string{content});
+    auto tool     = std::get_if<w3id_org::cwl::cwl::CommandLineTool>(&document);
+    if (!tool) {
+        throw std::runtime_error{"not a CommandLineTool"};
+    }
+    return tdl::importCWL(*tool);
+}
+
+auto convert(tdl::ToolInfo const & doc, Target target) -> std::string {
+    switch (target) {
+    case Target::CTD: return tdl::convertToCTD(doc);
+    case Target::CWL: return tdl::convertToCWL(doc);
+    case Target::Snapshot: break;
+    }
+    return tdl::writeSnapshot(doc);
+}
+
+auto run(Job const & job, Target target, Manifest const & manifest, bool force) -> Result {
+    auto result = Result{};
+    auto start  = std::chrono::steady_clock::now();
+    try {
+        auto file   = tdl::MappedFile{job.input};
+        result.hash = inputHash(file.data(), target);
+
+        auto entry = manifest.find(manifestKey(job.output));
+        if (!force && entry != manifest.end() && entry->second == result.hash && std::filesystem::exists(job.output)) {
+            result.status = Status::Unchanged;
+        } else {
+            auto content = convert(import(job, file.data()), target);
+            if (job.output.has_parent_path()) {
+                std::filesystem::create_directories(job.output.parent_path());
+            }
+            tdl::writeFileIfChanged(job.output, content);
+            result.status = Status::Converted;
+        }
+    } catch (std::exception const & e) {
+        result.error = e.what();
+    }
+    result.time = std::chrono::steady_clock::now() - start;
+    return result;
+}
+
+//!\brief runs all jobs on `threads` workers, `run` reports errors in its result instead of throwing
+auto runAll(std::vector<Job> const & jobs, Target target, Manifest const & manifest, bool force, std::size_t threads)
+    -> std::vector<Result> {
+    auto results = std::vector<Result>(jobs.size());
+    tdl::detail::parallelFor(jobs.size(), threads, [&](std::size_t i, std::size_t) {
+        results[i] = run(jobs[i], target, manifest, force);
+    });
+    return results;
+}
+
+auto statusName(Status status) -> char const * {
+    switch (status) {
+    case Status::Converted: return "converted";
+    case Status::Unchanged: return "unchanged";
+    case Status::Failed: break;
+    }
+    return "failed";
+}
+
+} // namespace
+
+int main(int argc, char ** argv) {
+    try {
+        auto doc    = toolInfo();
+        auto parsed = tdl::parseCommandLine(doc, argc, argv);
+        auto index  = tdl::ParamIndex{doc};
+        auto string = [&](std::string_view name) { return std::get<tdl::StringValue>(index.find(name)->value).value; };
+        auto flag   = [&](std::string_view name) { return std::get<tdl::BoolValue>(index.find(name)->value); };
+
+        if (flag("help") || parsed.positional.empty()) {
+            printHelp(doc);
+            return flag("help") ? 0 : 1;
+        }
+
+        auto to     = string("to");
+        auto target = to == "ctd" ? Target::CTD : to == "cwl" ? Target::CWL : Target::Snapshot;
+        auto output = std::filesystem::path{string("output")};
+        auto jobs   = collectJobs(parsed.positional, output, target);
+
+        auto manifestPath = std::filesystem::path{string("manifest")};
+        if (manifestPath.empty()) {
+            manifestPath = output / ".tdl-convert";
+        }
+        auto manifest = readManifest(manifestPath);
+
+        auto start   = std::chrono::steady_clock::now();
+        auto threads = static_cast<std::size_t>(std::get<tdl::IntValue>(index.find("threads")->value).value);
+        auto results = runAll(jobs, target, manifest, flag("force"), threads);
+        auto elapsed = std::chrono::duration<double, std::milli>{std::chrono::steady_clock::now() - start};
+
+        auto counts = std::map<Status, std::size_t>{};
+        for (std::size_t i = 0; i < jobs.size(); ++i) {
+            auto const & result = results[i];
+            ++counts[result.status];
+            if (result.status == Status::Failed) {
+                std::cerr << "tdl-convert: " << jobs[i].input.string() << ": " << result.error << '\n';
+                manifest.erase(manifestKey(jobs[i].output));
+            } else {
+                manifest[manifestKey(jobs[i].output)] = result.hash;
+            }
+            if (flag("stats")) {
+                std::cout << std::right << std::fixed << std::setprecision(2) << std::setw(10) << result.time.count()
+                          << " ms  " << std::left << std::setw(10) << statusName(result.status) << jobs[i].input.string()
+                          << " -> " << jobs[i].output.string() << '\n';
+            }
+        }
+        if (flag("stats")) {
+            std::cout << counts[Status::Converted] << " converted, " << counts[Status::Unchanged] << " unchanged, "
+                      << counts[Status::Failed] << " failed in " << std::fixed << std::setprecision(2)
+                      << elapsed.count() << " ms\n";
+        }
+
+        if (!manifestPath.parent_path().empty()) {
+            std::filesystem::create_directories(manifestPath.parent_path());
+        }
+        writeManifest(manifestPath, manifest);
+        return counts[Status::Failed] == 0 ? 0 : 1;
+    } catch (std::exception const & e) {
+        std::cerr << "tdl-convert: " << e.what() << '\n';
+        return 1;
+    }
+}
@@ -0,0 +1,188 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#pragma once
+
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include <tdl/ToolInfo.h>
+
+namespace synthetic {
+
+//!\brief which tags the generated nodes carry
+enum class TagMix {
+    None,    //!< no tags at all
+    Typical, //!< some required and advanced parameters, file inputs and outputs
+    All      //!< every tag, including basecommand groups and prefixed outputs
+};
+
+//!\brief shape of a synthetic ToolInfo
+struct Config {
+    std::size_t   width{10};             //!< Children of each group
+    std::size_t   depth{2};              //!< Levels of groups above the leafs, at most 4 (CWL export limit)
+    std::size_t   listSize{4};           //!< Values of list parameters
+    std::size_t   descriptionLength{40}; //!< Characters of each description
+    std::size_t   validValues{3};        //!< Valid values of every third string parameter
+    TagMix        tagMix{TagMix::Typical};
+    std::uint64_t seed{1};
+};
+
+//!\brief splitmix64, unlike the std distributions its output is the same on every platform
+class Random {
+public:
+    explicit Random(std::uint64_t seed) : state_{seed} {}
+
+    auto next() -> std::uint64_t {
+        auto z = (state_ += 0x9e3779b97f4a7c15ull);
+        z      = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+        z      = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+        return z ^ (z >> 31);
+    }
+    //!\brief a number in [0, n)
+    auto below(std::size_t n) -> std::size_t {
+        return static_cast<std::size_t>(next() % n);
+    }
+    //!\brief true with a probability of `percent`/100
+    auto chance(std::size_t percent) -> bool {
+        return below(100) < percent;
+    }
+
+private:
+    std::uint64_t state_;
+};
+
+namespace detail {
+
+inline auto text(Random & random, std::size_t length) -> std::string {
+    static constexpr char const * words[] = {"the ", "number ", "of ", "threads ", "input ", "file ", "used ", "for ",
+                                             "output ", "minimal ", "score ", "a ", "value ", "per ", "read ", "<tag> "};
+    auto result = std::string{};
+    result.reserve(length + 8);
+    while (result.size() < length) {
+        result += words[random.below(std::size(words))];
+    }
+    result.resize(length);
+    return result;
+}
+
+inline auto leafValue(Random & random, Config const & config, tdl::Tags & tags) -> tdl::Node::Value {
+    auto list = [&](auto make) {
+        auto values = std::vector<decltype(make(std::size_t{}))>{};
+        for (std::size_t i = 0; i < config.listSize; ++i) {
+            values.push_back(make(i));
+        }
+        return values;
+    };
+    auto validValues = [&]() {
+        auto values = std::vector<std::string>{};
+        for (std::size_t i = 0; i < config.validValues; ++i) {
+            values.push_back("choice" + std::to_string(i));
+        }
+        return values;
+    };
+
+    switch (random.below(7)) {
+    case 0:
+        return tdl::BoolValue{random.chance(50)};
+    case 1:
+        return tdl::IntValue{static_cast<int>(random.below(100)), 0, 1000};
+    case 2:
+        return tdl::DoubleValue{static_cast<double>(random.below(1000)) / 7.0, 0.0};
+    case 3:
+        if (random.chance(33) && config.validValues > 0) {
+            return tdl::StringValue{"choice0", validValues()};
+        }
+        if (config.tagMix != TagMix::None && random.chance(40)) {
+            tags.insert(random.chance(70) ? "file" : "directory");
+            if (random.chance(40)) {
+                tags.insert("output");
+            }
+        }
+        return tdl::StringValue{"value"};
+    case 4:
+        return tdl::IntValueList{list([](std::size_t i) { return static_cast<int>(i); })};
+    case 5:
+        return tdl::DoubleValueList{list([](std::size_t i) { return static_cast<double>(i) / 3.0; })};
+    default:
+        if (config.tagMix != TagMix::None && random.chance(30)) {
+            tags.insert("file");
+        }
+        return tdl::StringValueList{list([](std::size_t i) { return "item" + std::to_string(i); })};
+    }
+}
+
+inline auto randomTags(Random & random, Config const & config) -> tdl::Tags {
+    auto tags = tdl::Tags{};
+    if (config.tagMix == TagMix::None) {
+        return tags;
+    }
+    if (random.chance(30)) {
+        tags.insert("required");
+    }
+    if (random.chance(20)) {
+        tags.insert("advanced");
+    }
+    if (config.tagMix == TagMix::All) {
+        for (auto tag : {"no_default", "default_as_hint", "prefixed", "gxy:custom"}) {
+            if (random.chance(15)) {
+                tags.insert(tag);
+            }
+        }
+    }
+    return tags;
+}
+
+inline void addChildren(tdl::ToolInfo &       doc,
+                        tdl::Node::Children & children,
+                        Random &              random,
+                        Config const &        config,
+                        std::size_t           depth,
+                        std::string const &   prefix) {
+    for (std::size_t i = 0; i < config.width; ++i) {
+        auto node        = tdl::Node{};
+        node.name        = prefix + std::to_string(i);
+        node.description = text(random, config.descriptionLength);
+        node.tags        = randomTags(random, config);
+        if (depth > 0) {
+            if (config.tagMix == TagMix::All && random.chance(20)) {
+                node.tags = {"basecommand"};
+            }
+            auto grandChildren = tdl::Node::Children{};
+            addChildren(doc, grandChildren, random, config, depth - 1, node.name + "_");
+            node.value = std::move(grandChildren);
+        } else {
+            node.value = leafValue(random, config, node.tags);
+            doc.cliMapping.push_back({"--" + node.name, node.name});
+        }
+        children.push_back(std::move(node));
+    }
+}
+
+} // namespace detail
+
+/*!\brief generates a ToolInfo of the given shape
+ *
+ * The result only depends on the config, the same config gives the same tree on every platform.
+ * Names are unique, every leaf gets a cli mapping. The leafs cover all value types.
+ */
+inline auto generate(Config const & config) -> tdl::ToolInfo {
+    auto random = Random{config.seed};
+    auto doc    = tdl::ToolInfo{};
+
+    doc.metaInfo.version        = "1.0.0";
+    doc.metaInfo.name           = "synthetic";
+    doc.metaInfo.docurl         = "https://example.com/synthetic";
+    doc.metaInfo.category       = "benchmark";
+    doc.metaInfo.description    = detail::text(random, config.descriptionLength);
+    doc.metaInfo.executableName = "synthetic";
+    doc.metaInfo.citations      = {{"10.0000/synthetic", "https://example.com/paper"}};
+
+    detail::addChildren(doc, doc.params, random, config, config.depth, "p");
+    return doc;
+}
+
+} // namespace synthetic
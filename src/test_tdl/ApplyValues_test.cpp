@@ -0,0 +1,191 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+
+#include <tdl/XMLScanner.h>
+
+#include "utils.h"
+
+namespace apply_values_tests {
+
+auto createToolInfo() {
+    auto node = [](std::string name, tdl::Tags tags, tdl::Node::Value value) {
+        return tdl::Node{DESINIT(.name =) std::move(name),
+                         DESINIT(.description =){},
+                         DESINIT(.tags =) std::move(tags),
+                         DESINIT(.value =) std::move(value)};
+    };
+    return tdl::ToolInfo{
+        DESINIT(.metaInfo =){DESINIT(.version =){}, DESINIT(.name =){"tool"}},
+        DESINIT(.params =){
+            node("verbose", {}, tdl::BoolValue{false}),
+            node("threads", {}, tdl::IntValue{1, 1, 64}),
+            node("input", {"file"}, tdl::StringValue{}),
+            node("options",
+                 {},
+                 tdl::Node::Children{
+                     node("ratio", {}, tdl::DoubleValue{0.5, 0.0, 1.0}),
+                     node("mode", {}, tdl::StringValue{"fast", {{"fast", "slow"}}}),
+                     node("errors", {}, tdl::IntValueList{{0, 1}, 0, 5}),
+                     node("names", {}, tdl::StringValueList{{"a"}}),
+                 }),
+            node("spectra", {"input file"}, tdl::StringValue{"", {{"*.mzML"}}}),
+        },
+    };
+}
+
+auto options(tdl::ToolInfo & doc) -> tdl::Node::Children & {
+    return std::get<tdl::Node::Children>(doc.params[3].value);
+}
+
+auto fails(std::string_view content) -> bool {
+    auto doc = createToolInfo();
+    try {
+        tdl::applyValuesFromString(doc, content);
+    } catch (std::runtime_error const &) {
+        return true;
+    }
+    return false;
+}
+
+void testUnescape() {
+    assert(tdl::detail::unescapeXML("plain") == "plain");
+    assert(tdl::detail::unescapeXML("a &lt;b&gt; &amp; &quot;c&apos;") == "a <b> & \"c'");
+    assert(tdl::detail::unescapeXML("x&#x9;y&#65;#br#z") == "x\tyA\nz");
+    assert(tdl::detail::unescapeXML("&#xe4;") == "\xc3\xa4");
+}
+
+void testCTDRoundTrip() {
+    auto expected = createToolInfo();
+    std::get<tdl::BoolValue>(expected.params[0].value)          = true;
+    std::get<tdl::IntValue>(expected.params[1].value).value     = 8;
+    std::get<tdl::StringValue>(expected.params[2].value).value  = "in \"1\" <&>.fa";
+    std::get<tdl::DoubleValue>(options(expected)[0].value).value = 0.25;
+    std::get<tdl::StringValue>(options(expected)[1].value).value = "slow";
+    std::get<tdl::IntValueList>(options(expected)[2].value).value = {3, 4, 5};
+    std::get<tdl::StringValueList>(options(expected)[3].value).value.clear();
+
+    auto doc = createToolInfo();
+    tdl::applyValuesFromString(doc, tdl::convertToCTD(expected));
+    assert(tdl::convertToCTD(doc) == tdl::convertToCTD(expected));
+}
+
+//!\brief the valid values of files are their supported formats, the empty default is kept
+void testFiles() {
+    auto doc = createToolInfo();
+    tdl::applyValuesFromString(doc, tdl::convertToCTD(createToolInfo()));
+    assert(tdl::convertToCTD(doc) == tdl::convertToCTD(createToolInfo()));
+
+    auto expected = createToolInfo();
+    std::get<tdl::StringValue>(expected.params[4].value).value = "data/run1.mzML";
+    tdl::applyValuesFromString(doc, tdl::convertToCTD(expected));
+    assert(tdl::convertToCTD(doc) == tdl::convertToCTD(expected));
+
+    assert(!fails("spectra: run2.MZML"));
+    assert(fails("spectra: run2.txt"));
+    assert(fails("<PARAMETERS><ITEM name=\"spectra\" value=\"run2.txt\"/></PARAMETERS>"));
+}
+
+void testINI() {
+    // OpenMS style: a top level node with the tool name and the instance number
+    auto doc = createToolInfo();
+    tdl::applyValuesFromString(doc, R"(<?xml version="1.0" encoding="ISO-8859-1"?>
+<PARAMETERS version="1.7.0">
+  <!-- <ITEM name="threads" value="2" /> -->
+  <NODE name="tool" description="">
+    <NODE name="1" description="">
+      <ITEM name='threads' value='4' type="int"/>
+      <NODE name="options">
+        <ITEMLIST name="names" type="string">
+          <LISTITEM value="x"/>
+          <LISTITEM value="y&amp;z"/>
+        </ITEMLIST>
+      </NODE>
+    </NODE>
+  </NODE>
+</PARAMETERS>
+)");
+    assert(std::get<tdl::IntValue>(doc.params[1].value).value == 4);
+    assert((std::get<tdl::StringValueList>(options(doc)[3].value).value == std::vector<std::string>{"x", "y&z"}));
+}
+
+void testCWLJob() {
+    auto doc = createToolInfo();
+    tdl::applyValuesFromString(doc, R"(
+verbose: true
+threads: null
+input:
+  class: File
+  path: /data/in.fa
+options:
+  ratio: 0.75
+  errors: [2, 3]
+  names: []
+)");
+    assert(std::get<tdl::BoolValue>(doc.params[0].value) == true);
+    assert(std::get<tdl::IntValue>(doc.params[1].value).value == 1);
+    assert(std::get<tdl::StringValue>(doc.params[2].value).value == "/data/in.fa");
+    assert(std::get<tdl::DoubleValue>(options(doc)[0].value).value == 0.75);
+    assert((std::get<tdl::IntValueList>(options(doc)[2].value).value == std::vector<int>{2, 3}));
+    assert(std::get<tdl::StringValueList>(options(doc)[3].value).value.empty());
+}
+
+void testFile() {
+    auto path = std::filesystem::temp_directory_path() / "tdl_apply_values_test.json";
+    {
+        auto ofs = std::ofstream{path};
+        ofs << R"({"input": {"class": "File", "location": "file:///data/reads.fq"}, "mode": "slow"})";
+    }
+    auto doc = createToolInfo();
+    tdl::applyValues(doc, path);
+    std::filesystem::remove(path);
+
+    assert(std::get<tdl::StringValue>(doc.params[2].value).value == "/data/reads.fq");
+    assert(std::get<tdl::StringValue>(options(doc)[1].value).value == "slow");
+}
+
+void testErrors() {
+    assert(!fails("threads: 64"));
+    assert(fails("threads: 65"));                // above limit
+    assert(fails("threads: many"));              // not a number
+    assert(fails("unknown: 1"));                 // unknown parameter
+    assert(fails("errors: 1"));                  // a list expects a sequence
+    assert(fails("mode: medium"));               // not a valid value
+    assert(fails("options: 1"));                 // a group expects a map
+    assert(fails("- threads"));                  // a job is a map
+    assert(!fails("<PARAMETERS><ITEM name=\"threads\" value=\"3\"/></PARAMETERS>"));
+    assert(fails("<PARAMETERS><ITEM name=\"threads\" value=\"0\"/></PARAMETERS>"));
+    assert(fails("<PARAMETERS><ITEM name=\"errors\" value=\"0\"/></PARAMETERS>"));
+    assert(fails("<PARAMETERS><ITEMLIST name=\"threads\"/></PARAMETERS>"));
+    assert(fails("<PARAMETERS><ITEMLIST name=\"errors\"><LISTITEM value=\"6\"/></ITEMLIST></PARAMETERS>"));
+    assert(fails("<PARAMETERS><ITEM name=\"threads\" value=\"3\"</PARAMETERS>")); // malformed
+    assert(fails("<PARAMETERS><ITEM name=\"threads\" value=\"3/></PARAMETERS>"));
+    assert(fails("<tool><PARAMETERS></NODE></PARAMETERS></tool>"));               // unmatched end tag
+
+    // two sibling groups with the same name, neither of them is picked
+    auto doc = createToolInfo();
+    doc.params.push_back(doc.params[3]);
+    [[maybe_unused]] auto ambiguous = false;
+    try {
+        tdl::applyValuesFromString(doc, "options:\n  ratio: 0.1");
+    } catch (std::runtime_error const & e) {
+        ambiguous = std::string_view{e.what()}.find("ambiguous") != std::string_view::npos;
+    }
+    assert(ambiguous);
+}
+
+} // namespace apply_values_tests
+
+void testApplyValues() {
+    apply_values_tests::testUnescape();
+    apply_values_tests::testCTDRoundTrip();
+    apply_values_tests::testFiles();
+    apply_values_tests::testINI();
+    apply_values_tests::testCWLJob();
+    apply_values_tests::testFile();
+    apply_values_tests::testErrors();
+}
@@ -0,0 +1,122 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <chrono>
+#include <filesystem>
+
+#include <yaml-cpp/yaml.h>
+
+#include "utils.h"
+
+namespace cached_exporter_tests {
+
+auto createToolInfo(std::string name) {
+    auto doc          = test_fixtures::smallToolInfo();
+    doc.metaInfo.name = std::move(name);
+    return doc;
+}
+auto cacheDir() {
+    auto dir = std::filesystem::temp_directory_path() / "tdl_cached_exporter_test";
+    std::filesystem::remove_all(dir);
+    return dir;
+}
+
+void testHitsAndMisses() {
+    auto dir   = cacheDir();
+    auto cache = tdl::CachedExporter{dir};
+    auto doc   = createToolInfo("tool");
+
+    auto first = cache.get(doc, tdl::DescriptorFormat::CWL);
+    assert(!first.hit());
+    assert(first.data() == tdl::convertToCWL(doc));
+    assert(std::filesystem::exists(cache.path(doc, tdl::DescriptorFormat::CWL)));
+
+    auto second = cache.get(doc, tdl::DescriptorFormat::CWL);
+    assert(second.hit());
+    assert(second.data() == first.data());
+
+    // other formats and changed tools have their own entries
+    assert(!cache.get(doc, tdl::DescriptorFormat::CTD).hit());
+    assert(cache.get(doc, tdl::DescriptorFormat::CTD).data() == tdl::convertToCTD(doc));
+    doc.metaInfo.version = "1.0.1";
+    assert(!cache.get(doc, tdl::DescriptorFormat::CWL).hit());
+
+    assert(cache.hits() == 2);
+    assert(cache.misses() == 3);
+
+    // an entry removed by someone else is generated again
+    std::filesystem::remove(cache.path(doc, tdl::DescriptorFormat::CWL));
+    assert(!cache.get(doc, tdl::DescriptorFormat::CWL).hit());
+
+    // a different key does not see the entries
+    auto options           = tdl::CacheOptions{};
+    options.key            = "labelled";
+    options.postProcessCWL = [](YAML::Node & yaml) { yaml["label"] = "labelled"; };
+    auto labelled = tdl::CachedExporter{dir, options};
+    assert(labelled.path(doc, tdl::DescriptorFormat::CWL) != cache.path(doc, tdl::DescriptorFormat::CWL));
+    [[maybe_unused]] auto result = labelled.get(doc, tdl::DescriptorFormat::CWL);
+    assert(!result.hit());
+    assert(result.data().find("label: labelled") != std::string_view::npos);
+
+    // the options pick up the global post processing, like ExportAllOptions
+    tdl::post_process_cwl = [](YAML::Node & yaml) { yaml["label"] = "global"; };
+    auto globalOptions    = tdl::CacheOptions{};
+    tdl::post_process_cwl = nullptr;
+    globalOptions.key     = "global";
+    auto global           = tdl::CachedExporter{dir, globalOptions};
+    assert(global.get(doc, tdl::DescriptorFormat::CWL).data().find("label: global") != std::string_view::npos);
+
+    std::filesystem::remove_all(dir);
+}
+
+void testEviction() {
+    auto dir  = cacheDir();
+    auto docs = std::vector<tdl::ToolInfo>{};
+    for (auto name : {"a", "b", "c", "d"}) {
+        docs.push_back(createToolInfo(name));
+    }
+    auto entrySize = tdl::convertToCTD(docs[0]).size();
+
+    auto options     = tdl::CacheOptions{};
+    options.maxBytes = 3 * entrySize;
+    {
+        auto cache = tdl::CachedExporter{dir, options};
+        cache.get(docs[0], tdl::DescriptorFormat::CTD);
+        cache.get(docs[1], tdl::DescriptorFormat::CTD);
+        cache.get(docs[2], tdl::DescriptorFormat::CTD);
+        assert(cache.size() == 3 * entrySize);
+
+        assert(cache.get(docs[0], tdl::DescriptorFormat::CTD).hit()); // b is now the least recently used
+        cache.get(docs[3], tdl::DescriptorFormat::CTD);
+        assert(cache.size() == 3 * entrySize);
+        assert(!std::filesystem::exists(cache.path(docs[1], tdl::DescriptorFormat::CTD)));
+        assert(std::filesystem::exists(cache.path(docs[0], tdl::DescriptorFormat::CTD)));
+    }
+
+    // after a restart, the order of use is taken from the modification times
+    auto cache = tdl::CachedExporter{dir, options};
+    assert(cache.size() == 3 * entrySize);
+    auto now = std::filesystem::file_time_type::clock::now();
+    for (auto [doc, age] : {std::pair{&docs[0], 3}, {&docs[2], 2}, {&docs[3], 1}}) {
+        std::filesystem::last_write_time(cache.path(*doc, tdl::DescriptorFormat::CTD), now - std::chrono::hours{age});
+    }
+    auto restarted = tdl::CachedExporter{dir, options};
+    assert(restarted.get(docs[3], tdl::DescriptorFormat::CTD).hit());
+    assert(!restarted.get(docs[1], tdl::DescriptorFormat::CTD).hit()); // evicts a, the oldest
+    assert(!std::filesystem::exists(restarted.path(docs[0], tdl::DescriptorFormat::CTD)));
+    assert(restarted.get(docs[2], tdl::DescriptorFormat::CTD).hit());
+
+    // a smaller bound evicts on opening
+    options.maxBytes = entrySize;
+    assert(tdl::CachedExporter(dir, options).size() == entrySize);
+
+    std::filesystem::remove_all(dir);
+}
+
+} // namespace cached_exporter_tests
+
+void testCachedExporter() {
+    cached_exporter_tests::testHitsAndMisses();
+    cached_exporter_tests::testEviction();
+}
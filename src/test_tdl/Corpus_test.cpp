@@ -0,0 +1,48 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <filesystem>
+
+#include <tdl/cwl_v1_2.h>
+
+#include "utils.h"
+
+namespace corpus_tests {
+
+auto importCWLFromString(std::string const & cwl) {
+    auto document = w3id_org::cwl::load_document_from_string(cwl);
+    return tdl::importCWL(std::get<w3id_org::cwl::cwl::CommandLineTool>(document));
+}
+
+//!\brief the descriptors in src/test_tdl/corpus survive an import and export unchanged
+void testRoundTrip() {
+    [[maybe_unused]] auto ctdCount = 0;
+    [[maybe_unused]] auto cwlCount = 0;
+    for (auto const & entry : std::filesystem::directory_iterator{TDL_CORPUS_DIR}) {
+        auto const & path = entry.path();
+        if (path.extension() == ".ctd") {
+            auto first  = tdl::importCTD(path);
+            auto ctd    = tdl::convertToCTD(first);
+            auto second = tdl::importCTDFromString(ctd);
+            assert(tdl::diff(first, second).empty());
+            assert(tdl::convertToCTD(second) == ctd);
+            ++ctdCount;
+        } else if (path.extension() == ".cwl") {
+            auto first  = tdl::importCWL(path);
+            auto cwl    = tdl::convertToCWL(first);
+            auto second = importCWLFromString(cwl);
+            assert(tdl::diff(first, second).empty());
+            assert(tdl::convertToCWL(second) == cwl);
+            ++cwlCount;
+        }
+    }
+    assert(ctdCount >= 3);
+    assert(cwlCount >= 3);
+}
+
+} // namespace corpus_tests
+
+void testCorpus() {
+    corpus_tests::testRoundTrip();
+}
@@ -0,0 +1,166 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <stdexcept>
+
+#include "utils.h"
+
+namespace diff_tests {
+
+auto node(std::string name, tdl::Tags tags, tdl::Node::Value value) {
+    return tdl::Node{DESINIT(.name =) std::move(name),
+                     DESINIT(.description =){},
+                     DESINIT(.tags =) std::move(tags),
+                     DESINIT(.value =) std::move(value)};
+}
+
+auto createToolInfo() {
+    return tdl::ToolInfo{
+        DESINIT(.metaInfo =){DESINIT(.version =){"1.0.0"}, DESINIT(.name =){"tool"}},
+        DESINIT(.params =){
+            node("verbose", {}, tdl::BoolValue{false}),
+            node("threads", {}, tdl::IntValue{1, 1, 64}),
+            node("build",
+                 {"basecommand"},
+                 tdl::Node::Children{
+                     node("kmer", {}, tdl::IntValue{20, 1, 32}),
+                     node("input", {"required", "file"}, tdl::StringValue{}),
+                     node("options",
+                          {},
+                          tdl::Node::Children{
+                              node("ratio", {}, tdl::DoubleValue{0.5, 0.0, 1.0}),
+                              node("mode", {}, tdl::StringValue{"fast", {{"fast", "slow"}}}),
+                          }),
+                 }),
+        },
+        DESINIT(.cliMapping =){
+            {DESINIT(.optionIdentifier =) "--threads", DESINIT(.referenceName =) "threads"},
+            {DESINIT(.optionIdentifier =) "--kmer", DESINIT(.referenceName =) "kmer"},
+            {DESINIT(.optionIdentifier =) "--input", DESINIT(.referenceName =) "input"},
+        },
+    };
+}
+
+auto build(tdl::ToolInfo & doc) -> tdl::Node::Children & {
+    return std::get<tdl::Node::Children>(doc.params[2].value);
+}
+
+//!\brief checks that the patch turns `a` into `b` and returns it
+auto roundTrip(tdl::ToolInfo const & a, tdl::ToolInfo const & b) {
+    auto patch  = tdl::diff(a, b);
+    auto result = a;
+    tdl::apply(result, patch);
+    assert(tdl::fingerprint(result) == tdl::fingerprint(b));
+    return patch;
+}
+
+void testIdentical() {
+    auto doc = createToolInfo();
+    assert(tdl::diff(doc, doc).empty());
+}
+
+void testAddedOption() {
+    auto a = createToolInfo();
+    auto b = a;
+    build(b).insert(build(b).begin() + 1, node("window", {}, tdl::IntValue{20}));
+    b.cliMapping.push_back({"--window", "window"});
+
+    [[maybe_unused]] auto patch = roundTrip(a, b);
+    assert(!patch.metaInfo);
+    assert(patch.nodes.size() == 1);
+    assert(patch.nodes[0].kind == tdl::Patch::Kind::Added);
+    assert(patch.nodes[0].path == "build:window");
+    assert(patch.nodes[0].position == 1);
+    assert(patch.cliMapping.size() == 1);
+    assert(patch.cliMapping[0].kind == tdl::Patch::Kind::Added);
+    assert(patch.cliMapping[0].position == 3);
+}
+
+void testEdits() {
+    auto a = createToolInfo();
+
+    { // removed, changed and renamed nodes
+        auto b = a;
+        build(b)[0].name                                    = "k";
+        b.cliMapping[1].referenceName                       = "k";
+        std::get<tdl::IntValue>(b.params[1].value).maxLimit = 128;
+        b.params.erase(b.params.begin());
+
+        [[maybe_unused]] auto patch = roundTrip(a, b);
+        assert(patch.nodes.size() == 4); // removed verbose, changed threads, removed kmer, added k
+        assert(patch.nodes[0].kind == tdl::Patch::Kind::Removed && patch.nodes[0].path == "verbose");
+        assert(patch.nodes[1].kind == tdl::Patch::Kind::Changed && patch.nodes[1].path == "threads");
+        assert(patch.cliMapping.size() == 1 && patch.cliMapping[0].kind == tdl::Patch::Kind::Changed);
+    }
+
+    { // a changed group keeps its children
+        auto b = a;
+        b.params[2].description = "builds an index";
+        std::get<tdl::Node::Children>(build(b)[2].value)[1].tags.insert("advanced");
+
+        [[maybe_unused]] auto patch = roundTrip(a, b);
+        assert(patch.nodes.size() == 2);
+        assert(patch.nodes[0].path == "build");
+        assert(std::get<tdl::Node::Children>(patch.nodes[0].node.value).empty());
+        assert(patch.nodes[1].path == "build:options:mode");
+    }
+
+    { // a group becomes a value and a value becomes a group
+        auto b            = a;
+        b.params[0].value = tdl::Node::Children{node("level", {}, tdl::IntValue{0})};
+        build(b)[2].value = tdl::StringValue{"default"};
+        roundTrip(a, b);
+        roundTrip(b, a);
+    }
+
+    { // metadata and everything reordered
+        auto b             = a;
+        b.metaInfo.version = "1.1.0";
+        std::swap(b.params[0], b.params[2]);
+        std::swap(b.cliMapping[0], b.cliMapping[2]);
+        b.cliMapping.erase(b.cliMapping.begin() + 1);
+        b.params.push_back(node("seed", {}, tdl::IntValue{42}));
+
+        [[maybe_unused]] auto patch = roundTrip(a, b);
+        assert(patch.metaInfo && patch.metaInfo->version == "1.1.0");
+        assert(patch.nodes.back().kind == tdl::Patch::Kind::Reordered);
+        assert(patch.cliMapping.back().kind == tdl::Patch::Kind::Reordered);
+    }
+
+    { // unrelated trees
+        roundTrip(a, tdl::ToolInfo{});
+        roundTrip(tdl::ToolInfo{}, a);
+    }
+}
+
+void testErrors() {
+    auto a = createToolInfo();
+    auto b = a;
+    b.params.push_back(node("seed", {}, tdl::IntValue{1}));
+    b.params.push_back(node("seed", {}, tdl::IntValue{2}));
+
+    [[maybe_unused]] auto throws = [](auto f) {
+        try {
+            f();
+        } catch (std::runtime_error const &) {
+            return true;
+        }
+        return false;
+    };
+    assert(throws([&] { tdl::diff(a, b); })); // duplicate names can not be addressed
+
+    auto c     = a;
+    c.params.pop_back();
+    auto patch = tdl::diff(a, c);
+    assert(throws([&] { tdl::apply(c, patch); })); // build is already removed
+}
+
+} // namespace diff_tests
+
+void testDiff() {
+    diff_tests::testIdentical();
+    diff_tests::testAddedOption();
+    diff_tests::testEdits();
+    diff_tests::testErrors();
+}
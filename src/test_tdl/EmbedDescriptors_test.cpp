@@ -0,0 +1,99 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <stdexcept>
+
+#include "utils.h"
+
+// generated by tdl_generate_descriptors from embedded/toolInfo.cpp
+#include <embedded_descriptors.h>
+
+namespace embed_descriptors_tests {
+
+auto toolInfo() -> tdl::ToolInfo;
+
+//!\brief reads the char literals of a generated data array back into a string
+auto decodeCharArray(std::string const & source, std::string const & name) -> std::string {
+    auto pos = source.find("constexpr char " + name + "Data[] = {");
+    assert(pos != std::string::npos);
+    auto end = source.find("};", pos);
+
+    auto result = std::string{};
+    for (pos = source.find('\'', pos); pos < end; pos = source.find('\'', pos)) {
+        if (source[pos + 1] != '\\') {
+            result += source[pos + 1];
+            pos += 3;
+        } else if (source[pos + 2] == '0') {
+            break; // the terminating null
+        } else {
+            assert(source[pos + 2] == 'x');
+            result += static_cast<char>(std::stoi(source.substr(pos + 3, 2), nullptr, 16));
+            pos += 6;
+        }
+    }
+    return result;
+}
+
+void testGenerated() {
+    auto doc = toolInfo();
+    assert(embedded_descriptors::ctd == tdl::convertToCTD(doc));
+    assert(embedded_descriptors::cwl == tdl::convertToCWL(doc));
+    assert(embedded_descriptors::ctd.data()[embedded_descriptors::ctd.size()] == '\0');
+}
+
+void testEscaping() {
+    auto doc                 = toolInfo();
+    doc.metaInfo.description = std::string{"'\\\"\n\t\x01\xff"} + '\0' + "?" + "?=";
+
+    auto [header, source] = tdl::embedDescriptors(doc, {tdl::DescriptorFormat::CTD}, "a::b", "a_b.h");
+    assert(header.find("namespace a::b {") != std::string::npos);
+    assert(header.find("extern std::string_view const ctd;") != std::string::npos);
+    assert(header.find("cwl") == std::string::npos);
+    assert(source.find("#include \"a_b.h\"") != std::string::npos);
+    assert(decodeCharArray(source, "ctd") == tdl::convertToCTD(doc));
+}
+
+void testFormats() {
+    auto doc = toolInfo();
+
+    // duplicates are ignored
+    auto embedded = tdl::embedDescriptors(doc,
+                                          {tdl::DescriptorFormat::CWL, tdl::DescriptorFormat::CWL},
+                                          "descriptors",
+                                          "descriptors.h");
+    assert(embedded.header.find("ctd") == std::string::npos);
+    assert(embedded.source.find("cwlData[]") == embedded.source.rfind("cwlData[]"));
+    assert(decodeCharArray(embedded.source, "cwl") == tdl::convertToCWL(doc));
+
+    // no formats, valid but empty
+    embedded = tdl::embedDescriptors(doc, {}, "descriptors", "descriptors.h");
+    assert(embedded.source.find("Data[]") == std::string::npos);
+}
+
+void testInvalidNamespace() {
+    [[maybe_unused]] auto throws = [](std::string_view name) {
+        try {
+            tdl::embedDescriptors(tdl::ToolInfo{}, {}, name, "descriptors.h");
+        } catch (std::runtime_error const &) {
+            return true;
+        }
+        return false;
+    };
+    assert(throws(""));
+    assert(throws("1abc"));
+    assert(throws("a b"));
+    assert(throws("a::"));
+    assert(throws("::a"));
+    assert(throws("a:b"));
+    assert(!throws("a_1::_b2"));
+}
+
+} // namespace embed_descriptors_tests
+
+void testEmbedDescriptors() {
+    embed_descriptors_tests::testGenerated();
+    embed_descriptors_tests::testEscaping();
+    embed_descriptors_tests::testFormats();
+    embed_descriptors_tests::testInvalidNamespace();
+}
@@ -0,0 +1,152 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <atomic>
+#include <stdexcept>
+
+#include <yaml-cpp/yaml.h>
+
+#include <tdl/parallelFor.h>
+
+#include "utils.h"
+
+namespace export_all_tests {
+
+//!\brief tools of different sizes, so the workers finish them out of order
+auto createToolInfos(std::size_t count) {
+    auto docs = std::vector<tdl::ToolInfo>{};
+    for (std::size_t i = 0; i < count; ++i) {
+        auto doc          = tdl::ToolInfo{};
+        doc.metaInfo.name = "tool" + std::to_string(i);
+        for (std::size_t j = 0; j < 1 + (i * 7) % 40; ++j) {
+            doc.params.push_back(tdl::Node{DESINIT(.name =) "param" + std::to_string(j),
+                                           DESINIT(.description =) "",
+                                           DESINIT(.tags =){},
+                                           DESINIT(.value =) tdl::IntValue{static_cast<int>(i + j)}});
+        }
+        doc.cliMapping.push_back({"--param0", "param0"});
+        docs.push_back(std::move(doc));
+    }
+    return docs;
+}
+
+void testInputOrder() {
+    auto docs    = createToolInfos(50);
+    auto formats = std::vector<tdl::DescriptorFormat>{tdl::DescriptorFormat::CWL, tdl::DescriptorFormat::CTD};
+
+    for (auto threads : {1, 4}) {
+        auto options    = tdl::ExportAllOptions{};
+        options.threads = threads;
+
+        [[maybe_unused]] auto results = tdl::exportAll(docs, formats, options);
+        assert(results.size() == docs.size());
+        for (std::size_t i = 0; i < docs.size(); ++i) {
+            assert(results[i].size() == 2);
+            assert(results[i][0] == tdl::convertToCWL(docs[i]));
+            assert(results[i][1] == tdl::convertToCTD(docs[i]));
+        }
+    }
+    assert(tdl::exportAll(docs.data(), 0, formats).empty());
+}
+
+void testStats() {
+    auto docs    = createToolInfos(20);
+    auto stats   = tdl::ExportStats{};
+    auto options = tdl::ExportAllOptions{};
+
+    options.threads = 3;
+    options.stats   = &stats;
+
+    [[maybe_unused]] auto results = tdl::exportAll(docs, {tdl::DescriptorFormat::CTD}, options);
+    assert(stats.exports == docs.size());
+    [[maybe_unused]] auto bytes = std::size_t{};
+    for (auto const & result : results) {
+        bytes += result[0].size();
+    }
+    assert(stats.bytes == bytes);
+}
+
+void testPostProcess() {
+    auto docs    = createToolInfos(10);
+    auto calls   = std::atomic<std::size_t>{};
+    auto options = tdl::ExportAllOptions{};
+
+    options.threads        = 4;
+    options.postProcessCWL = [&](YAML::Node & yaml) {
+        yaml["label"] = "changed";
+        ++calls;
+    };
+
+    [[maybe_unused]] auto results = tdl::exportAll(docs, {tdl::DescriptorFormat::CWL}, options);
+    assert(calls == docs.size());
+    assert(results[3][0] == tdl::convertToCWL(docs[3], options.postProcessCWL));
+    assert(results[3][0].find("label: changed") != std::string::npos);
+
+    // the global callback is not used, nor changed
+    assert(!tdl::post_process_cwl);
+    assert(tdl::convertToCWL(docs[3]).find("label: changed") == std::string::npos);
+}
+
+void testErrors() {
+    auto docs    = createToolInfos(10);
+    auto options = tdl::ExportAllOptions{};
+
+    options.threads        = 4;
+    options.postProcessCWL = [](YAML::Node & yaml) {
+        if (yaml["label"].as<std::string>() == "tool3" || yaml["label"].as<std::string>() == "tool7") {
+            throw std::runtime_error{yaml["label"].as<std::string>()};
+        }
+    };
+
+    auto message = std::string{};
+    try {
+        tdl::exportAll(docs, {tdl::DescriptorFormat::CWL}, options);
+    } catch (std::runtime_error const & e) {
+        message = e.what();
+    }
+    assert(message == "tool3"); // the first failed tool
+}
+
+void testParallelFor() {
+    for (auto threads : {0, 1, 3, 16}) {
+        auto visits  = std::vector<std::atomic<int>>(100);
+        [[maybe_unused]] auto workers = tdl::detail::workerCount(threads, visits.size());
+        assert(workers >= 1 && workers <= 16);
+
+        tdl::detail::parallelFor(visits.size(), threads, [&](std::size_t i, [[maybe_unused]] std::size_t worker) {
+            assert(worker < workers);
+            ++visits[i];
+        });
+        for ([[maybe_unused]] auto const & v : visits) {
+            assert(v == 1);
+        }
+    }
+    tdl::detail::parallelFor(0, 4, [](std::size_t, std::size_t) { assert(false); });
+
+    // an exception stops the remaining indices and is passed on
+    auto started = std::atomic<std::size_t>{};
+    auto message = std::string{};
+    try {
+        tdl::detail::parallelFor(1000, 4, [&](std::size_t i, std::size_t) {
+            ++started;
+            if (i == 10) {
+                throw std::runtime_error{"index 10"};
+            }
+        });
+    } catch (std::runtime_error const & e) {
+        message = e.what();
+    }
+    assert(message == "index 10");
+    assert(started < 1000);
+}
+
+} // namespace export_all_tests
+
+void testExportAll() {
+    export_all_tests::testInputOrder();
+    export_all_tests::testStats();
+    export_all_tests::testPostProcess();
+    export_all_tests::testErrors();
+    export_all_tests::testParallelFor();
+}
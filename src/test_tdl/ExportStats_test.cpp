@@ -0,0 +1,81 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include "utils.h"
+
+namespace export_stats_tests {
+
+//!\brief pretends that every call is one allocation
+auto fakeAllocationCounter() -> std::size_t {
+    static auto calls = std::size_t{};
+    return ++calls;
+}
+
+void testCTD() {
+    auto doc   = test_fixtures::smallToolInfo();
+    auto stats = tdl::ExportStats{};
+
+    stats.allocationCounter = fakeAllocationCounter;
+
+    auto ctd = tdl::convertToCTD(doc, stats);
+    assert(ctd == tdl::convertToCTD(doc));
+    assert(stats.exports == 1);
+    assert(stats.nodes == 3);
+    assert(stats.bytes == ctd.size());
+    assert(stats.allocationCount(tdl::ExportPhase::CTDBuild) == 1);
+    assert(stats.allocationCount(tdl::ExportPhase::CTDGenerate) == 1);
+    assert(stats.allocationCount(tdl::ExportPhase::CWLBuild) == 0);
+    assert(stats.duration(tdl::ExportPhase::CWLEmit).count() == 0);
+    assert(stats.totalDuration()
+           == stats.duration(tdl::ExportPhase::CTDBuild) + stats.duration(tdl::ExportPhase::CTDGenerate));
+}
+
+void testCWL() {
+    auto doc   = test_fixtures::smallToolInfo();
+    auto stats = tdl::ExportStats{};
+
+    stats.allocationCounter = fakeAllocationCounter;
+
+    auto cwl = tdl::convertToCWL(doc, stats);
+    assert(cwl == tdl::convertToCWL(doc));
+    assert(stats.bytes == cwl.size());
+    for ([[maybe_unused]] auto phase : {tdl::ExportPhase::CWLBuild,
+                                        tdl::ExportPhase::CWLToYaml,
+                                        tdl::ExportPhase::CWLSimplifyTypes,
+                                        tdl::ExportPhase::CWLEmit}) {
+        assert(stats.allocationCount(phase) == 1);
+    }
+    // without a post_process_cwl callback, the phase does not run
+    assert(stats.allocationCount(tdl::ExportPhase::CWLPostProcess) == 0);
+    assert(stats.allocationCount(tdl::ExportPhase::CTDBuild) == 0);
+
+    tdl::post_process_cwl = [](YAML::Node &) {};
+    tdl::convertToCWL(doc, stats);
+    tdl::post_process_cwl = nullptr;
+    assert(stats.allocationCount(tdl::ExportPhase::CWLPostProcess) == 1);
+}
+
+void testAccumulate() {
+    auto doc   = test_fixtures::smallToolInfo();
+    auto stats = tdl::ExportStats{};
+
+    auto ctd = tdl::convertToCTD(doc, stats);
+    auto cwl = tdl::convertToCWL(doc, stats);
+    tdl::convertToCTD(doc, stats);
+    assert(stats.exports == 3);
+    assert(stats.nodes == 9);
+    assert(stats.bytes == 2 * ctd.size() + cwl.size());
+    assert(stats.allocationCount(tdl::ExportPhase::CTDBuild) == 0); // no counter set
+
+    assert(tdl::exportPhaseName(tdl::ExportPhase::CTDBuild) == "ctd_build");
+    assert(tdl::exportPhaseName(tdl::ExportPhase::CWLEmit) == "cwl_emit");
+}
+
+} // namespace export_stats_tests
+
+void testExportStats() {
+    export_stats_tests::testCTD();
+    export_stats_tests::testCWL();
+    export_stats_tests::testAccumulate();
+}
@@ -0,0 +1,69 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include "utils.h"
+
+namespace fingerprint_tests {
+
+auto options(tdl::ToolInfo & doc) -> tdl::Node::Children & {
+    return std::get<tdl::Node::Children>(doc.params[2].value);
+}
+
+void testFnv1a() {
+    auto hash = tdl::detail::Fnv1a128{};
+    assert(hash.value().toString() == "6c62272e07bb014262b821756295c58d");
+    hash.update("a");
+    assert(hash.value().toString() == "d228cb696f1a8caf78912b704e4a8964");
+}
+
+void testStable() {
+    // a persistent cache key, this value must never change
+    assert(tdl::fingerprint(test_fixtures::toolInfo()).toString() == "5de2e520aaba002eb14598ac3d6b87f7");
+}
+
+void testSensitivity() {
+    auto reference = tdl::fingerprint(test_fixtures::toolInfo());
+    assert(tdl::fingerprint(test_fixtures::toolInfo()) == reference);
+
+    [[maybe_unused]] auto differs = [&](auto change) {
+        auto doc = test_fixtures::toolInfo();
+        change(doc);
+        return tdl::fingerprint(doc) != reference;
+    };
+    assert(differs([](auto & doc) { doc.metaInfo.version = "1.0.1"; }));
+    assert(differs([](auto & doc) { doc.metaInfo.citations.clear(); }));
+    assert(differs([](auto & doc) { doc.params[0].name = "Verbose"; }));
+    assert(differs([](auto & doc) { doc.params[0].description.clear(); }));
+    assert(differs([](auto & doc) { doc.params[0].tags.insert("required"); }));
+    assert(differs([](auto & doc) { doc.params[0].value = false; }));
+    assert(differs([](auto & doc) { std::get<tdl::IntValue>(doc.params[1].value).maxLimit.reset(); }));
+    assert(differs([](auto & doc) { doc.params[1].value = tdl::IntValueList{{1}, 1, 64}; }));
+    assert(differs([](auto & doc) { std::get<tdl::DoubleValue>(options(doc)[0].value).value = 0.25; }));
+    assert(differs([](auto & doc) { std::get<tdl::StringValue>(options(doc)[1].value).validValues->pop_back(); }));
+    assert(differs([](auto & doc) { std::get<tdl::IntValueList>(options(doc)[2].value).value.push_back(2); }));
+    assert(differs([](auto & doc) { std::get<tdl::DoubleValueList>(options(doc)[3].value).value[0] = 0.5; }));
+    assert(differs([](auto & doc) { std::get<tdl::StringValueList>(options(doc)[4].value).value = {"", "a"}; }));
+    assert(differs([](auto & doc) { std::swap(options(doc)[0], options(doc)[1]); }));
+    assert(differs([](auto & doc) { doc.cliMapping[0].optionIdentifier = "-t"; }));
+    assert(differs([](auto & doc) { doc.cliMapping.clear(); }));
+
+    // moving a node into its sibling group is a different tree
+    assert(differs([](auto & doc) {
+        options(doc).push_back(doc.params[1]);
+        doc.params.erase(doc.params.begin() + 1);
+    }));
+    // strings are length prefixed, the split between name and description matters
+    assert(differs([](auto & doc) {
+        doc.params[0].name += "d";
+        doc.params[0].description.erase(0, 1);
+    }));
+}
+
+} // namespace fingerprint_tests
+
+void testFingerprint() {
+    fingerprint_tests::testFnv1a();
+    fingerprint_tests::testStable();
+    fingerprint_tests::testSensitivity();
+}
@@ -0,0 +1,124 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <filesystem>
+
+#include "utils.h"
+
+namespace flat_tool_info_tests {
+
+auto createToolInfo() {
+    return tdl::ToolInfo{
+        DESINIT(.metaInfo =){
+            DESINIT(.version =) "1.0",
+            DESINIT(.name =) "flat",
+        },
+        DESINIT(.params =){
+            tdl::Node{DESINIT(.name =) "verbose",
+                      DESINIT(.description =) "a flag",
+                      DESINIT(.tags =){},
+                      DESINIT(.value =) tdl::BoolValue{true}},
+            tdl::Node{DESINIT(.name =) "index",
+                      DESINIT(.description =) "a group",
+                      DESINIT(.tags =){"basecommand"},
+                      DESINIT(.value =) tdl::Node::Children{
+                          tdl::Node{DESINIT(.name =) "input",
+                                    DESINIT(.description =) "a file",
+                                    DESINIT(.tags =){"file", "required"},
+                                    DESINIT(.value =) tdl::StringValue{"in.fa"}},
+                          tdl::Node{DESINIT(.name =) "kmer",
+                                    DESINIT(.description =) "a number",
+                                    DESINIT(.tags =){},
+                                    DESINIT(.value =) tdl::IntValue{20, 1, 32}},
+                          tdl::Node{DESINIT(.name =) "empty",
+                                    DESINIT(.description =) "a group",
+                                    DESINIT(.tags =){},
+                                    DESINIT(.value =) tdl::Node::Children{}},
+                          tdl::Node{DESINIT(.name =) "ratios",
+                                    DESINIT(.description =) "a number",
+                                    DESINIT(.tags =){"custom"},
+                                    DESINIT(.value =) tdl::DoubleValueList{{0.5, 0.25}}},
+                      }},
+            tdl::Node{DESINIT(.name =) "input",
+                      DESINIT(.description =) "a file",
+                      DESINIT(.tags =){"file"},
+                      DESINIT(.value =) tdl::StringValueList{{"a", "b"}}},
+        },
+        DESINIT(.cliMapping =){
+            {DESINIT(.optionIdentifier =) "--kmer", DESINIT(.referenceName =) "kmer"},
+        },
+    };
+}
+
+void testLayout() {
+    auto flat = tdl::flatten(createToolInfo());
+    using Indices [[maybe_unused]] = std::vector<tdl::FlatToolInfo::Index>;
+    [[maybe_unused]] auto npos     = tdl::FlatToolInfo::npos;
+
+    // pre-order: verbose, index, input, kmer, empty, ratios, input
+    assert(flat.size() == 7);
+    assert((flat.parent == Indices{npos, npos, 1, 1, 1, 1, npos}));
+    assert((flat.firstChild == Indices{npos, 2, npos, npos, npos, npos, npos}));
+    assert((flat.nextSibling == Indices{1, 6, 3, 4, 5, npos, npos}));
+    assert(flat.nameOf(5) == "ratios");
+
+    // equal names and descriptions are stored once
+    assert(flat.name[2] == flat.name[6]);
+    assert(flat.description[1] == flat.description[4]);
+    assert(flat.strings.size() == 10);
+
+    assert(flat.valueType[3] == tdl::FlatToolInfo::ValueType::Int);
+    assert(flat.ints.size() == 1);
+    assert(flat.ints[flat.valueIndex[3]].maxLimit == 32);
+    assert(std::get<tdl::StringValue>(flat.valueOf(2)).value == "in.fa");
+    assert(flat.tags[2].contains(tdl::Tag::required));
+
+    assert(flat.findChild(npos, "input") == 6);
+    assert(flat.findChild(1, "input") == 2);
+    assert(flat.findChild(4, "input") == npos);
+    assert(flat.findChild(npos, "kmer") == npos);
+    assert(flat.find("kmer") == 3);
+    assert(flat.find("input") == 2);
+    assert(flat.find("missing") == npos);
+
+    assert(tdl::flatten(tdl::ToolInfo{}).size() == 0);
+    assert(tdl::unflatten(tdl::FlatToolInfo{}).params.empty());
+}
+
+void testRoundTrip() {
+    auto toolInfo = createToolInfo();
+    auto flat     = tdl::flatten(toolInfo);
+
+    [[maybe_unused]] auto back = tdl::unflatten(flat);
+    assert(back.params.size() == 3);
+    assert(std::get<tdl::Node::Children>(back.params[1].value).size() == 4);
+    assert(tdl::convertToCTD(back) == tdl::convertToCTD(toolInfo));
+
+    assert(tdl::convertToCTD(flat) == tdl::convertToCTD(toolInfo));
+    assert(tdl::convertToCWL(flat) == tdl::convertToCWL(toolInfo));
+    assert(tdl::convertToCTD(tdl::FlatToolInfo{}) == tdl::convertToCTD(tdl::ToolInfo{}));
+    assert(tdl::convertToCWL(tdl::FlatToolInfo{}) == tdl::convertToCWL(tdl::ToolInfo{}));
+}
+
+//!\brief the exporters give the same result for the corpus, whether it is flattened or not
+void testCorpusExport() {
+    for (auto const & entry : std::filesystem::directory_iterator{TDL_CORPUS_DIR}) {
+        auto const & path = entry.path();
+        if (path.extension() != ".ctd" && path.extension() != ".cwl") {
+            continue;
+        }
+        auto toolInfo = path.extension() == ".ctd" ? tdl::importCTD(path) : tdl::importCWL(path);
+        auto flat     = tdl::flatten(toolInfo);
+        assert(tdl::convertToCTD(flat) == tdl::convertToCTD(toolInfo));
+        assert(tdl::convertToCWL(flat) == tdl::convertToCWL(toolInfo));
+    }
+}
+
+} // namespace flat_tool_info_tests
+
+void testFlatToolInfo() {
+    flat_tool_info_tests::testLayout();
+    flat_tool_info_tests::testRoundTrip();
+    flat_tool_info_tests::testCorpusExport();
+}
@@ -0,0 +1,198 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <limits>
+#include <stdexcept>
+
+#include <tdl/XMLScanner.h>
+
+#include "utils.h"
+
+namespace import_ctd_tests {
+
+auto createToolInfo() {
+    return tdl::ToolInfo{
+        DESINIT(.metaInfo =){
+            DESINIT(.version =){"1.2.3"},
+            DESINIT(.name =){"roundtrip"},
+            DESINIT(.docurl =){"example.com"},
+            DESINIT(.category =){"test"},
+            DESINIT(.description =){"checks the ctd import\nin two lines & with <xml> characters"},
+            DESINIT(.executableName =){"roundtrip"},
+            DESINIT(.citations =){{"doi:123", "https://example.com/paper"}, {"doi:456", ""}},
+        },
+        DESINIT(.params =){
+            tdl::Node{DESINIT(.name =) "threads",
+                      DESINIT(.description =) "Number of \"threads\"",
+                      DESINIT(.tags =){"required"},
+                      DESINIT(.value =) tdl::IntValue{4, 1, std::nullopt}},
+            tdl::Node{DESINIT(.name =) "ratio",
+                      DESINIT(.description =) "",
+                      DESINIT(.tags =){"advanced", "gxy:custom"},
+                      DESINIT(.value =) tdl::DoubleValue{0.1, std::nullopt, 1.0}},
+            tdl::Node{DESINIT(.name =) "verbose",
+                      DESINIT(.description =) "line\nbreak",
+                      DESINIT(.tags =){},
+                      DESINIT(.value =) tdl::BoolValue{true}},
+            tdl::Node{DESINIT(.name =) "build",
+                      DESINIT(.description =) "a sub command",
+                      DESINIT(.tags =){"basecommand"},
+                      DESINIT(.value =) tdl::Node::Children{
+                          tdl::Node{DESINIT(.name =) "mode",
+                                    DESINIT(.description =) "",
+                                    DESINIT(.tags =){},
+                                    DESINIT(.value =) tdl::StringValue{"fast", {{"fast", "slow"}}}},
+                          tdl::Node{DESINIT(.name =) "input",
+                                    DESINIT(.description =) "",
+                                    DESINIT(.tags =){"input file", "required"},
+                                    DESINIT(.value =) tdl::StringValue{"", {{"*.fa", "*.fasta"}}}},
+                          tdl::Node{DESINIT(.name =) "output",
+                                    DESINIT(.description =) "",
+                                    DESINIT(.tags =){"output file"},
+                                    DESINIT(.value =) tdl::StringValue{"out.txt"}},
+                          tdl::Node{DESINIT(.name =) "prefix",
+                                    DESINIT(.description =) "",
+                                    DESINIT(.tags =){"output prefix"},
+                                    DESINIT(.value =) tdl::StringValue{"out"}},
+                          tdl::Node{DESINIT(.name =) "sizes",
+                                    DESINIT(.description =) "",
+                                    DESINIT(.tags =){},
+                                    DESINIT(.value =) tdl::IntValueList{{1, 2, 3}, 0, 10}},
+                          tdl::Node{DESINIT(.name =) "weights",
+                                    DESINIT(.description =) "",
+                                    DESINIT(.tags =){},
+                                    DESINIT(.value =) tdl::DoubleValueList{{0.1, 1e-300}}},
+                          tdl::Node{DESINIT(.name =) "names",
+                                    DESINIT(.description =) "",
+                                    DESINIT(.tags =){},
+                                    DESINIT(.value =) tdl::StringValueList{{"a", "b,c"}, {{"a", "b"}}}},
+                          tdl::Node{DESINIT(.name =) "inputs",
+                                    DESINIT(.description =) "",
+                                    DESINIT(.tags =){"input file"},
+                                    DESINIT(.value =) tdl::StringValueList{{}, {{"*.bam"}}}},
+                          tdl::Node{DESINIT(.name =) "empty",
+                                    DESINIT(.description =) "",
+                                    DESINIT(.tags =){},
+                                    DESINIT(.value =) tdl::Node::Children{}},
+                      }},
+        },
+        DESINIT(.cliMapping =){{"--threads", "threads"}, {"-m", "build:mode"}},
+    };
+}
+
+void testRoundTrip() {
+    auto doc      = createToolInfo();
+    auto ctd      = tdl::convertToCTD(doc);
+    auto imported = tdl::importCTDFromString(ctd);
+
+    assert(tdl::diff(doc, imported).empty());
+    assert(tdl::convertToCTD(imported) == ctd);
+}
+
+void testOpenMSStyle() {
+    auto imported = tdl::importCTDFromString(R"(<?xml version="1.0" encoding="UTF-8"?>
+<tool ctdVersion="1.7" version="3.1.0" name="FileFilter" docurl="http://www.openms.de" category="File Handling" >
+<description><![CDATA[Extracts or manipulates portions of data from peak, feature or consensus-feature files.]]></description>
+<manual><![CDATA[Not the description]]></manual>
+<citations>
+  <citation doi="10.1038/s41592-024-02197-7" url="" />
+</citations>
+<PARAMETERS version="1.7.0" xsi:noNamespaceSchemaLocation="https://raw.githubusercontent.com/OpenMS/OpenMS/develop/share/OpenMS/SCHEMAS/Param_1_7_0.xsd" xmlns:xsi="http://www.w3.org/2001/XMLSchema-instance">
+  <NODE name="FileFilter" description="Extracts or manipulates portions of data.">
+    <ITEM name="version" value="3.1.0" type="string" description="Version of the tool that generated this parameters file." required="false" advanced="true" />
+    <NODE name="1" description="Instance &apos;1&apos; section for &apos;FileFilter&apos;">
+      <ITEM name="in" value="" type="input-file" description="Input file" required="true" advanced="false" supported_formats="*.mzML,*.featureXML" />
+      <ITEM name="threads" value="1" type="int" description="Sets the number of threads." required="false" advanced="true" />
+      <ITEM name="sort" value="false" type="bool" description="Sorts the output." required="false" advanced="false" />
+      <ITEMLIST name="mz" type="double" description="m/z range" required="false" advanced="false" restrictions="0.0:">
+        <LISTITEM value="0.0"/>
+        <LISTITEM value="1.79769313486232e+308"/>
+      </ITEMLIST>
+      <!-- a comment -->
+      <ITEM name="flag" value="false" type="string" description="" required="false" advanced="false" restrictions="true,false" />
+    </NODE>
+  </NODE>
+</PARAMETERS>
+</tool>
+)");
+
+    assert(imported.metaInfo.name == "FileFilter");
+    assert(imported.metaInfo.category == "File Handling");
+    assert(imported.metaInfo.description.rfind("Extracts", 0) == 0);
+    assert(imported.metaInfo.executableName.empty());
+    assert(imported.metaInfo.citations.size() == 1);
+    assert(imported.cliMapping.empty());
+
+    assert(imported.params.size() == 1);
+    auto const & root = std::get<tdl::Node::Children>(imported.params[0].value);
+    assert(root.size() == 2);
+    assert(root[0].tags.contains(tdl::Tag::advanced));
+
+    auto const & instance = root[1];
+    assert(instance.description == "Instance '1' section for 'FileFilter'");
+    auto const & params = std::get<tdl::Node::Children>(instance.value);
+    assert(params.size() == 5);
+
+    assert(params[0].tags.contains(tdl::Tag::input_file));
+    assert(params[0].tags.contains(tdl::Tag::required));
+    [[maybe_unused]] auto const & in = std::get<tdl::StringValue>(params[0].value);
+    assert(in.validValues == (std::vector<std::string>{"*.mzML", "*.featureXML"}));
+
+    assert(std::get<tdl::IntValue>(params[1].value).value == 1);
+    assert(!std::get<tdl::IntValue>(params[1].value).minLimit);
+    assert(std::get<tdl::BoolValue>(params[2].value) == false);
+
+    [[maybe_unused]] auto const & mz = std::get<tdl::DoubleValueList>(params[3].value);
+    // OpenMS writes the largest double rounded up, which is clamped
+    assert(mz.value == (std::vector<double>{0.0, std::numeric_limits<double>::max()}));
+    assert(mz.minLimit == 0.0);
+    assert(!mz.maxLimit);
+
+    [[maybe_unused]] auto const & flag = std::get<tdl::StringValue>(params[4].value);
+    assert(flag.validValues == (std::vector<std::string>{"true", "false"}));
+
+    // a second round trip does not change anything
+    assert(tdl::diff(imported, tdl::importCTDFromString(tdl::convertToCTD(imported))).empty());
+}
+
+void testText() {
+    auto scanner = tdl::detail::XMLScanner{"<a>x &amp; <![CDATA[<y> &amp;]]><!-- c --> z</a><b/>"};
+    assert(scanner.next() == tdl::detail::XMLScanner::Token::StartTag);
+    assert(scanner.text() == "x & <y> &amp; z");
+    assert(scanner.next() == tdl::detail::XMLScanner::Token::EndTag);
+    assert(scanner.name() == "a");
+    assert(scanner.next() == tdl::detail::XMLScanner::Token::StartTag);
+    assert(scanner.text().empty());
+    assert(scanner.next() == tdl::detail::XMLScanner::Token::EndTag);
+}
+
+void testErrors() {
+    [[maybe_unused]] auto throws = [](std::string const & document) {
+        try {
+            tdl::importCTDFromString(document);
+        } catch (std::runtime_error const &) {
+            return true;
+        }
+        return false;
+    };
+    assert(throws("<other/>"));
+    assert(throws("<PARAMETERS><ITEM name=\"a\" value=\"x\" type=\"int\"/></PARAMETERS>"));
+    assert(throws("<PARAMETERS><ITEM name=\"a\" value=\"1\" type=\"int\" restrictions=\"5\"/></PARAMETERS>"));
+    assert(throws("<PARAMETERS><ITEM name=\"a\" value=\"1\" type=\"color\"/></PARAMETERS>"));
+    assert(throws("<PARAMETERS><ITEM value=\"1\" type=\"int\"/></PARAMETERS>"));
+    assert(throws("<PARAMETERS><LISTITEM value=\"1\"/></PARAMETERS>"));
+    assert(throws("<tool><cli><mapping referenceName=\"a\"/></cli></tool>"));
+    assert(throws("<tool><PARAMETERS></NODE></PARAMETERS></tool>"));
+    assert(throws("<tool><PARAMETERS><NODE name=\"a\"></NODE></NODE></PARAMETERS></tool>"));
+    assert(!throws("<PARAMETERS/>"));
+}
+
+} // namespace import_ctd_tests
+
+void testImportCTD() {
+    import_ctd_tests::testRoundTrip();
+    import_ctd_tests::testOpenMSStyle();
+    import_ctd_tests::testText();
+    import_ctd_tests::testErrors();
+}
@@ -0,0 +1,195 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <tdl/cwl_v1_2.h>
+
+#include "utils.h"
+
+namespace import_cwl_tests {
+
+auto importFromString(std::string const & cwl) {
+    auto document = w3id_org::cwl::load_document_from_string(cwl);
+    return tdl::importCWL(std::get<w3id_org::cwl::cwl::CommandLineTool>(document));
+}
+
+void testRoundTrip() {
+    auto toolInfo = tdl::ToolInfo{
+        DESINIT(.metaInfo =){
+            DESINIT(.version =){},
+            DESINIT(.name =) "roundtrip",
+            DESINIT(.docurl =){},
+            DESINIT(.category =){},
+            DESINIT(.description =) "a tool to check the cwl import",
+            DESINIT(.executableName =) "echo",
+        },
+        DESINIT(.params =){
+            tdl::Node{DESINIT(.name =) "build",
+                      DESINIT(.description =){},
+                      DESINIT(.tags =){"basecommand"},
+                      DESINIT(.value =) tdl::Node::Children{
+                          tdl::Node{DESINIT(.name =) "kmer",
+                                    DESINIT(.description =) "The k-mer size",
+                                    DESINIT(.tags =){"required"},
+                                    DESINIT(.value =) tdl::IntValue{20, 1, 32}},
+                          tdl::Node{DESINIT(.name =) "window",
+                                    DESINIT(.description =) "The window size",
+                                    DESINIT(.tags =){},
+                                    DESINIT(.value =) tdl::IntValue{22}},
+                          tdl::Node{DESINIT(.name =) "window_with_hint",
+                                    DESINIT(.description =) "The window size with a hint",
+                                    DESINIT(.tags =){"required", "default_as_hint"},
+                                    DESINIT(.value =) tdl::IntValue{20}},
+                          tdl::Node{DESINIT(.name =) "ratio",
+                                    DESINIT(.description =) "A ratio",
+                                    DESINIT(.tags =){},
+                                    DESINIT(.value =) tdl::DoubleValue{0.25}},
+                          tdl::Node{DESINIT(.name =) "verbose",
+                                    DESINIT(.description =) "Verbose output",
+                                    DESINIT(.tags =){},
+                                    DESINIT(.value =) tdl::BoolValue{true}},
+                          tdl::Node{DESINIT(.name =) "mode",
+                                    DESINIT(.description =) "Some mode",
+                                    DESINIT(.tags =){"no_default"},
+                                    DESINIT(.value =) tdl::StringValue{}},
+                          tdl::Node{DESINIT(.name =) "name",
+                                    DESINIT(.description =) "Some name",
+                                    DESINIT(.tags =){},
+                                    DESINIT(.value =) tdl::StringValue{"tdl"}},
+                          tdl::Node{DESINIT(.name =) "input",
+                                    DESINIT(.description =) "Input file",
+                                    DESINIT(.tags =){"required", "file"},
+                                    DESINIT(.value =) tdl::StringValue{}},
+                          tdl::Node{DESINIT(.name =) "optional_input",
+                                    DESINIT(.description =) "Optional input file",
+                                    DESINIT(.tags =){"file"},
+                                    DESINIT(.value =) tdl::StringValue{}},
+                          tdl::Node{DESINIT(.name =) "inputs",
+                                    DESINIT(.description =) "Multiple input files",
+                                    DESINIT(.tags =){"file"},
+                                    DESINIT(.value =) tdl::StringValueList{}},
+                          tdl::Node{DESINIT(.name =) "sizes",
+                                    DESINIT(.description =) "Some sizes",
+                                    DESINIT(.tags =){"required"},
+                                    DESINIT(.value =) tdl::IntValueList{}},
+                          tdl::Node{DESINIT(.name =) "output",
+                                    DESINIT(.description =) "Output file",
+                                    DESINIT(.tags =){"required", "output", "file"},
+                                    DESINIT(.value =) tdl::StringValue{}},
+                          tdl::Node{DESINIT(.name =) "output_dir",
+                                    DESINIT(.description =) "Output directory",
+                                    DESINIT(.tags =){"output", "directory"},
+                                    DESINIT(.value =) tdl::StringValue{}},
+                          tdl::Node{DESINIT(.name =) "prefix",
+                                    DESINIT(.description =) "Output prefix",
+                                    DESINIT(.tags =){"output", "prefixed"},
+                                    DESINIT(.value =) tdl::StringValueList{}},
+                          tdl::Node{DESINIT(.name =) "options",
+                                    DESINIT(.description =) "Nested options",
+                                    DESINIT(.tags =){},
+                                    DESINIT(.value =) tdl::Node::Children{
+                                        tdl::Node{DESINIT(.name =) "threads",
+                                                  DESINIT(.description =) "Number of threads",
+                                                  DESINIT(.tags =){"required"},
+                                                  DESINIT(.value =) tdl::IntValue{1}},
+                                        tdl::Node{DESINIT(.name =) "scores",
+                                                  DESINIT(.description =) "Some scores",
+                                                  DESINIT(.tags =){},
+                                                  DESINIT(.value =) tdl::DoubleValueList{}},
+                                    }},
+                      }},
+        },
+        DESINIT(.cliMapping =){
+            {DESINIT(.optionIdentifier =) "--kmer", DESINIT(.referenceName =) "kmer"},
+            {DESINIT(.optionIdentifier =) "--window", DESINIT(.referenceName =) "window"},
+            {DESINIT(.optionIdentifier =) "--ratio", DESINIT(.referenceName =) "ratio"},
+            {DESINIT(.optionIdentifier =) "--input", DESINIT(.referenceName =) "input"},
+            {DESINIT(.optionIdentifier =) "--output", DESINIT(.referenceName =) "output"},
+            {DESINIT(.optionIdentifier =) "--prefix", DESINIT(.referenceName =) "prefix"},
+            {DESINIT(.optionIdentifier =) "--threads", DESINIT(.referenceName =) "threads"},
+        },
+    };
+
+    auto cwl      = tdl::convertToCWL(toolInfo);
+    auto imported = importFromString(cwl);
+
+    // exporting the imported tool reproduces the same document
+    assert(tdl::convertToCWL(imported) == cwl);
+
+    assert(imported.metaInfo.name == "roundtrip");
+    assert(imported.metaInfo.executableName == "echo");
+    assert(imported.cliMapping.size() == toolInfo.cliMapping.size());
+    assert(imported.params.size() == 1);
+
+    auto const & build = imported.params[0];
+    assert(build.name == "build");
+    assert(build.tags.count("basecommand"));
+
+    [[maybe_unused]] auto const & children = std::get<tdl::Node::Children>(build.value);
+    assert(children.size() == 15);
+    assert(std::get<tdl::IntValue>(children[1].value).value == 22);
+    assert(std::get<tdl::DoubleValue>(children[3].value).value == 0.25);
+    assert(std::get<tdl::BoolValue>(children[4].value) == true);
+    assert(children[5].tags.count("no_default"));
+    assert(std::get<tdl::StringValue>(children[6].value).value == "tdl");
+    assert(children[11].tags == (std::set<std::string>{"required", "output", "file"}));
+    assert(children[13].tags == (std::set<std::string>{"output", "prefixed"}));
+    assert(std::holds_alternative<tdl::StringValueList>(children[13].value));
+    assert(std::get<tdl::Node::Children>(children[14].value).size() == 2);
+}
+
+void testThirdPartyTool() {
+    auto imported = importFromString(R"(cwlVersion: v1.2
+class: CommandLineTool
+label: sort
+doc:
+  - sorts lines
+  - of a file
+baseCommand: sort
+inputs:
+  - id: "#main/reverse"
+    type: boolean
+    default: false
+    inputBinding:
+      prefix: -r
+  - id: "#main/order"
+    type:
+      type: enum
+      symbols: [numeric, alphabetic]
+  - id: "#main/file"
+    type: File
+    inputBinding:
+      position: 1
+outputs:
+  sorted:
+    type: stdout
+)");
+
+    assert(imported.metaInfo.name == "sort");
+    assert(imported.metaInfo.description == "sorts lines\nof a file");
+    assert(imported.metaInfo.executableName == "sort");
+    assert(imported.params.size() == 3);
+
+    [[maybe_unused]] auto const & reverse = imported.params[0];
+    assert(reverse.name == "reverse");
+    assert(reverse.tags == (std::set<std::string>{"required", "default_as_hint"}));
+    assert(std::get<tdl::BoolValue>(reverse.value) == false);
+
+    [[maybe_unused]] auto const & order = imported.params[1];
+    assert(order.name == "order");
+    assert((std::get<tdl::StringValue>(order.value).validValues == std::vector<std::string>{"numeric", "alphabetic"}));
+
+    [[maybe_unused]] auto const & file = imported.params[2];
+    assert(file.tags == (std::set<std::string>{"required", "file"}));
+
+    assert(imported.cliMapping.size() == 1);
+    assert(imported.cliMapping[0].optionIdentifier == "-r");
+    assert(imported.cliMapping[0].referenceName == "reverse");
+}
+
+} // namespace import_cwl_tests
+
+void testImportCWL() {
+    import_cwl_tests::testRoundTrip();
+    import_cwl_tests::testThirdPartyTool();
+}
@@ -0,0 +1,110 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include <tdl/cwl_v1_2.h>
+
+#include "utils.h"
+
+namespace load_cwl_tests {
+
+void testLoadDocuments() {
+    namespace cwl = w3id_org::cwl;
+
+    auto dir = std::filesystem::temp_directory_path() / "tdl_load_documents_test";
+    std::filesystem::create_directories(dir);
+
+    auto paths = std::vector<std::filesystem::path>{};
+    for (auto i = 0; i < 20; ++i) {
+        auto path = dir / ("tool" + std::to_string(i) + ".cwl");
+        auto ofs  = std::ofstream{path};
+        ofs << "cwlVersion: v1.2\n"
+               "class: CommandLineTool\n"
+               "label: tool"
+            << i << "\n"
+               "baseCommand: echo\n"
+               "inputs:\n"
+               "  input:\n"
+               "    type: File\n"
+               "outputs: []\n";
+        paths.push_back(path);
+    }
+    paths.insert(paths.begin() + 5, dir / "does_not_exist.cwl");
+
+    auto results = cwl::load_documents(paths, 4);
+    assert(results.size() == paths.size());
+
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        if (i == 5) { // the missing file reports an error in place
+            assert(!results[i]);
+            assert(!results[i].error.empty());
+            continue;
+        }
+        assert(results[i]);
+        assert(results[i].error.empty());
+        [[maybe_unused]] auto const & tool = std::get<cwl::cwl::CommandLineTool>(*results[i].document);
+        auto expected     = "tool" + std::to_string(i < 5 ? i : i - 1);
+        assert(std::get<std::string>(*tool.label) == expected);
+        assert(tool.inputs->size() == 1);
+    }
+
+    // single threaded loading yields the same documents
+    auto sequential = cwl::load_documents(paths, 1);
+    assert(sequential.size() == results.size());
+    for (std::size_t i = 0; i < sequential.size(); ++i) {
+        assert(static_cast<bool>(sequential[i]) == static_cast<bool>(results[i]));
+    }
+
+    assert(cwl::load_documents({}).empty());
+
+    // a directory is reported like a missing file, with its path
+    [[maybe_unused]] auto fromDirectory = cwl::load_documents({dir}, 1);
+    assert(!fromDirectory[0]);
+    assert(fromDirectory[0].error.find(dir.string()) != std::string::npos);
+
+    std::filesystem::remove_all(dir);
+}
+
+void testStoreDocument() {
+    namespace cwl = w3id_org::cwl;
+
+    auto document = cwl::load_document_from_string("cwlVersion: v1.2\n"
+                                                    "class: CommandLineTool\n"
+                                                    "baseCommand: echo\n"
+                                                    "inputs:\n"
+                                                    "  input:\n"
+                                                    "    type: File\n"
+                                                    "outputs: []\n");
+
+    auto expected = std::string{R"(inputs:
+  input: File
+outputs:
+  []
+cwlVersion: v1.2
+class: CommandLineTool
+baseCommand: echo
+)"};
+
+    auto ss = std::stringstream{};
+    cwl::store_document(document, ss);
+    assert(ss.str() == expected);
+
+    assert(cwl::store_document_as_string(document) == expected);
+
+    // the buffer is appended to and can be reused for multiple documents
+    auto buffer = std::string{};
+    cwl::store_document_to_buffer(document, buffer);
+    cwl::store_document_to_buffer(document, buffer);
+    assert(buffer == expected + expected);
+}
+
+} // namespace load_cwl_tests
+
+void testLoadCWL() {
+    load_cwl_tests::testLoadDocuments();
+    load_cwl_tests::testStoreDocument();
+}
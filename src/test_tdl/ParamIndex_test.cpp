@@ -0,0 +1,103 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <algorithm>
+
+#include "utils.h"
+
+namespace param_index_tests {
+
+auto createToolInfo() {
+    auto leaf = [](std::string name, int value) {
+        return tdl::Node{DESINIT(.name =) std::move(name),
+                         DESINIT(.description =){},
+                         DESINIT(.tags =){},
+                         DESINIT(.value =) tdl::IntValue{value}};
+    };
+    auto group = [](std::string name, tdl::Node::Children children) {
+        return tdl::Node{DESINIT(.name =) std::move(name),
+                         DESINIT(.description =){},
+                         DESINIT(.tags =){},
+                         DESINIT(.value =) std::move(children)};
+    };
+    return tdl::ToolInfo{
+        DESINIT(.metaInfo =){},
+        DESINIT(.params =){
+            leaf("threads", 1),
+            group("search", {leaf("index", 2), leaf("errors", 3), group("output", {leaf("verbose", 4)})}),
+            group("build", {leaf("index", 5), leaf("kmer", 6)}),
+        },
+        DESINIT(.cliMapping =){},
+    };
+}
+
+void testLookup() {
+    auto       doc   = createToolInfo();
+    auto const index = tdl::ParamIndex{doc};
+
+    assert(index.size() == 9);
+    assert(index.find("threads") == &doc.params[0]);
+    assert(index.find("search") == &doc.params[1]);
+    assert(std::get<tdl::IntValue>(index.find("search:index")->value).value == 2);
+    assert(std::get<tdl::IntValue>(index.find("build:index")->value).value == 5);
+    assert(std::get<tdl::IntValue>(index.find("search:output:verbose")->value).value == 4);
+    assert(index.find("index") == nullptr);
+    assert(index.find("search:kmer") == nullptr);
+    assert(index.find("") == nullptr);
+
+    assert(std::get<tdl::IntValue>(index.findByName("kmer")->value).value == 6);
+    assert(std::get<tdl::IntValue>(index.findByName("verbose")->value).value == 4);
+    assert(index.findByName("search") == nullptr); // groups are not leafs
+    assert(index.findByName("missing") == nullptr);
+
+    assert(index.findByName("index") == nullptr);
+    assert(index.isAmbiguous("index"));
+    assert(!index.isAmbiguous("kmer"));
+    assert(!index.isAmbiguous("missing"));
+    assert(index.ambiguousNames() == std::vector<std::string>{"index"});
+}
+
+void testModify() {
+    auto doc   = createToolInfo();
+    auto index = tdl::MutableParamIndex{doc};
+
+    std::get<tdl::IntValue>(index.find("build:kmer")->value).value = 31;
+    assert(std::get<tdl::IntValue>(std::get<tdl::Node::Children>(doc.params[2].value)[1].value).value == 31);
+
+    // moving the index keeps it valid
+    auto moved = std::move(index);
+    assert(moved.find("search:output:verbose") != nullptr);
+    assert(moved.findByName("errors") != nullptr);
+}
+
+void testDuplicateSiblings() {
+    auto doc = createToolInfo();
+    doc.params.push_back(doc.params[2]); // a second "build" group
+    std::get<tdl::Node::Children>(doc.params.back().value).pop_back();
+    std::get<tdl::Node::Children>(doc.params.back().value).push_back(doc.params[0]); // build:threads
+
+    auto const index = tdl::ParamIndex{doc};
+    assert(index.find("build") == nullptr);
+    assert(index.find("build:index") == nullptr);
+    assert(index.isAmbiguousPath("build"));
+    assert(index.isAmbiguousPath("build:index"));
+    assert(!index.isAmbiguousPath("search:index"));
+    assert(!index.isAmbiguousPath("missing"));
+
+    // children that exist in only one of the groups are still found
+    assert(index.find("build:kmer") == &std::get<tdl::Node::Children>(doc.params[2].value)[1]);
+    assert(index.find("build:threads") == &std::get<tdl::Node::Children>(doc.params[3].value)[1]);
+
+    auto paths = index.ambiguousPaths();
+    std::sort(paths.begin(), paths.end());
+    assert((paths == std::vector<std::string>{"build", "build:index"}));
+}
+
+} // namespace param_index_tests
+
+void testParamIndex() {
+    param_index_tests::testLookup();
+    param_index_tests::testModify();
+    param_index_tests::testDuplicateSiblings();
+}
@@ -0,0 +1,154 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <stdexcept>
+
+#include "utils.h"
+
+namespace parse_command_line_tests {
+
+auto createToolInfo() {
+    auto node = [](std::string name, tdl::Tags tags, tdl::Node::Value value) {
+        return tdl::Node{DESINIT(.name =) std::move(name),
+                         DESINIT(.description =){},
+                         DESINIT(.tags =) std::move(tags),
+                         DESINIT(.value =) std::move(value)};
+    };
+    return tdl::ToolInfo{
+        DESINIT(.metaInfo =){},
+        DESINIT(.params =){
+            node("verbose", {}, tdl::BoolValue{false}),
+            node("threads", {}, tdl::IntValue{1, 1, 64}),
+            node("build",
+                 {"basecommand"},
+                 tdl::Node::Children{
+                     node("kmer", {}, tdl::IntValue{20, 1, 32}),
+                     node("input", {"required", "file"}, tdl::StringValue{}),
+                     node("output", {"output file"}, tdl::StringValue{"", {{"*.mzML", "*.fa.gz"}}}),
+                     node("options",
+                          {},
+                          tdl::Node::Children{
+                              node("ratio", {}, tdl::DoubleValue{0.5, 0.0, 1.0}),
+                              node("mode", {}, tdl::StringValue{"fast", {{"fast", "slow"}}}),
+                          }),
+                 }),
+            node("search",
+                 {"basecommand"},
+                 tdl::Node::Children{
+                     node("kmer", {}, tdl::IntValue{20}),
+                     node("errors", {}, tdl::IntValueList{{0, 1}, 0, 5}),
+                     node("queries", {}, tdl::StringValueList{}),
+                 }),
+        },
+        DESINIT(.cliMapping =){
+            {DESINIT(.optionIdentifier =) "-v", DESINIT(.referenceName =) "verbose"},
+            {DESINIT(.optionIdentifier =) "--threads", DESINIT(.referenceName =) "threads"},
+            {DESINIT(.optionIdentifier =) "--kmer", DESINIT(.referenceName =) "kmer"},
+            {DESINIT(.optionIdentifier =) "--input", DESINIT(.referenceName =) "input"},
+            {DESINIT(.optionIdentifier =) "-out", DESINIT(.referenceName =) "output"},
+            {DESINIT(.optionIdentifier =) "--ratio", DESINIT(.referenceName =) "build:options:ratio"},
+            {DESINIT(.optionIdentifier =) "--mode", DESINIT(.referenceName =) "mode"},
+            {DESINIT(.optionIdentifier =) "--error", DESINIT(.referenceName =) "errors"},
+            {DESINIT(.optionIdentifier =) "--query", DESINIT(.referenceName =) "queries"},
+        },
+    };
+}
+
+template <typename... Args>
+auto parse(tdl::ToolInfo & doc, Args... args) {
+    auto argv = std::vector<char const *>{"tool", args...};
+    return tdl::parseCommandLine(doc, static_cast<int>(argv.size()), argv.data());
+}
+
+template <typename... Args>
+auto fails(Args... args) -> bool {
+    auto doc = createToolInfo();
+    try {
+        parse(doc, args...);
+    } catch (std::runtime_error const &) {
+        return true;
+    }
+    return false;
+}
+
+auto child(tdl::Node const & node, std::size_t i) -> tdl::Node const & {
+    return std::get<tdl::Node::Children>(node.value)[i];
+}
+
+void testSubCommand() {
+    auto doc = createToolInfo();
+    [[maybe_unused]] auto result =
+        parse(doc, "-v", "build", "--kmer=25", "--input", "in.fa", "--ratio", "0.25", "--threads", "8", "extra");
+
+    assert(result.subCommands == std::vector<std::string>{"build"});
+    assert(result.positional == std::vector<std::string>{"extra"});
+    assert(std::get<tdl::BoolValue>(doc.params[0].value) == true);
+    assert(std::get<tdl::IntValue>(doc.params[1].value).value == 8);
+
+    [[maybe_unused]] auto const & build = doc.params[2];
+    assert(std::get<tdl::IntValue>(child(build, 0).value).value == 25);
+    assert(std::get<tdl::StringValue>(child(build, 1).value).value == "in.fa");
+    assert(std::get<tdl::DoubleValue>(child(child(build, 3), 0).value).value == 0.25);
+
+    // the option of the other sub command is untouched
+    assert(std::get<tdl::IntValue>(child(doc.params[3], 0).value).value == 20);
+}
+
+void testLists() {
+    auto doc = createToolInfo();
+    [[maybe_unused]] auto result =
+        parse(doc, "search", "--error", "3", "--query", "a", "--error=4", "--query", "b", "--", "--kmer");
+
+    assert(result.subCommands == std::vector<std::string>{"search"});
+    assert(result.positional == std::vector<std::string>{"--kmer"});
+
+    [[maybe_unused]] auto const & search = doc.params[3];
+    assert((std::get<tdl::IntValueList>(child(search, 1).value).value == std::vector<int>{3, 4}));
+    assert((std::get<tdl::StringValueList>(child(search, 2).value).value == std::vector<std::string>{"a", "b"}));
+}
+
+//!\brief the valid values of files are their supported formats
+void testFiles() {
+    auto doc = createToolInfo();
+    parse(doc, "build", "--input", "x", "-out", "data/sample.mzML");
+    assert(std::get<tdl::StringValue>(child(doc.params[2], 2).value).value == "data/sample.mzML");
+    parse(doc, "build", "--input", "x", "-out", "reads.FA.GZ");
+    assert(std::get<tdl::StringValue>(child(doc.params[2], 2).value).value == "reads.FA.GZ");
+
+    assert(!fails("build", "--input", "x", "-out", ""));
+    assert(fails("build", "--input", "x", "-out", "sample.txt"));
+    assert(fails("build", "--input", "x", "-out", "reads.fa"));
+}
+
+void testErrors() {
+    assert(!fails("build", "--input", "x"));
+    assert(fails("build"));                                  // missing required option
+    assert(fails("build", "--input", "x", "--unknown"));     // unknown option
+    assert(fails("--kmer", "5"));                            // option of a sub command that is not selected
+    assert(fails("build", "--input", "x", "--kmer", "33"));  // above limit
+    assert(fails("build", "--input", "x", "--kmer", "5a"));  // not a number
+    assert(fails("build", "--input", "x", "--kmer"));        // missing value
+    assert(fails("build", "--input", "x", "--ratio", "-1")); // below limit
+    assert(fails("build", "--input", "x", "--mode", "medium"));
+    assert(!fails("build", "--input", "x", "--mode", "slow"));
+    assert(fails("search", "--error", "6"));
+    assert(!fails("build", "--input", "x", "--ratio", "1e-310")); // subnormal
+    assert(fails("build", "--input", "x", "--ratio", "nan"));
+    assert(fails("build", "--input", "x", "--ratio", " 0.5"));
+    assert(fails("build", "--input", "x", "--ratio", "0.5 "));
+    assert(fails("build", "--input", "x", "--ratio", "1e400"));
+    assert(fails("build", "--input", "x", "--ratio", "0x0.8"));
+    assert(fails("build", "--input", "x", "--ratio", ""));
+    assert(fails("-v=maybe"));
+    assert(!fails("-v=false"));
+}
+
+} // namespace parse_command_line_tests
+
+void testParseCommandLine() {
+    parse_command_line_tests::testSubCommand();
+    parse_command_line_tests::testLists();
+    parse_command_line_tests::testErrors();
+    parse_command_line_tests::testFiles();
+}
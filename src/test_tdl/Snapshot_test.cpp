@@ -0,0 +1,119 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+
+#include "utils.h"
+
+namespace snapshot_tests {
+
+void testRoundTrip() {
+    auto doc  = test_fixtures::toolInfo();
+    auto data = tdl::writeSnapshot(doc);
+    assert(data == tdl::writeSnapshot(doc)); // deterministic
+
+    [[maybe_unused]] auto view = tdl::SnapshotView{data};
+    assert(tdl::fingerprint(view.toToolInfo()) == tdl::fingerprint(doc));
+    assert(tdl::fingerprint(tdl::SnapshotView{tdl::writeSnapshot({})}.toToolInfo()) == tdl::fingerprint({}));
+}
+
+void testView() {
+    auto data = tdl::writeSnapshot(test_fixtures::toolInfo());
+    auto view = tdl::SnapshotView{data};
+
+    assert(view.toolName() == "tool");
+    assert(view.version() == "1.0.0");
+    assert(view.size() == 10);
+    assert(view.cliMappingCount() == 2);
+    assert(view.cliMapping(1).first == "--mode" && view.cliMapping(1).second == "options:mode");
+
+    [[maybe_unused]] auto threads = view.node(view.findChild(tdl::SnapshotView::npos, "threads"));
+    assert(threads.valueType() == tdl::SnapshotView::ValueType::Int);
+    assert(threads.intValue() == -1);
+    assert(!threads.minLimit<int>() && threads.maxLimit<int>() == 64);
+
+    auto options = view.findChild(tdl::SnapshotView::npos, "options");
+    assert(options != tdl::SnapshotView::npos);
+    assert(view.findChild(options, "threads") == tdl::SnapshotView::npos);
+
+    [[maybe_unused]] auto mode = view.node(view.findChild(options, "mode"));
+    assert(mode.stringValue() == "fast");
+    assert(mode.tags().size() == 2 && mode.tags()[0] == "custom" && mode.tags()[1] == "required");
+    assert(mode.validValues() && mode.validValues()->size() == 2 && (*mode.validValues())[1] == "slow");
+    assert(mode.parent() == options);
+
+    [[maybe_unused]] auto scores = view.node(view.findChild(options, "scores"));
+    assert(scores.doubleList().size() == 2 && scores.doubleList()[1] == 1e300);
+
+    [[maybe_unused]] auto names = view.node(view.findChild(options, "names"));
+    assert(names.stringList().size() == 2 && names.stringList()[1].empty());
+    assert(names.validValues() && names.validValues()->size() == 0); // empty, but present
+}
+
+void testMappedFile() {
+    auto doc  = test_fixtures::toolInfo();
+    auto path = std::filesystem::temp_directory_path() / "tdl_snapshot_test.tdls";
+    tdl::writeSnapshot(doc, path);
+    {
+        auto file = tdl::MappedFile{path};
+        [[maybe_unused]] auto view = tdl::SnapshotView{file.data()};
+        assert(tdl::fingerprint(view.toToolInfo()) == tdl::fingerprint(doc));
+
+        auto moved = std::move(file);
+        assert(moved.data().size() == std::filesystem::file_size(path));
+    }
+    std::filesystem::remove(path);
+}
+
+void testErrors() {
+    auto data = tdl::writeSnapshot(test_fixtures::toolInfo());
+
+    [[maybe_unused]] auto fails = [](std::string bytes) {
+        try {
+            tdl::SnapshotView{bytes};
+        } catch (std::runtime_error const &) {
+            return true;
+        }
+        return false;
+    };
+    assert(!fails(data));
+    assert(fails(""));
+    assert(fails(data.substr(0, data.size() - 1))); // truncated
+    assert(fails("x" + data.substr(1)));             // magic
+
+    auto version = data;
+    version[8]   = 2;
+    assert(fails(version));
+
+    // the first node is `verbose`, let its first child point back to itself
+    auto header = tdl::detail::snapshot::Header{};
+    std::memcpy(&header, data.data(), sizeof(header));
+    auto link = data;
+    std::memset(link.data() + header.nodes.offset + sizeof(uint32_t), 0, sizeof(uint32_t));
+    assert(fails(link));
+
+    // a name that refers to a string that does not exist
+    auto name = data;
+    std::memset(name.data() + header.nodes.offset + 3 * sizeof(uint32_t), 0xff, sizeof(uint32_t));
+    assert(fails(name));
+
+    [[maybe_unused]] auto missing = false;
+    try {
+        tdl::MappedFile{std::filesystem::temp_directory_path() / "tdl_snapshot_test_missing.tdls"};
+    } catch (std::runtime_error const &) {
+        missing = true;
+    }
+    assert(missing);
+}
+
+} // namespace snapshot_tests
+
+void testSnapshot() {
+    snapshot_tests::testRoundTrip();
+    snapshot_tests::testView();
+    snapshot_tests::testMappedFile();
+    snapshot_tests::testErrors();
+}
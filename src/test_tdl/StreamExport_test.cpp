@@ -0,0 +1,165 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <filesystem>
+#include <stdexcept>
+
+#include <yaml-cpp/yaml.h>
+
+#include "utils.h"
+
+namespace stream_export_tests {
+
+//!\brief collects the chunks passed to the sink
+struct Collector {
+    std::vector<std::string> chunks{};
+
+    auto sink() -> tdl::ExportSink {
+        return [this](std::string_view chunk) { chunks.emplace_back(chunk); };
+    }
+    auto joined() const {
+        auto result = std::string{};
+        for (auto const & chunk : chunks) {
+            result += chunk;
+        }
+        return result;
+    }
+};
+
+auto streamCTD(tdl::ToolInfo const & doc) {
+    auto collector = Collector{};
+    tdl::streamCTD(doc, collector.sink());
+    return collector.joined();
+}
+
+auto streamCWL(tdl::ToolInfo const & doc) {
+    auto collector = Collector{};
+    tdl::streamCWL(doc, collector.sink());
+    return collector.joined();
+}
+
+//!\brief a tool with nested groups, inputs, outputs and an empty group
+auto createToolInfo(std::size_t paramCount) {
+    auto group = tdl::Node::Children{
+        tdl::Node{DESINIT(.name =) "input",
+                  DESINIT(.description =) "sequences & <more>",
+                  DESINIT(.tags =){"input file", "required"},
+                  DESINIT(.value =) tdl::StringValue{"", {{"*.fa", "*.fasta"}}}},
+        tdl::Node{DESINIT(.name =) "output",
+                  DESINIT(.description =) "",
+                  DESINIT(.tags =){"output file"},
+                  DESINIT(.value =) tdl::StringValue{"out.txt"}},
+        tdl::Node{DESINIT(.name =) "empty",
+                  DESINIT(.description =) "",
+                  DESINIT(.tags =){},
+                  DESINIT(.value =) tdl::Node::Children{}},
+    };
+    auto doc = tdl::ToolInfo{};
+    doc.metaInfo.name           = "stream";
+    doc.metaInfo.version        = "1.0.0";
+    doc.metaInfo.description    = "checks the chunked export\nin two lines";
+    doc.metaInfo.executableName = "stream";
+    doc.metaInfo.citations      = {{"doi:123", "https://example.com/paper"}};
+    doc.params.push_back(tdl::Node{DESINIT(.name =) "build",
+                                   DESINIT(.description =) "a sub command",
+                                   DESINIT(.tags =){"basecommand"},
+                                   DESINIT(.value =) std::move(group)});
+    for (std::size_t i = 0; i < paramCount; ++i) {
+        doc.params.push_back(tdl::Node{DESINIT(.name =) "param" + std::to_string(i),
+                                       DESINIT(.description =) "parameter number " + std::to_string(i),
+                                       DESINIT(.tags =){},
+                                       DESINIT(.value =) tdl::IntValue{static_cast<int>(i), 0, std::nullopt}});
+        doc.cliMapping.push_back({"--param" + std::to_string(i), "param" + std::to_string(i)});
+    }
+    doc.cliMapping.push_back({"--input", "build:input"});
+    doc.cliMapping.push_back({"--output", "build:output"});
+    return doc;
+}
+
+void testSameAsConvert() {
+    for ([[maybe_unused]] auto const & doc : {tdl::ToolInfo{}, createToolInfo(0), createToolInfo(3)}) {
+        assert(streamCTD(doc) == tdl::convertToCTD(doc));
+        assert(streamCWL(doc) == tdl::convertToCWL(doc));
+    }
+}
+
+void testCorpus() {
+    for (auto const & entry : std::filesystem::directory_iterator{TDL_CORPUS_DIR}) {
+        auto const & path = entry.path();
+        if (path.extension() == ".ctd") {
+            auto doc = tdl::importCTD(path);
+            assert(streamCTD(doc) == tdl::convertToCTD(doc));
+            assert(streamCWL(doc) == tdl::convertToCWL(doc));
+        } else if (path.extension() == ".cwl") {
+            auto doc = tdl::importCWL(path);
+            assert(streamCTD(doc) == tdl::convertToCTD(doc));
+            assert(streamCWL(doc) == tdl::convertToCWL(doc));
+        }
+    }
+}
+
+void testChunks() {
+    auto doc = createToolInfo(2000);
+    for (auto format : {tdl::DescriptorFormat::CTD, tdl::DescriptorFormat::CWL}) {
+        auto collector = Collector{};
+        if (format == tdl::DescriptorFormat::CTD) {
+            tdl::streamCTD(doc, collector.sink());
+            assert(collector.joined() == tdl::convertToCTD(doc));
+        } else {
+            tdl::streamCWL(doc, collector.sink());
+            assert(collector.joined() == tdl::convertToCWL(doc));
+        }
+        assert(collector.chunks.size() > 4);
+        for (std::size_t i = 0; i + 1 < collector.chunks.size(); ++i) {
+            assert(collector.chunks[i].size() >= tdl::exportChunkSize);
+            assert(collector.chunks[i].size() < 2 * tdl::exportChunkSize);
+        }
+        assert(!collector.chunks.back().empty());
+    }
+}
+
+void testPostProcess() {
+    auto doc         = createToolInfo(3);
+    auto postProcess = [](YAML::Node & node) { node["requirements"]["DockerRequirement"]["dockerPull"] = "stream"; };
+
+    auto collector = Collector{};
+    tdl::streamCWL(doc, collector.sink(), postProcess);
+    assert(collector.joined() == tdl::convertToCWL(doc, postProcess));
+    assert(collector.joined().find("dockerPull: stream") != std::string::npos);
+}
+
+void testSinkThrows() {
+    auto doc   = createToolInfo(2000);
+    auto calls = 0;
+    auto sink  = [&](std::string_view) {
+        if (++calls == 2) {
+            throw std::runtime_error{"disk full"};
+        }
+    };
+    for (auto format : {tdl::DescriptorFormat::CTD, tdl::DescriptorFormat::CWL}) {
+        calls = 0;
+        [[maybe_unused]] auto thrown = false;
+        try {
+            if (format == tdl::DescriptorFormat::CTD) {
+                tdl::streamCTD(doc, sink);
+            } else {
+                tdl::streamCWL(doc, sink);
+            }
+        } catch (std::runtime_error const & e) {
+            thrown = std::string_view{e.what()} == "disk full";
+        }
+        assert(thrown);
+        assert(calls == 2);
+    }
+}
+
+} // namespace stream_export_tests
+
+void testStreamExport() {
+    stream_export_tests::testSameAsConvert();
+    stream_export_tests::testCorpus();
+    stream_export_tests::testChunks();
+    stream_export_tests::testPostProcess();
+    stream_export_tests::testSinkThrows();
+}
@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <iterator>
+
+#include "utils.h"
+
+namespace tags_tests {
+
+void testSetInterface() {
+    auto tags = tdl::Tags{"required", "zebra", "file", "alpha"};
+
+    assert(tags.size() == 4);
+    assert(!tags.empty());
+    assert(tags.count("required") == 1);
+    assert(tags.contains(tdl::Tag::required));
+    assert(tags.contains(tdl::Tag::file));
+    assert(!tags.contains(tdl::Tag::output));
+    assert(tags.count("zebra") == 1);
+    assert(tags.count("beta") == 0);
+
+    // iteration merges well known and custom tags in sorted order
+    assert((std::vector<std::string>(tags.begin(), tags.end()) == std::vector<std::string>{"alpha", "file", "required", "zebra"}));
+    assert(std::distance(tags.begin(), tags.end()) == 4);
+
+    assert(!tags.insert("file"));
+    assert(tags.insert(tdl::Tag::input_file));
+    assert(tags.count("input file") == 1);
+    assert(tags.insert("beta"));
+    assert(!tags.insert("beta"));
+
+    assert(tags.erase("required") == 1);
+    assert(tags.erase(tdl::Tag::required) == 0);
+    assert(tags.erase("zebra") == 1);
+    assert(tags.erase("zebra") == 0);
+    assert((tags.toSet() == std::set<std::string>{"alpha", "beta", "file", "input file"}));
+
+    tags.clear();
+    assert(tags.empty());
+    assert(tags.begin() == tags.end());
+}
+
+void testConversions() {
+    auto set  = std::set<std::string>{"output", "output file", "custom", "advanced"};
+    auto tags = tdl::Tags{set};
+    assert(tags == set);
+    assert(static_cast<std::set<std::string>>(tags) == set);
+    assert((tags != tdl::Tags{"output"}));
+
+    for (auto i = std::size_t{}; i < tdl::Tags::knownCount; ++i) {
+        [[maybe_unused]] auto tag = static_cast<tdl::Tag>(i);
+        assert(tdl::Tags::fromName(tdl::Tags::name(tag)) == tag);
+    }
+    assert(!tdl::Tags::fromName("outputs"));
+}
+
+} // namespace tags_tests
+
+void testTags() {
+    tags_tests::testSetInterface();
+    tags_tests::testConversions();
+}
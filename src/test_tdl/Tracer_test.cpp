@@ -0,0 +1,155 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include "utils.h"
+
+#include <fstream>
+#include <iterator>
+#include <thread>
+
+#include <tdl/cwl_v1_2.h>
+
+namespace tracer_tests {
+
+auto count(std::string const & str, std::string const & pattern) -> std::size_t {
+    auto result = std::size_t{};
+    for (auto pos = str.find(pattern); pos != std::string::npos; pos = str.find(pattern, pos + 1)) {
+        ++result;
+    }
+    return result;
+}
+
+auto spanCount(std::string const & json) -> std::size_t {
+    return count(json, "\"ph\":\"X\"");
+}
+
+void testDisabled() {
+    tdl::clearTrace();
+    tdl::convertToCTD(test_fixtures::smallToolInfo());
+    assert(spanCount(tdl::traceToJSON()) == 0);
+}
+
+void testExports() {
+    auto doc = test_fixtures::smallToolInfo();
+
+    tdl::clearTrace();
+    tdl::startTracing();
+    tdl::convertToCTD(doc);
+    tdl::convertToCWL(doc);
+    tdl::stopTracing();
+    tdl::convertToCTD(doc);
+
+    auto json = tdl::traceToJSON();
+    assert(json.rfind("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0) == 0);
+    assert(count(json, "\"name\":\"convertToCTD\",\"cat\":\"tdl\"") == 1);
+    assert(count(json, "\"name\":\"convertToCWL\",\"cat\":\"tdl\"") == 1);
+    assert(count(json, "\"args\":{\"detail\":\"tool\"}") == 2);
+    assert(count(json, "\"name\":\"ctd_build\",\"cat\":\"tdl.phase\"") == 1);
+    assert(count(json, "\"name\":\"cwl_emit\",\"cat\":\"tdl.phase\"") == 1);
+    // one subtree span per export for the only group, its name is the detail
+    assert(count(json, "\"name\":\"subtree\",\"cat\":\"tdl.subtree\"") == 2);
+    assert(count(json, "\"args\":{\"detail\":\"group\"}") == 2);
+    assert(count(json, "\"ph\":\"M\"") == 1);
+}
+
+void testLoadCWL() {
+    tdl::clearTrace();
+    tdl::startTracing();
+    w3id_org::cwl::load_document_from_string(tdl::convertToCWL(test_fixtures::smallToolInfo()));
+    tdl::stopTracing();
+
+    auto json = tdl::traceToJSON();
+    assert(count(json, "\"name\":\"YAML::Load\",\"cat\":\"cwl\"") == 1);
+    assert(count(json, "\"name\":\"fromYaml\",\"cat\":\"cwl\"") == 1);
+}
+
+void testEscaping() {
+    tdl::clearTrace();
+    tdl::startTracing();
+    { auto span = tdl::detail::TraceSpan{"test", "a\"b\\c\n\x01", "tab\t"}; }
+    tdl::stopTracing();
+
+    auto json = tdl::traceToJSON();
+    assert(count(json, "\"name\":\"a\\\"b\\\\c\\n\\u0001\"") == 1);
+    assert(count(json, "\"args\":{\"detail\":\"tab\\t\"}") == 1);
+}
+
+//!\brief the detail is copied into the span, long details are truncated
+void testDetail() {
+    auto capacity = tdl::detail::traceDetailCapacity;
+    auto detail   = std::string(capacity, 'x') + "cut";
+    auto umlauts  = std::string(capacity - 1, 'x') + "\xc3\xa4";
+
+    tdl::clearTrace();
+    tdl::startTracing();
+    { auto span = tdl::detail::TraceSpan{"test", "long", detail}; }
+    { auto span = tdl::detail::TraceSpan{"test", "utf8", umlauts}; }
+    tdl::stopTracing();
+    detail.assign(detail.size(), 'y');
+
+    // the 'ä' does not fit and is dropped completely
+    [[maybe_unused]] auto json = tdl::traceToJSON();
+    assert(count(json, "\"args\":{\"detail\":\"" + std::string(capacity, 'x') + "\"}") == 1);
+    assert(count(json, "\"args\":{\"detail\":\"" + std::string(capacity - 1, 'x') + "\"}") == 1);
+    assert(count(json, "yyy") == 0);
+    tdl::clearTrace();
+}
+
+void testThreads() {
+    // more spans than fit into one chunk of a thread buffer
+    constexpr auto spansPerThread = std::size_t{600};
+    constexpr auto threadCount    = std::size_t{4};
+
+    tdl::clearTrace();
+    tdl::startTracing();
+    auto threads = std::vector<std::thread>{};
+    for (std::size_t t = 0; t < threadCount; ++t) {
+        threads.emplace_back([]() {
+            for (std::size_t i = 0; i < spansPerThread; ++i) {
+                auto span = tdl::detail::TraceSpan{"test", "worker"};
+            }
+        });
+    }
+    // collecting while the threads are recording must be safe
+    [[maybe_unused]] auto partial = tdl::traceToJSON();
+    for (auto & t : threads) {
+        t.join();
+    }
+    tdl::stopTracing();
+
+    auto json = tdl::traceToJSON();
+    assert(spanCount(json) == spansPerThread * threadCount);
+    assert(count(json, "\"ph\":\"M\"") == threadCount);
+
+    tdl::clearTrace();
+    assert(spanCount(tdl::traceToJSON()) == 0);
+}
+
+void testWriteTrace() {
+    auto path = std::filesystem::temp_directory_path() / "tdl_tracer_test.json";
+
+    tdl::clearTrace();
+    tdl::startTracing();
+    tdl::convertToCTD(test_fixtures::smallToolInfo());
+    tdl::stopTracing();
+    tdl::writeTrace(path);
+
+    auto ifs     = std::ifstream{path, std::ios::binary};
+    auto content = std::string{std::istreambuf_iterator<char>{ifs}, std::istreambuf_iterator<char>{}};
+    assert(content == tdl::traceToJSON());
+    std::filesystem::remove(path);
+    tdl::clearTrace();
+}
+
+} // namespace tracer_tests
+
+void testTracer() {
+    tracer_tests::testDisabled();
+    tracer_tests::testExports();
+    tracer_tests::testLoadCWL();
+    tracer_tests::testEscaping();
+    tracer_tests::testDetail();
+    tracer_tests::testThreads();
+    tracer_tests::testWriteTrace();
+}
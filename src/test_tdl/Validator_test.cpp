@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <type_traits>
+
+#include "utils.h"
+
+namespace validator_tests {
+
+void testState() {
+    using IntState [[maybe_unused]]    = tdl::IntValue::State;
+    using StringState [[maybe_unused]] = tdl::StringValue::State;
+
+    assert((tdl::IntValue{5, 1, 9}.state() == IntState::Ok));
+    assert((tdl::IntValue{0, 1, 9}.state() == IntState::ValueTooLow));
+    assert((tdl::IntValue{10, 1, 9}.state() == IntState::ValueTooHigh));
+    assert((tdl::IntValue{5, 9, 1}.state() == IntState::LimitsInvalid));
+    assert((tdl::DoubleValueList{{0.5, 1.5}, 0.0, 1.0}.state() == tdl::DoubleValueList::State::ValueTooHigh));
+    assert((tdl::IntValueList{{3, 4}, 1, 9}.state() == tdl::IntValueList::State::Ok));
+
+    assert((tdl::StringValue{"a", {{"a", "b"}}}.state() == StringState::Valid));
+    assert((tdl::StringValue{"c", {{"a", "b"}}}.state() == StringState::Invalid));
+    assert((tdl::StringValueList{{"a", "c"}, {{"a", "b"}}}.state() == tdl::StringValueList::State::Invalid));
+    assert((tdl::StringValueList{{"a", "c"}}.state() == tdl::StringValueList::State::Valid));
+
+    // supported formats of files are patterns, an empty file name is not set
+    assert((tdl::StringValue{"", {{"*.mzML"}}}.state() == StringState::Valid));
+    assert((tdl::StringValue{"data/sample.MZML", {{"*.mzML"}}}.state() == StringState::Valid));
+    assert((tdl::StringValue{"sample.fa.gz", {{"*.fa", "*.fa.gz"}}}.state() == StringState::Valid));
+    assert((tdl::StringValue{"sample.txt", {{"*.mzML"}}}.state() == StringState::Invalid));
+    assert((tdl::StringValueList{{"a.mzML", "b.mzXML"}, {{"*.mzML"}}}.state()
+            == tdl::StringValueList::State::Invalid));
+}
+
+//!\brief the valid values of file nodes are their supported formats, like CTD writes them
+void testFiles() {
+    auto node = [](std::string name, tdl::Tags tags, tdl::Node::Value value) {
+        return tdl::Node{DESINIT(.name =) std::move(name),
+                         DESINIT(.description =){},
+                         DESINIT(.tags =) std::move(tags),
+                         DESINIT(.value =) std::move(value)};
+    };
+    auto doc = tdl::ToolInfo{
+        DESINIT(.metaInfo =){},
+        DESINIT(.params =){
+            node("in", {"input file"}, tdl::StringValue{"", {{"*.mzML"}}}),
+            node("ins", {"input file"}, tdl::StringValueList{{"a.mzML", "b.txt", "c.MZML"}, {{"*.mzML", "*.mzXML"}}}),
+            node("out", {"output file"}, tdl::StringValue{"result.featureXML", {{"*.featureXML"}}}),
+            node("wrong", {"output file"}, tdl::StringValue{"result.csv", {{"*.featureXML"}}}),
+            node("prefix", {"output prefix"}, tdl::StringValue{"results/run", {{"*.mzML"}}}),
+        },
+        DESINIT(.cliMapping =){},
+    };
+
+    using Kind    = tdl::ValidationError::Kind;
+    auto expected = std::vector<tdl::ValidationError>{
+        {"ins", Kind::InvalidValue, 1, 1},
+        {"wrong", Kind::InvalidValue, 0, 1},
+    };
+    assert(tdl::validate(doc) == expected);
+    assert(tdl::validate(tdl::importCTDFromString(tdl::convertToCTD(doc))) == expected);
+}
+
+void testValidator() {
+    auto node = [](std::string name, tdl::Node::Value value) {
+        return tdl::Node{DESINIT(.name =) std::move(name),
+                         DESINIT(.description =){},
+                         DESINIT(.tags =){},
+                         DESINIT(.value =) std::move(value)};
+    };
+    auto doc = tdl::ToolInfo{
+        DESINIT(.metaInfo =){},
+        DESINIT(.params =){
+            node("ok", tdl::IntValue{5, 1, 9}),
+            node("low", tdl::IntValue{0, 1, 9}),
+            node("limits", tdl::DoubleValue{0.5, 1.0, 0.0}),
+            node("group",
+                 tdl::Node::Children{
+                     node("ints", tdl::IntValueList{{5, -1, 3, 20, -2, 30}, 0, 10}),
+                     node("doubles", tdl::DoubleValueList{{0.5, 0.25}, 0.0, 1.0}),
+                     node("mode", tdl::StringValue{"fast", {{"fast", "slow"}}}),
+                     node("modes", tdl::StringValueList{{"fast", "medium", "slow", "turbo"}, {{"fast", "slow"}}}),
+                 }),
+            node("name", tdl::StringValue{"free text"}),
+            node("other", tdl::StringValue{"medium", {{"fast", "slow"}}}),
+        },
+        DESINIT(.cliMapping =){},
+    };
+
+    using Kind    = tdl::ValidationError::Kind;
+    auto expected = std::vector<tdl::ValidationError>{
+        {"low", Kind::ValueTooLow, 0, 1},
+        {"limits", Kind::LimitsInvalid, 0, 1},
+        {"group:ints", Kind::ValueTooLow, 1, 2},
+        {"group:ints", Kind::ValueTooHigh, 3, 2},
+        {"group:modes", Kind::InvalidValue, 1, 2},
+        {"other", Kind::InvalidValue, 0, 1},
+    };
+    assert(tdl::validate(doc) == expected);
+
+    // the validator can be reused after changing values
+    auto validator = tdl::Validator{doc};
+    std::get<tdl::IntValue>(doc.params[1].value).value = 1;
+    std::get<tdl::StringValue>(doc.params[5].value).value = "slow";
+    expected.erase(expected.begin());
+    expected.pop_back();
+    assert(validator.validate() == expected);
+
+    assert(tdl::validate(tdl::ToolInfo{}).empty());
+
+    // the validator refers to the nodes, so it can not be built from a temporary
+    static_assert(!std::is_constructible_v<tdl::Validator, tdl::ToolInfo>);
+    static_assert(std::is_constructible_v<tdl::Validator, tdl::ToolInfo &>);
+}
+
+} // namespace validator_tests
+
+void testValidator() {
+    validator_tests::testState();
+    validator_tests::testValidator();
+    validator_tests::testFiles();
+}
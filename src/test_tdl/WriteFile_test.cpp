@@ -0,0 +1,93 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <chrono>
+#include <filesystem>
+#include <stdexcept>
+
+#include "utils.h"
+
+namespace write_file_tests {
+
+auto fileCount(std::filesystem::path const & dir) {
+    auto count = std::size_t{};
+    for ([[maybe_unused]] auto const & entry : std::filesystem::directory_iterator{dir}) {
+        ++count;
+    }
+    return count;
+}
+
+void testWriteFileAtomically() {
+    auto dir = std::filesystem::temp_directory_path() / "tdl_write_file_test";
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+    auto path = dir / "tool.cwl";
+
+    tdl::writeFileAtomically(path, "first");
+    assert(tdl::MappedFile{path}.data() == "first");
+
+    // an existing file is replaced, no temporary file is left behind
+    tdl::writeFileAtomically(path, "second version");
+    assert(tdl::MappedFile{path}.data() == "second version");
+    tdl::writeFileAtomically(path, "");
+    assert(tdl::MappedFile{path}.data().empty());
+    assert(fileCount(dir) == 1);
+
+    // a missing directory is not created
+    [[maybe_unused]] auto throws = false;
+    try {
+        tdl::writeFileAtomically(dir / "missing" / "tool.cwl", "content");
+    } catch (std::runtime_error const &) {
+        throws = true;
+    }
+    assert(throws);
+    assert(fileCount(dir) == 1);
+
+    std::filesystem::remove_all(dir);
+}
+
+void testWriteFileIfChanged() {
+    auto dir = std::filesystem::temp_directory_path() / "tdl_write_file_if_changed_test";
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+    auto path = dir / "tool.ctd";
+
+    assert(tdl::writeFileIfChanged(path, "content"));
+
+    // the same content does not touch the file
+    auto old = std::filesystem::file_time_type::clock::now() - std::chrono::hours{1};
+    std::filesystem::last_write_time(path, old);
+    assert(!tdl::writeFileIfChanged(path, "content"));
+    assert(std::filesystem::last_write_time(path) == old);
+
+    assert(tdl::writeFileIfChanged(path, "CONTENT")); // same size
+    assert(tdl::MappedFile{path}.data() == "CONTENT");
+    assert(std::filesystem::last_write_time(path) != old);
+    assert(tdl::writeFileIfChanged(path, "longer content"));
+    assert(tdl::writeFileIfChanged(path, ""));
+    assert(!tdl::writeFileIfChanged(path, ""));
+
+    auto doc          = tdl::ToolInfo{};
+    doc.metaInfo.name = "tool";
+    assert(tdl::writeIfChanged(path, doc, tdl::DescriptorFormat::CTD));
+    assert(tdl::MappedFile{path}.data() == tdl::convertToCTD(doc));
+    assert(!tdl::writeIfChanged(path, doc, tdl::DescriptorFormat::CTD));
+    assert(tdl::writeIfChanged(path, doc, tdl::DescriptorFormat::CWL));
+    assert(fileCount(dir) == 1);
+
+    std::filesystem::remove_all(dir);
+}
+
+void testVersion() {
+    assert(!tdl::version().empty());
+    assert(tdl::version().find('.') != std::string_view::npos);
+}
+
+} // namespace write_file_tests
+
+void testWriteFile() {
+    write_file_tests::testWriteFileAtomically();
+    write_file_tests::testWriteFileIfChanged();
+    write_file_tests::testVersion();
+}
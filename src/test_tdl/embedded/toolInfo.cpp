@@ -0,0 +1,36 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+// built into the generator of tdl_generate_descriptors and into test_tdl, see EmbedDescriptors_test.cpp
+
+#include "../utils.h"
+
+namespace embed_descriptors_tests {
+
+auto toolInfo() -> tdl::ToolInfo {
+    return tdl::ToolInfo{
+        DESINIT(.metaInfo =){DESINIT(.version =){"1.0.0"},
+                             DESINIT(.name =){"embedded"},
+                             DESINIT(.docurl =){"example.com"},
+                             DESINIT(.category =){"test"},
+                             DESINIT(.description =){"a tool with 'quotes', \\backslashes\\ and\nnew lines, 10 µm"},
+                             DESINIT(.executableName =){"embedded"}},
+        DESINIT(.params =){
+            tdl::Node{DESINIT(.name =) "threads",
+                      DESINIT(.description =) "number of threads",
+                      DESINIT(.tags =){},
+                      DESINIT(.value =) tdl::IntValue{1, 1, 64}},
+            tdl::Node{DESINIT(.name =) "mode",
+                      DESINIT(.description =) "\"fast\" or \"slow\"",
+                      DESINIT(.tags =){},
+                      DESINIT(.value =) tdl::StringValue{"fast", {{"fast", "slow"}}}},
+        },
+        DESINIT(.cliMapping =){
+            {DESINIT(.optionIdentifier =) "--threads", DESINIT(.referenceName =) "threads"},
+            {DESINIT(.optionIdentifier =) "--mode", DESINIT(.referenceName =) "mode"},
+        },
+    };
+}
+
+} // namespace embed_descriptors_tests
@@ -6,10 +6,50 @@
 
 void testCTD();
 void testCWL();
+void testLoadCWL();
+void testImportCTD();
+void testImportCWL();
+void testTags();
+void testFlatToolInfo();
+void testParamIndex();
+void testValidator();
+void testParseCommandLine();
+void testApplyValues();
+void testFingerprint();
+void testDiff();
+void testSnapshot();
+void testEmbedDescriptors();
+void testCorpus();
+void testExportStats();
+void testTracer();
+void testWriteFile();
+void testExportAll();
+void testCachedExporter();
+void testStreamExport();
 
 int main() {
     testCTD();
     testCWL();
+    testLoadCWL();
+    testImportCTD();
+    testImportCWL();
+    testTags();
+    testFlatToolInfo();
+    testParamIndex();
+    testValidator();
+    testParseCommandLine();
+    testApplyValues();
+    testFingerprint();
+    testDiff();
+    testSnapshot();
+    testEmbedDescriptors();
+    testCorpus();
+    testExportStats();
+    testTracer();
+    testWriteFile();
+    testExportAll();
+    testCachedExporter();
+    testStreamExport();
     std::cout << "Success! Nothing failed!\n";
     return EXIT_SUCCESS;
 }
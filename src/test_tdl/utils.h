@@ -14,3 +14,71 @@
 #else
 #    define DESINIT(x)
 #endif
+
+namespace test_fixtures {
+
+//!\brief a tool with two parameters, one of them in a group
+inline auto smallToolInfo() -> tdl::ToolInfo {
+    return tdl::ToolInfo{
+        DESINIT(.metaInfo =){DESINIT(.version =){"1.0.0"}, DESINIT(.name =){"tool"}},
+        DESINIT(.params =){
+            tdl::Node{DESINIT(.name =) "threads",
+                      DESINIT(.description =) "",
+                      DESINIT(.tags =){},
+                      DESINIT(.value =) tdl::IntValue{1}},
+            tdl::Node{DESINIT(.name =) "group",
+                      DESINIT(.description =) "",
+                      DESINIT(.tags =){},
+                      DESINIT(.value =) tdl::Node::Children{
+                          tdl::Node{DESINIT(.name =) "ratio",
+                                    DESINIT(.description =) "",
+                                    DESINIT(.tags =){},
+                                    DESINIT(.value =) tdl::DoubleValue{0.5}},
+                      }},
+        },
+    };
+}
+
+/*!\brief a tool that uses every value type, limits, valid values, tags, an empty group and cli mappings
+ *
+ * `params[2]` is the group "options".
+ */
+inline auto toolInfo() -> tdl::ToolInfo {
+    auto node = [](std::string name, tdl::Tags tags, tdl::Node::Value value) {
+        auto description = "description of " + name;
+        return tdl::Node{DESINIT(.name =) std::move(name),
+                         DESINIT(.description =) std::move(description),
+                         DESINIT(.tags =) std::move(tags),
+                         DESINIT(.value =) std::move(value)};
+    };
+    return tdl::ToolInfo{
+        DESINIT(.metaInfo =){DESINIT(.version =){"1.0.0"},
+                             DESINIT(.name =){"tool"},
+                             DESINIT(.docurl =){"example.com"},
+                             DESINIT(.category =){"test"},
+                             DESINIT(.description =){"a tool"},
+                             DESINIT(.executableName =){"tool"},
+                             DESINIT(.citations =){{"doi", "url"}, {"doi2", "url2"}}},
+        DESINIT(.params =){
+            node("verbose", {"advanced"}, tdl::BoolValue{true}),
+            node("threads", {}, tdl::IntValue{-1, std::nullopt, 64}),
+            node("options",
+                 {},
+                 tdl::Node::Children{
+                     node("ratio", {}, tdl::DoubleValue{0.5, 0.0, 1.0}),
+                     node("mode", {"custom", "required"}, tdl::StringValue{"fast", {{"fast", "slow"}}}),
+                     node("errors", {}, tdl::IntValueList{{0, 1}, 0, std::nullopt}),
+                     node("scores", {}, tdl::DoubleValueList{{-0.5, 1e300}}),
+                     node("names", {"file"}, tdl::StringValueList{{"a", ""}, std::vector<std::string>{}}),
+                     node("empty", {}, tdl::Node::Children{}),
+                 }),
+            node("output", {"output", "file"}, tdl::StringValue{}),
+        },
+        DESINIT(.cliMapping =){
+            {DESINIT(.optionIdentifier =) "--threads", DESINIT(.referenceName =) "threads"},
+            {DESINIT(.optionIdentifier =) "--mode", DESINIT(.referenceName =) "options:mode"},
+        },
+    };
+}
+
+} // namespace test_fixtures
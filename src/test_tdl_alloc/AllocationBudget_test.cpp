@@ -0,0 +1,96 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <cassert>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <tdl/tdl.h>
+
+#include "AllocationCounter.h"
+#include "SyntheticToolInfo.h"
+
+namespace allocation_budget_tests {
+
+// compilers may drop a new/delete pair whose memory is not used elsewhere
+void const * volatile escaped = nullptr;
+
+void testCounter() {
+    assert(alloc::countAllocations([]() {}) == 0);
+    assert(alloc::countAllocations([]() {
+               auto p  = std::make_unique<int>(1);
+               escaped = p.get();
+           }) == 1);
+    assert(alloc::countAllocations([]() {
+               auto v  = std::vector<int>(100);
+               escaped = v.data();
+           }) == 1);
+
+    struct alignas(64) Aligned {
+        char c;
+    };
+    assert(alloc::countAllocations([]() {
+               auto p  = std::make_unique<Aligned>();
+               escaped = p.get();
+           }) == 1);
+
+    [[maybe_unused]] auto before = alloc::allocatedBytes();
+
+    auto v  = std::vector<char>(1000);
+    escaped = v.data();
+    assert(alloc::allocatedBytes() - before == 1000);
+}
+
+/* The budgets were measured with libstdc++ and leave about 20% of headroom for other standard
+ * libraries and yaml-cpp versions. Lower them after improving an exporter.
+ */
+void testExporters() {
+    auto flat   = synthetic::generate({100, 0}); // 100 nodes
+    auto nested = synthetic::generate({10, 1});  // 110 nodes
+
+    alloc::expectAllocationsAtMost("convertToCTD flat", 7000, [&]() { tdl::convertToCTD(flat); });
+    alloc::expectAllocationsAtMost("convertToCTD nested", 8000, [&]() { tdl::convertToCTD(nested); });
+    alloc::expectAllocationsAtMost("convertToCWL flat", 90000, [&]() { tdl::convertToCWL(flat); });
+    alloc::expectAllocationsAtMost("convertToCWL nested", 105000, [&]() { tdl::convertToCWL(nested); });
+    alloc::expectAllocationsAtMost("writeSnapshot nested", 500, [&]() { tdl::writeSnapshot(nested); });
+}
+
+//!\brief lookups and checks that do not allocate at all
+void testAllocationFree() {
+    auto doc       = synthetic::generate({10, 1});
+    auto index     = tdl::ParamIndex{doc};
+    auto snapshot  = tdl::writeSnapshot(doc);
+    auto validator = tdl::Validator{doc};
+
+    alloc::expectAllocationsAtMost("fingerprint", 0, [&]() { tdl::fingerprint(doc); });
+    alloc::expectAllocationsAtMost("ParamIndex::find", 0, [&]() { index.find("p3:p3_7"); });
+    alloc::expectAllocationsAtMost("Validator::validate without errors", 0, [&]() { validator.validate(); });
+    alloc::expectAllocationsAtMost("SnapshotView", 0, [&]() {
+        auto view  = tdl::SnapshotView{snapshot};
+        auto group = view.findChild(tdl::SnapshotView::npos, "p3");
+        view.findChild(group, "p3_7");
+    });
+
+    // the first span registers the buffer of the thread, the following ones fit into its first chunk
+    auto detail = std::string(100, 'x');
+    tdl::clearTrace();
+    tdl::startTracing();
+    { auto span = tdl::detail::TraceSpan{"test", "first"}; }
+    alloc::expectAllocationsAtMost("TraceSpan", 0, [&]() {
+        for (int i = 0; i < 100; ++i) {
+            auto span = tdl::detail::TraceSpan{"test", "span", detail};
+        }
+    });
+    tdl::stopTracing();
+    tdl::clearTrace();
+}
+
+} // namespace allocation_budget_tests
+
+void testAllocationBudgets() {
+    allocation_budget_tests::testCounter();
+    allocation_budget_tests::testExporters();
+    allocation_budget_tests::testAllocationFree();
+}
@@ -0,0 +1,90 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+// replaces the global allocation functions of test_tdl_alloc, only the counting ones are needed,
+// the other forms of new and delete forward to them by default
+
+#include "AllocationCounter.h"
+
+#include <cstdlib>
+#include <new>
+
+#ifdef _WIN32
+#    include <malloc.h>
+#endif
+
+namespace {
+
+thread_local std::size_t count = 0;
+thread_local std::size_t bytes = 0;
+
+auto allocate(std::size_t size) -> void * {
+    ++count;
+    bytes += size;
+    return std::malloc(size > 0 ? size : 1);
+}
+
+auto allocate(std::size_t size, std::align_val_t alignment) -> void * {
+    ++count;
+    bytes += size;
+    auto align = static_cast<std::size_t>(alignment);
+#ifdef _WIN32
+    return _aligned_malloc(size > 0 ? size : 1, align);
+#else
+    // aligned_alloc requires a multiple of the alignment
+    return std::aligned_alloc(align, ((size > 0 ? size : 1) + align - 1) / align * align);
+#endif
+}
+
+void deallocate(void * p, std::align_val_t) noexcept {
+#ifdef _WIN32
+    _aligned_free(p);
+#else
+    std::free(p);
+#endif
+}
+
+} // namespace
+
+namespace alloc {
+
+auto allocationCount() -> std::size_t {
+    return count;
+}
+
+auto allocatedBytes() -> std::size_t {
+    return bytes;
+}
+
+} // namespace alloc
+
+void * operator new(std::size_t size) {
+    if (auto p = allocate(size)) {
+        return p;
+    }
+    throw std::bad_alloc{};
+}
+
+void * operator new(std::size_t size, std::align_val_t alignment) {
+    if (auto p = allocate(size, alignment)) {
+        return p;
+    }
+    throw std::bad_alloc{};
+}
+
+void operator delete(void * p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void * p, std::size_t) noexcept {
+    std::free(p);
+}
+
+void operator delete(void * p, std::align_val_t alignment) noexcept {
+    deallocate(p, alignment);
+}
+
+void operator delete(void * p, std::size_t, std::align_val_t alignment) noexcept {
+    deallocate(p, alignment);
+}
@@ -0,0 +1,51 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#pragma once
+
+#include <cstddef>
+#include <iostream>
+#include <string_view>
+
+/*!\brief allocation counting of test_tdl_alloc
+ *
+ * AllocationCounter.cpp replaces the global operator new and delete of this test binary.
+ * The counters are per thread, allocations of other threads are not seen.
+ */
+namespace alloc {
+
+//!\brief number of allocations of the current thread since it started
+auto allocationCount() -> std::size_t;
+
+//!\brief number of bytes requested by all allocations of the current thread since it started
+auto allocatedBytes() -> std::size_t;
+
+//!\brief number of allocations made by `f`
+template <typename F>
+auto countAllocations(F && f) -> std::size_t {
+    auto before = allocationCount();
+    f();
+    return allocationCount() - before;
+}
+
+//!\brief number of failed expectations, main returns an error if it is not zero
+inline std::size_t failures = 0;
+
+/*!\brief checks that `f` makes at most `budget` allocations
+ *
+ * Unlike `assert`, a failed check is also reported in release builds. The actual number is
+ * printed, so a budget can be lowered after an improvement.
+ */
+template <typename F>
+auto expectAllocationsAtMost(std::string_view name, std::size_t budget, F && f) -> bool {
+    auto count = countAllocations(f);
+    if (count > budget) {
+        std::cerr << name << ": " << count << " allocations, budget " << budget << '\n';
+        ++failures;
+        return false;
+    }
+    return true;
+}
+
+} // namespace alloc
@@ -0,0 +1,20 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <cstdlib>
+#include <iostream>
+
+#include "AllocationCounter.h"
+
+void testAllocationBudgets();
+
+int main() {
+    testAllocationBudgets();
+    if (alloc::failures > 0) {
+        std::cerr << alloc::failures << " allocation budgets exceeded\n";
+        return EXIT_FAILURE;
+    }
+    std::cout << "Success! Nothing failed!\n";
+    return EXIT_SUCCESS;
+}
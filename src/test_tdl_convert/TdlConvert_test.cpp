@@ -0,0 +1,129 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+namespace tdl_convert_tests {
+
+struct Run {
+    int         status;
+    std::string out;
+};
+
+auto readFile(std::filesystem::path const & path) -> std::string {
+    auto file   = std::ifstream{path, std::ios::binary};
+    auto buffer = std::stringstream{};
+    buffer << file.rdbuf();
+    return buffer.str();
+}
+
+void writeFile(std::filesystem::path const & path, std::string const & content) {
+    auto file = std::ofstream{path, std::ios::binary};
+    file << content;
+}
+
+//!\brief a scratch directory with "in/stellar.ctd" and "in/stellar.cwl" from the corpus
+auto workDir() {
+    auto dir = std::filesystem::temp_directory_path() / "tdl_convert_test";
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir / "in");
+    for (auto name : {"stellar.ctd", "stellar.cwl"}) {
+        std::filesystem::copy_file(std::filesystem::path{TDL_CORPUS_DIR} / name, dir / "in" / name);
+    }
+    return dir;
+}
+
+//!\brief runs tdl-convert with `args`, its standard output is returned
+auto run(std::filesystem::path const & tdlConvert, std::filesystem::path const & dir, std::string const & args)
+    -> Run {
+    auto log     = dir / "stdout.txt";
+    auto command = '"' + tdlConvert.string() + "\" " + args + " > \"" + log.string() + '"';
+    auto status  = std::system(command.c_str());
+    return {status, readFile(log)};
+}
+
+//!\brief "--to snapshot -o <dir>/out <dir>/in --stats"
+auto snapshotArgs(std::filesystem::path const & dir, std::string const & extra = {}) {
+    return "--to snapshot -o \"" + (dir / "out").string() + "\" \"" + (dir / "in").string() + "\" --stats" + extra;
+}
+
+auto contains(std::string const & text, std::string const & part) {
+    return text.find(part) != std::string::npos;
+}
+
+//!\brief stellar.ctd and stellar.cwl are converted into two different snapshots
+void testSnapshotNames(std::filesystem::path const & tdlConvert) {
+    auto dir = workDir();
+
+    [[maybe_unused]] auto result = run(tdlConvert, dir, snapshotArgs(dir));
+    assert(result.status == 0);
+    assert(std::filesystem::exists(dir / "out" / "stellar.ctd.tdl"));
+    assert(std::filesystem::exists(dir / "out" / "stellar.cwl.tdl"));
+    assert(readFile(dir / "out" / "stellar.ctd.tdl") != readFile(dir / "out" / "stellar.cwl.tdl"));
+
+    std::filesystem::remove_all(dir);
+}
+
+//!\brief inputs listed in the manifest with the same hash are skipped, as long as their output exists
+void testUnchanged(std::filesystem::path const & tdlConvert) {
+    auto dir      = workDir();
+    auto ctdOut   = dir / "out" / "stellar.ctd.tdl";
+    auto manifest = dir / "out" / ".tdl-convert";
+
+    [[maybe_unused]] auto result = run(tdlConvert, dir, snapshotArgs(dir));
+    assert(result.status == 0);
+    assert(contains(result.out, "2 converted, 0 unchanged, 0 failed in "));
+    assert(std::count(result.out.begin(), result.out.end(), '\n') == 3);
+    assert(contains(result.out, " ms  converted " + (dir / "in" / "stellar.ctd").string() + " -> " + ctdOut.string()));
+    [[maybe_unused]] auto manifestContent = readFile(manifest);
+    assert(std::count(manifestContent.begin(), manifestContent.end(), '\n') == 2);
+    assert(contains(manifestContent, ctdOut.string()));
+
+    // a skipped input does not touch its output, even if the output was changed in between
+    writeFile(ctdOut, "not a snapshot");
+    result = run(tdlConvert, dir, snapshotArgs(dir));
+    assert(result.status == 0);
+    assert(contains(result.out, "0 converted, 2 unchanged, 0 failed in "));
+    assert(contains(result.out, " ms  unchanged " + (dir / "in" / "stellar.ctd").string()));
+    assert(readFile(ctdOut) == "not a snapshot");
+
+    // a missing output is written again
+    std::filesystem::remove(ctdOut);
+    result = run(tdlConvert, dir, snapshotArgs(dir));
+    assert(contains(result.out, "1 converted, 1 unchanged, 0 failed in "));
+    assert(std::filesystem::exists(ctdOut));
+
+    // so is the output of a changed input
+    writeFile(dir / "in" / "stellar.cwl", readFile(dir / "in" / "stellar.cwl") + "\n# changed\n");
+    result = run(tdlConvert, dir, snapshotArgs(dir));
+    assert(contains(result.out, "1 converted, 1 unchanged, 0 failed in "));
+    assert(contains(result.out, " ms  converted " + (dir / "in" / "stellar.cwl").string()));
+
+    // --force converts everything
+    result = run(tdlConvert, dir, snapshotArgs(dir, " --force"));
+    assert(contains(result.out, "2 converted, 0 unchanged, 0 failed in "));
+
+    // a broken input fails on its own and is not added to the manifest
+    writeFile(dir / "in" / "broken.ctd", "not xml");
+    result = run(tdlConvert, dir, snapshotArgs(dir));
+    assert(result.status != 0);
+    assert(contains(result.out, "0 converted, 2 unchanged, 1 failed in "));
+    assert(contains(result.out, " ms  failed    " + (dir / "in" / "broken.ctd").string()));
+    assert(!contains(readFile(manifest), "broken.ctd.tdl"));
+
+    std::filesystem::remove_all(dir);
+}
+
+} // namespace tdl_convert_tests
+
+void testTdlConvert(std::filesystem::path const & tdlConvert) {
+    tdl_convert_tests::testSnapshotNames(tdlConvert);
+    tdl_convert_tests::testUnchanged(tdlConvert);
+}
@@ -0,0 +1,20 @@
+// SPDX-FileCopyrightText: 2006-2026, Knut Reinert & Freie Universität Berlin
+// SPDX-FileCopyrightText: 2016-2026, Knut Reinert & MPI für molekulare Genetik
+// SPDX-License-Identifier: CC0-1.0
+
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+
+void testTdlConvert(std::filesystem::path const & tdlConvert);
+
+//!\brief runs tdl-convert as a separate process, the path of the binary is the only argument
+int main(int argc, char ** argv) {
+    if (argc != 2) {
+        std::cerr << "usage: test_tdl_convert <path to tdl-convert>\n";
+        return EXIT_FAILURE;
+    }
+    testTdlConvert(argv[1]);
+    std::cout << "Success! Nothing failed!\n";
+    return EXIT_SUCCESS;
+}